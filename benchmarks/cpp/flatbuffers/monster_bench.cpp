@@ -0,0 +1,509 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "flatbuffers/delta.h"
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/reflection.h"
+#include "monster_test_bfbs_generated.h"
+#include "monster_test_generated.h"
+
+using namespace flatbuffers;
+using namespace MyGame::Example;
+
+// Benchmarks over the monster_test.fbs schema, where the data is a root
+// monster with `state.range(0)` monsters in its `testarrayoftables`, sorted by
+// their `name` key.
+
+namespace {
+
+// Strings that occur in every monster, which shared strings dedup.
+const char* const kPooledStrings[] = { "fire", "ice", "poison", "lightning" };
+
+struct BuildOptions {
+  bool dedup_vtables = true;
+  bool share_strings = false;
+  // Changes every `mutate_every`th monster a little, if not 0.
+  int64_t mutate_every = 0;
+};
+
+Offset<String> CreatePooledString(FlatBufferBuilder& fbb, const char* str,
+                                  const BuildOptions& options) {
+  return options.share_strings ? fbb.CreateSharedString(str)
+                               : fbb.CreateString(str);
+}
+
+Offset<Monster> BuildMonster(FlatBufferBuilder& fbb, int64_t i,
+                             const BuildOptions& options) {
+  const int64_t mutated =
+      options.mutate_every && i % options.mutate_every == 0 ? 1 : 0;
+  const auto name = fbb.CreateString("monster #" + std::to_string(i));
+  const Offset<String> strings[] = {
+    CreatePooledString(fbb, kPooledStrings[(i + mutated * 2) % 4], options),
+    CreatePooledString(fbb, kPooledStrings[(i + 1) % 4], options),
+  };
+  const auto testarrayofstring = fbb.CreateVector(strings, 2);
+  uint8_t inventory[16];
+  for (uint8_t j = 0; j < 16; ++j) inventory[j] = static_cast<uint8_t>(i + j);
+  inventory[0] = static_cast<uint8_t>(inventory[0] + mutated);
+  const auto inventory_offset = fbb.CreateVector(inventory, 16);
+
+  const Vec3 pos(static_cast<float>(i), 2.0f, 3.0f, 0.5, Color_Green,
+                 Test(10, 20));
+  MonsterBuilder builder(fbb);
+  builder.add_pos(&pos);
+  builder.add_hp(static_cast<int16_t>(i % 1000 + mutated));
+  builder.add_mana(static_cast<int16_t>(i % 150));
+  builder.add_name(name);
+  builder.add_inventory(inventory_offset);
+  builder.add_testarrayofstring(testarrayofstring);
+  builder.add_testf(static_cast<float>(i) * 0.5f);
+  builder.add_testhashu32_fnv1(static_cast<uint32_t>(i));
+  builder.add_color(static_cast<Color>(1 << (i % 3)));
+  return builder.Finish();
+}
+
+void BuildMonsters(FlatBufferBuilder& fbb, int64_t count,
+                   const BuildOptions& options = BuildOptions()) {
+  fbb.DedupVtables(options.dedup_vtables);
+  std::vector<Offset<Monster>> monsters;
+  monsters.reserve(static_cast<size_t>(count));
+  for (int64_t i = 0; i < count; ++i) {
+    monsters.push_back(BuildMonster(fbb, i, options));
+  }
+  const auto children = fbb.CreateVectorOfSortedTables(&monsters);
+  const auto name = fbb.CreateString("root");
+  MonsterBuilder builder(fbb);
+  builder.add_name(name);
+  builder.add_testarrayoftables(children);
+  FinishMonsterBuffer(fbb, builder.Finish());
+}
+
+const DetachedBuffer& MonstersBuffer(int64_t count) {
+  static DetachedBuffer buffer;
+  static int64_t built_count = -1;
+  if (built_count != count) {
+    FlatBufferBuilder fbb;
+    BuildMonsters(fbb, count);
+    buffer = fbb.Release();
+    built_count = count;
+  }
+  return buffer;
+}
+
+// Monsters with a few lines of log in their `testarrayofstring`, mostly
+// printable ASCII, with the odd character to escape.
+const DetachedBuffer& LogMonstersBuffer(int64_t count) {
+  static DetachedBuffer buffer;
+  static int64_t built_count = -1;
+  if (built_count != count) {
+    FlatBufferBuilder fbb;
+    std::vector<Offset<Monster>> monsters;
+    for (int64_t i = 0; i < count; ++i) {
+      const std::string id = std::to_string(i);
+      const Offset<String> lines[] = {
+        fbb.CreateString("2025-06-01T12:00:00.000Z INFO server: request " +
+                         id + " from 10.0.0.1 completed in 12ms, status=200"),
+        fbb.CreateString("2025-06-01T12:00:00.001Z WARN cache: key \"user/" +
+                         id + "\" expired before it was read back\t(retry)"),
+        fbb.CreateString("2025-06-01T12:00:00.002Z DEBUG db: SELECT name, "
+                         "email FROM users WHERE id = " + id + " LIMIT 1"),
+      };
+      const auto name = fbb.CreateString("monster #" + id);
+      const auto testarrayofstring = fbb.CreateVector(lines, 3);
+      MonsterBuilder builder(fbb);
+      builder.add_name(name);
+      builder.add_testarrayofstring(testarrayofstring);
+      monsters.push_back(builder.Finish());
+    }
+    const auto children = fbb.CreateVectorOfSortedTables(&monsters);
+    const auto name = fbb.CreateString("root");
+    MonsterBuilder builder(fbb);
+    builder.add_name(name);
+    builder.add_testarrayoftables(children);
+    FinishMonsterBuffer(fbb, builder.Finish());
+    buffer = fbb.Release();
+    built_count = count;
+  }
+  return buffer;
+}
+
+// A chain of monsters, each the `enemy` of the one before.
+const DetachedBuffer& DeepBuffer(int64_t depth) {
+  static DetachedBuffer buffer;
+  static int64_t built_depth = -1;
+  if (built_depth != depth) {
+    FlatBufferBuilder fbb;
+    Offset<Monster> enemy;
+    for (int64_t i = 0; i < depth; ++i) {
+      const auto name = fbb.CreateString("level " + std::to_string(i));
+      MonsterBuilder builder(fbb);
+      builder.add_name(name);
+      if (!enemy.IsNull()) builder.add_enemy(enemy);
+      enemy = builder.Finish();
+    }
+    FinishMonsterBuffer(fbb, enemy);
+    buffer = fbb.Release();
+    built_depth = depth;
+  }
+  return buffer;
+}
+
+const reflection::Schema& Schema() {
+  return *reflection::GetSchema(MonsterBinarySchema::data());
+}
+
+std::unique_ptr<Parser> NewParser() {
+  std::unique_ptr<Parser> parser(new Parser());
+  EXPECT_TRUE(parser->Deserialize(MonsterBinarySchema::data(),
+                                  MonsterBinarySchema::size()));
+  return parser;
+}
+
+// The number of monsters in the root monster's `testarrayoftables`.
+void MonsterCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(8)->Range(1, 1 << 12);
+}
+
+// The monsters with every `1000 / state.range(1)`th of them changed a little:
+// a string, an element of their inventory and their hp (which for some is
+// then added or removed, as it is or was the default, copying the monster).
+DetachedBuffer MutatedMonstersBuffer(const benchmark::State& state) {
+  BuildOptions options;
+  options.mutate_every = 1000 / state.range(1);
+  FlatBufferBuilder fbb;
+  BuildMonsters(fbb, state.range(0), options);
+  return fbb.Release();
+}
+
+// Monster counts, and the number of monsters per 1000 that changed.
+void DeltaArgs(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({ { 1 << 8, 1 << 12, 1 << 16 }, { 1, 10, 100 } });
+}
+
+// The monsters in a random order, so a scan over them jumps around the buffer,
+// as it does over tables built at different times (or in a different order).
+const DetachedBuffer& ScatteredMonstersBuffer(int64_t count) {
+  static DetachedBuffer buffer;
+  static int64_t built_count = -1;
+  if (built_count != count) {
+    FlatBufferBuilder fbb;
+    std::vector<Offset<Monster>> monsters;
+    monsters.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+      monsters.push_back(BuildMonster(fbb, i, BuildOptions()));
+    }
+    std::shuffle(monsters.begin(), monsters.end(), std::mt19937(42));
+    const auto children = fbb.CreateVector(monsters);
+    MonsterBuilder builder(fbb);
+    builder.add_testarrayoftables(children);
+    FinishMonsterBuffer(fbb, builder.Finish());
+    buffer = fbb.Release();
+    built_count = count;
+  }
+  return buffer;
+}
+
+// Up to buffers (of ~350MB) larger than the last level cache.
+void ScatteredMonsterCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+}
+
+void SetBytes(benchmark::State& state, size_t bytes) {
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+
+}  // namespace
+
+static void Build(benchmark::State& state, const BuildOptions& options) {
+  FlatBufferBuilder fbb(1 << 20);
+  for (auto _ : state) {
+    fbb.Clear();
+    BuildMonsters(fbb, state.range(0), options);
+    benchmark::DoNotOptimize(fbb.GetBufferPointer());
+  }
+  SetBytes(state, fbb.GetSize());
+  state.counters["buffer_bytes"] = static_cast<double>(fbb.GetSize());
+}
+
+static void BM_Monster_Build(benchmark::State& state) {
+  Build(state, BuildOptions());
+}
+BENCHMARK(BM_Monster_Build)->Apply(MonsterCounts);
+
+static void BM_Monster_Build_NoVTableDedup(benchmark::State& state) {
+  BuildOptions options;
+  options.dedup_vtables = false;
+  Build(state, options);
+}
+BENCHMARK(BM_Monster_Build_NoVTableDedup)->Apply(MonsterCounts);
+
+static void BM_Monster_Build_SharedStrings(benchmark::State& state) {
+  BuildOptions options;
+  options.share_strings = true;
+  Build(state, options);
+}
+BENCHMARK(BM_Monster_Build_SharedStrings)->Apply(MonsterCounts);
+
+// Builds the monsters in `state.range(1)` parts on as many threads, which
+// are spliced into one buffer. Unlike the benchmarks above, the monsters
+// aren't sorted, which would take a single thread.
+static void BM_Monster_Build_Spliced(benchmark::State& state) {
+  const int64_t count = state.range(0);
+  const int64_t threads = state.range(1);
+  std::vector<FlatBufferBuilder> parts(static_cast<size_t>(threads));
+  std::vector<std::vector<Offset<Monster>>> part_monsters(parts.size());
+  std::vector<Offset<Monster>> monsters;
+  FlatBufferBuilder fbb(1 << 20);
+  for (auto _ : state) {
+    std::vector<std::thread> workers;
+    for (int64_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&, t]() {
+        FlatBufferBuilder& part = parts[static_cast<size_t>(t)];
+        std::vector<Offset<Monster>>& offsets =
+            part_monsters[static_cast<size_t>(t)];
+        part.Clear();
+        offsets.clear();
+        for (int64_t i = count * t / threads; i < count * (t + 1) / threads;
+             ++i) {
+          offsets.push_back(BuildMonster(part, i, BuildOptions()));
+        }
+      });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    fbb.Clear();
+    monsters.clear();
+    for (size_t t = 0; t < parts.size(); ++t) {
+      const uoffset_t splice = fbb.Splice(parts[t]);
+      for (const Offset<Monster>& monster : part_monsters[t]) {
+        monsters.push_back(FlatBufferBuilder::SplicedOffset(monster, splice));
+      }
+    }
+    const auto children = fbb.CreateVector(monsters);
+    const auto name = fbb.CreateString("root");
+    MonsterBuilder builder(fbb);
+    builder.add_name(name);
+    builder.add_testarrayoftables(children);
+    FinishMonsterBuffer(fbb, builder.Finish());
+    benchmark::DoNotOptimize(fbb.GetBufferPointer());
+  }
+  SetBytes(state, fbb.GetSize());
+  Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  EXPECT_TRUE(VerifyMonsterBuffer(verifier));
+}
+BENCHMARK(BM_Monster_Build_Spliced)
+    ->ArgsProduct({ { 1 << 16 }, { 1, 2, 4, 8 } })
+    ->UseRealTime();
+
+static void BM_Monster_Verify(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  for (auto _ : state) {
+    Verifier verifier(buf.data(), buf.size());
+    benchmark::DoNotOptimize(VerifyMonsterBuffer(verifier));
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_Verify)->Apply(MonsterCounts);
+
+static void BM_Monster_Verify_Deep(benchmark::State& state) {
+  const DetachedBuffer& buf = DeepBuffer(state.range(0));
+  Verifier::Options options;
+  options.max_depth = static_cast<uoffset_t>(state.range(0) + 1);
+  for (auto _ : state) {
+    Verifier verifier(buf.data(), buf.size(), options);
+    benchmark::DoNotOptimize(VerifyMonsterBuffer(verifier));
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_Verify_Deep)->RangeMultiplier(4)->Range(4, 1 << 10);
+
+static void BM_Monster_ParseJson(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  std::unique_ptr<Parser> parser = NewParser();
+  std::string json;
+  EXPECT_EQ(GenerateText(*parser, buf.data(), &json), nullptr);
+  for (auto _ : state) {
+    // A parser only parses into an empty builder.
+    parser->builder_.Clear();
+    benchmark::DoNotOptimize(parser->ParseJson(json.c_str()));
+  }
+  EXPECT_GT(parser->builder_.GetSize(), 0u);
+  SetBytes(state, json.size());
+}
+BENCHMARK(BM_Monster_ParseJson)->Apply(MonsterCounts);
+
+static void BM_Monster_GenerateText(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  std::unique_ptr<Parser> parser = NewParser();
+  std::string json;
+  for (auto _ : state) {
+    json.clear();
+    benchmark::DoNotOptimize(GenerateText(*parser, buf.data(), &json));
+  }
+  SetBytes(state, json.size());
+}
+BENCHMARK(BM_Monster_GenerateText)->Apply(MonsterCounts);
+
+static void BM_Monster_GenerateText_Logs(benchmark::State& state) {
+  const DetachedBuffer& buf = LogMonstersBuffer(state.range(0));
+  std::unique_ptr<Parser> parser = NewParser();
+  std::string json;
+  for (auto _ : state) {
+    json.clear();
+    benchmark::DoNotOptimize(GenerateText(*parser, buf.data(), &json));
+  }
+  SetBytes(state, json.size());
+}
+BENCHMARK(BM_Monster_GenerateText_Logs)->Apply(MonsterCounts);
+
+static void BM_Monster_CopyTable(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  const reflection::Schema& schema = Schema();
+  FlatBufferBuilder fbb(buf.size());
+  for (auto _ : state) {
+    fbb.Clear();
+    fbb.Finish(CopyTable(fbb, schema, *schema.root_table(),
+                         *GetAnyRoot(buf.data())));
+    benchmark::DoNotOptimize(fbb.GetBufferPointer());
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_CopyTable)->Apply(MonsterCounts);
+
+// Growing a string moves everything after it, so the cost scales with the
+// buffer. Each iteration starts over from a copy of the original buffer.
+static void BM_Monster_SetString(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  const reflection::Schema& schema = Schema();
+  const reflection::Field& name_field =
+      *schema.root_table()->fields()->LookupByKey("name");
+  std::vector<uint8_t> flatbuf;
+  for (auto _ : state) {
+    flatbuf.assign(buf.data(), buf.data() + buf.size());
+    const String* name = GetFieldS(*GetAnyRoot(flatbuf.data()), name_field);
+    SetString(schema, "a root monster with a much longer name", name,
+              &flatbuf);
+    benchmark::DoNotOptimize(flatbuf.data());
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_SetString)->Apply(MonsterCounts);
+
+static void BM_Monster_UnPack(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  for (auto _ : state) {
+    std::unique_ptr<MonsterT> monster = UnPackMonster(buf.data());
+    benchmark::DoNotOptimize(monster.get());
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_UnPack)->Apply(MonsterCounts);
+
+static void BM_Monster_Pack(benchmark::State& state) {
+  const DetachedBuffer& buf = MonstersBuffer(state.range(0));
+  std::unique_ptr<MonsterT> monster = UnPackMonster(buf.data());
+  FlatBufferBuilder fbb(buf.size());
+  for (auto _ : state) {
+    fbb.Clear();
+    FinishMonsterBuffer(fbb, Monster::Pack(fbb, monster.get()));
+    benchmark::DoNotOptimize(fbb.GetBufferPointer());
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_Pack)->Apply(MonsterCounts);
+
+static void BM_Monster_LookupByKey(benchmark::State& state) {
+  const int64_t count = state.range(0);
+  const DetachedBuffer& buf = MonstersBuffer(count);
+  const auto* monsters = GetMonster(buf.data())->testarrayoftables();
+
+  // Look the keys up in a different order than they are stored in.
+  std::vector<std::string> keys;
+  for (int64_t i = 0; i < count; ++i) {
+    keys.push_back("monster #" + std::to_string((i * 7919) % count));
+  }
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(monsters->LookupByKey(keys[next].c_str()));
+    if (++next == keys.size()) next = 0;
+  }
+}
+BENCHMARK(BM_Monster_LookupByKey)->Apply(MonsterCounts);
+
+static void BM_Monster_Diff(benchmark::State& state) {
+  const DetachedBuffer& old_buf = MonstersBuffer(state.range(0));
+  const DetachedBuffer new_buf = MutatedMonstersBuffer(state);
+  const reflection::Schema& schema = Schema();
+  std::vector<uint8_t> delta;
+  for (auto _ : state) {
+    DiffFlatBuffers(schema, old_buf.data(), new_buf.data(), new_buf.size(),
+                    &delta);
+    benchmark::DoNotOptimize(delta.data());
+  }
+  SetBytes(state, new_buf.size());
+  state.counters["buffer_bytes"] = static_cast<double>(new_buf.size());
+  state.counters["delta_bytes"] = static_cast<double>(delta.size());
+}
+BENCHMARK(BM_Monster_Diff)->Apply(DeltaArgs);
+
+// Each iteration starts over from a copy of the old buffer, which is what
+// most of the time goes to when few monsters changed.
+static void BM_Monster_Patch(benchmark::State& state) {
+  const DetachedBuffer& old_buf = MonstersBuffer(state.range(0));
+  const DetachedBuffer new_buf = MutatedMonstersBuffer(state);
+  const reflection::Schema& schema = Schema();
+  std::vector<uint8_t> delta;
+  DiffFlatBuffers(schema, old_buf.data(), new_buf.data(), new_buf.size(),
+                  &delta);
+  std::vector<uint8_t> flatbuf;
+  for (auto _ : state) {
+    flatbuf.assign(old_buf.data(), old_buf.data() + old_buf.size());
+    benchmark::DoNotOptimize(
+        PatchFlatBuffer(schema, delta.data(), delta.size(), &flatbuf));
+  }
+  Verifier verifier(flatbuf.data(), flatbuf.size());
+  EXPECT_TRUE(VerifyMonsterBuffer(verifier));
+  SetBytes(state, new_buf.size());
+  state.counters["delta_bytes"] = static_cast<double>(delta.size());
+  state.counters["patched_bytes"] = static_cast<double>(flatbuf.size());
+}
+BENCHMARK(BM_Monster_Patch)->Apply(DeltaArgs);
+
+// Scanning monsters scattered over the buffer, with an iterator and with
+// ForEachPrefetched().
+static void BM_Monster_Scan(benchmark::State& state) {
+  const DetachedBuffer& buf = ScatteredMonstersBuffer(state.range(0));
+  const auto* monsters = GetMonster(buf.data())->testarrayoftables();
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (const Monster* monster : *monsters) {
+      sum += monster->hp() + monster->mana();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_Scan)->Apply(ScatteredMonsterCounts);
+
+static void BM_Monster_ScanPrefetched(benchmark::State& state) {
+  const DetachedBuffer& buf = ScatteredMonstersBuffer(state.range(0));
+  const auto* monsters = GetMonster(buf.data())->testarrayoftables();
+  for (auto _ : state) {
+    int64_t sum = 0;
+    ForEachPrefetched(*monsters, [&sum](uoffset_t, const Monster* monster) {
+      sum += monster->hp() + monster->mana();
+    });
+    benchmark::DoNotOptimize(sum);
+  }
+  SetBytes(state, buf.size());
+}
+BENCHMARK(BM_Monster_ScanPrefetched)->Apply(ScatteredMonsterCounts);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "benchmarks/cpp/flatbuffers/pmr_bench_generated.h"
+#include "flatbuffers/flatbuffers.h"
+
+using namespace flatbuffers;
+using namespace benchmarks_flatbuffers_pmr;
+
+namespace {
+
+// Counts the allocations that reach the upstream resource.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int64_t allocations = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+const DetachedBuffer& CollectionBuffer() {
+  static const DetachedBuffer buffer = [] {
+    FlatBufferBuilder fbb;
+    const int kEntries = 100;
+    const std::vector<std::string> tags = { "first tag of the entry",
+                                            "second tag of the entry",
+                                            "third tag of the entry" };
+    const std::vector<int32_t> values(16, 42);
+    std::vector<Offset<Entry>> entries;
+    for (int i = 0; i < kEntries; ++i) {
+      // Long enough to not fit in the small string buffer.
+      auto name = fbb.CreateString("an entry with a longish name #" +
+                                   std::to_string(i));
+      auto tag_offsets = fbb.CreateVectorOfStrings(tags);
+      Position position(1.0f * i, 2.0f * i, 3.0f * i);
+      entries.push_back(CreateEntry(fbb, name, tag_offsets, &position,
+                                    fbb.CreateVector(values)));
+    }
+    auto title = fbb.CreateString("a collection of entries");
+    fbb.Finish(CreateCollection(fbb, fbb.CreateVector(entries), title));
+    return fbb.Release();
+  }();
+  return buffer;
+}
+
+}  // namespace
+
+// Every string, vector and table is a separate heap allocation.
+static void BM_Flatbuffers_UnPack_Heap(benchmark::State& state) {
+  const uint8_t* buffer = CollectionBuffer().data();
+  CountingResource counting;
+  auto previous = std::pmr::set_default_resource(&counting);
+  for (auto _ : state) {
+    auto collection = UnPackCollection(buffer);
+    benchmark::DoNotOptimize(collection.get());
+  }
+  std::pmr::set_default_resource(previous);
+  state.counters["allocs/iter"] = benchmark::Counter(
+      static_cast<double>(counting.allocations) / state.iterations());
+}
+BENCHMARK(BM_Flatbuffers_UnPack_Heap);
+
+// The whole object tree is carved out of a reused arena and released at once.
+static void BM_Flatbuffers_UnPack_Pmr(benchmark::State& state) {
+  const uint8_t* buffer = CollectionBuffer().data();
+  CountingResource counting;
+  std::vector<char> storage(64 * 1024);
+  for (auto _ : state) {
+    std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(),
+                                              &counting);
+    auto collection = UnPackCollection(buffer, &arena);
+    benchmark::DoNotOptimize(collection.get());
+  }
+  state.counters["allocs/iter"] = benchmark::Counter(
+      static_cast<double>(counting.allocations) / state.iterations());
+}
+BENCHMARK(BM_Flatbuffers_UnPack_Pmr);
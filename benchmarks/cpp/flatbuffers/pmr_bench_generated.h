@@ -0,0 +1,496 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_PMRBENCH_BENCHMARKS_FLATBUFFERS_PMR_H_
+#define FLATBUFFERS_GENERATED_PMRBENCH_BENCHMARKS_FLATBUFFERS_PMR_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/pmr.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 19,
+             "Non-compatible flatbuffers version included");
+
+namespace benchmarks_flatbuffers_pmr {
+
+struct Position;
+
+struct Entry;
+struct EntryBuilder;
+struct EntryT;
+
+struct Collection;
+struct CollectionBuilder;
+struct CollectionT;
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Position FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  struct Traits;
+  Position()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Position(float _x, float _y, float _z)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        z_(::flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  float z() const {
+    return ::flatbuffers::EndianScalar(z_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Position, 12);
+
+struct Position::Traits {
+  using type = Position;
+};
+
+struct EntryT : public ::flatbuffers::PmrNativeTable {
+  typedef Entry TableType;
+  std::pmr::string name{};
+  std::pmr::vector<std::pmr::string> tags{};
+  ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::Position> position{};
+  std::pmr::vector<int32_t> values{};
+  EntryT() = default;
+  explicit EntryT(const allocator_type &_alloc)
+      : ::flatbuffers::PmrNativeTable(_alloc),
+        name(_alloc),
+        tags(_alloc),
+        values(_alloc) {
+  }
+  EntryT(const EntryT &o, const allocator_type &_alloc);
+  EntryT(EntryT &&o, const allocator_type &_alloc);
+  EntryT(const EntryT &o);
+  EntryT(EntryT&&) FLATBUFFERS_NOEXCEPT = default;
+  EntryT &operator=(const EntryT &o);
+  EntryT &operator=(EntryT&&) = default;
+};
+
+struct Entry FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef EntryT NativeTableType;
+  typedef EntryBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_TAGS = 6,
+    VT_POSITION = 8,
+    VT_VALUES = 10
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *tags() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_TAGS);
+  }
+  const benchmarks_flatbuffers_pmr::Position *position() const {
+    return GetStruct<const benchmarks_flatbuffers_pmr::Position *>(VT_POSITION);
+  }
+  const ::flatbuffers::Vector<int32_t> *values() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_VALUES);
+  }
+  template <bool B = false>
+  bool Verify(::flatbuffers::VerifierTemplate<B> &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyField<benchmarks_flatbuffers_pmr::Position>(verifier, VT_POSITION, 4) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           verifier.EndTable();
+  }
+  EntryT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  ::flatbuffers::pmr_unique_ptr<EntryT> UnPack(std::pmr::memory_resource *_resource, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EntryT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<Entry> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EntryBuilder {
+  typedef Entry Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(Entry::VT_NAME, name);
+  }
+  void add_tags(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Entry::VT_TAGS, tags);
+  }
+  void add_position(const benchmarks_flatbuffers_pmr::Position *position) {
+    fbb_.AddStruct(Entry::VT_POSITION, position);
+  }
+  void add_values(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> values) {
+    fbb_.AddOffset(Entry::VT_VALUES, values);
+  }
+  explicit EntryBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Entry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Entry>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Entry> CreateEntry(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> tags = 0,
+    const benchmarks_flatbuffers_pmr::Position *position = nullptr,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> values = 0) {
+  EntryBuilder builder_(_fbb);
+  builder_.add_values(values);
+  builder_.add_position(position);
+  builder_.add_tags(tags);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct Entry::Traits {
+  using type = Entry;
+  static auto constexpr Create = CreateEntry;
+};
+
+inline ::flatbuffers::Offset<Entry> CreateEntryDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *tags = nullptr,
+    const benchmarks_flatbuffers_pmr::Position *position = nullptr,
+    const std::vector<int32_t> *values = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto tags__ = tags ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*tags) : 0;
+  auto values__ = values ? _fbb.CreateVector<int32_t>(*values) : 0;
+  return benchmarks_flatbuffers_pmr::CreateEntry(
+      _fbb,
+      name__,
+      tags__,
+      position,
+      values__);
+}
+
+::flatbuffers::Offset<Entry> CreateEntry(::flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct CollectionT : public ::flatbuffers::PmrNativeTable {
+  typedef Collection TableType;
+  std::pmr::vector<::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::EntryT>> entries{};
+  std::pmr::string title{};
+  CollectionT() = default;
+  explicit CollectionT(const allocator_type &_alloc)
+      : ::flatbuffers::PmrNativeTable(_alloc),
+        entries(_alloc),
+        title(_alloc) {
+  }
+  CollectionT(const CollectionT &o, const allocator_type &_alloc);
+  CollectionT(CollectionT &&o, const allocator_type &_alloc);
+  CollectionT(const CollectionT &o);
+  CollectionT(CollectionT&&) FLATBUFFERS_NOEXCEPT = default;
+  CollectionT &operator=(const CollectionT &o);
+  CollectionT &operator=(CollectionT&&) = default;
+};
+
+struct Collection FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CollectionT NativeTableType;
+  typedef CollectionBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENTRIES = 4,
+    VT_TITLE = 6
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>> *entries() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>> *>(VT_ENTRIES);
+  }
+  const ::flatbuffers::String *title() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TITLE);
+  }
+  template <bool B = false>
+  bool Verify(::flatbuffers::VerifierTemplate<B> &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           VerifyOffset(verifier, VT_TITLE) &&
+           verifier.VerifyString(title()) &&
+           verifier.EndTable();
+  }
+  CollectionT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  ::flatbuffers::pmr_unique_ptr<CollectionT> UnPack(std::pmr::memory_resource *_resource, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CollectionT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<Collection> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CollectionT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct CollectionBuilder {
+  typedef Collection Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_entries(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>>> entries) {
+    fbb_.AddOffset(Collection::VT_ENTRIES, entries);
+  }
+  void add_title(::flatbuffers::Offset<::flatbuffers::String> title) {
+    fbb_.AddOffset(Collection::VT_TITLE, title);
+  }
+  explicit CollectionBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Collection> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Collection>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Collection> CreateCollection(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>>> entries = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> title = 0) {
+  CollectionBuilder builder_(_fbb);
+  builder_.add_title(title);
+  builder_.add_entries(entries);
+  return builder_.Finish();
+}
+
+struct Collection::Traits {
+  using type = Collection;
+  static auto constexpr Create = CreateCollection;
+};
+
+inline ::flatbuffers::Offset<Collection> CreateCollectionDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>> *entries = nullptr,
+    const char *title = nullptr) {
+  auto entries__ = entries ? _fbb.CreateVector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>>(*entries) : 0;
+  auto title__ = title ? _fbb.CreateString(title) : 0;
+  return benchmarks_flatbuffers_pmr::CreateCollection(
+      _fbb,
+      entries__,
+      title__);
+}
+
+::flatbuffers::Offset<Collection> CreateCollection(::flatbuffers::FlatBufferBuilder &_fbb, const CollectionT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline EntryT::EntryT(const EntryT &o)
+      : ::flatbuffers::PmrNativeTable(o),
+        name(o.name),
+        tags(o.tags),
+        position((o.position) ? new benchmarks_flatbuffers_pmr::Position(*o.position) : nullptr),
+        values(o.values) {
+}
+
+inline EntryT &EntryT::operator=(const EntryT &o) {
+  if (this == &o) return *this;
+  name = o.name;
+  tags = o.tags;
+  position = decltype(position)((o.position) ? new benchmarks_flatbuffers_pmr::Position(*o.position) : nullptr);
+  values = o.values;
+  return *this;
+}
+
+inline EntryT::EntryT(const EntryT &o, const allocator_type &_alloc)
+      : ::flatbuffers::PmrNativeTable(_alloc),
+        name(o.name, _alloc),
+        tags(o.tags, _alloc),
+        position((o.position) ? ::flatbuffers::pmr_make_unique<benchmarks_flatbuffers_pmr::Position>(_alloc.resource(), *o.position) : nullptr),
+        values(o.values, _alloc) {
+}
+
+inline EntryT::EntryT(EntryT &&o, const allocator_type &_alloc)
+      : ::flatbuffers::PmrNativeTable(_alloc),
+        name(std::move(o.name), _alloc),
+        tags(std::move(o.tags), _alloc),
+        position(),
+        values(std::move(o.values), _alloc) {
+  if (o.get_allocator() == _alloc) {
+    position = std::move(o.position);
+  } else {
+    position = (o.position) ? ::flatbuffers::pmr_make_unique<benchmarks_flatbuffers_pmr::Position>(_alloc.resource(), *o.position) : nullptr;
+  }
+}
+
+inline EntryT *Entry::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<EntryT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline ::flatbuffers::pmr_unique_ptr<EntryT> Entry::UnPack(std::pmr::memory_resource *_resource, const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = ::flatbuffers::pmr_make_unique<EntryT>(_resource);
+  UnPackTo(_o.get(), _resolver);
+  return _o;
+}
+
+inline void Entry::UnPackTo(EntryT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name = std::string_view(_e->c_str(), _e->size()); }
+  { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->tags[_i] = std::string_view(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->tags.resize(0); } }
+  { auto _e = position(); if (_e) _o->position = ::flatbuffers::pmr_make_unique<benchmarks_flatbuffers_pmr::Position>(_o->get_allocator().resource(), *_e); }
+  { auto _e = values(); if (_e) { _o->values.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->values.data()); } else { _o->values.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<Entry> CreateEntry(::flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return Entry::Pack(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<Entry> Entry::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const EntryT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _tags = _o->tags.size() ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>> (_o->tags.size(), [](size_t i, _VectorArgs *__va) { return __va->__fbb->CreateString(__va->__o->tags[i]); }, &_va ) : 0;
+  auto _position = _o->position ? _o->position.get() : nullptr;
+  auto _values = _o->values.size() ? _fbb.CreateVector(_o->values) : 0;
+  return benchmarks_flatbuffers_pmr::CreateEntry(
+      _fbb,
+      _name,
+      _tags,
+      _position,
+      _values);
+}
+
+inline CollectionT::CollectionT(const CollectionT &o)
+      : ::flatbuffers::PmrNativeTable(o),
+        title(o.title) {
+  entries.reserve(o.entries.size());
+  for (const auto &entries_ : o.entries) { entries.emplace_back((entries_) ? new benchmarks_flatbuffers_pmr::EntryT(*entries_) : nullptr); }
+}
+
+inline CollectionT &CollectionT::operator=(const CollectionT &o) {
+  if (this == &o) return *this;
+  entries.clear();
+  entries.reserve(o.entries.size());
+  for (const auto &entries_ : o.entries) { entries.emplace_back((entries_) ? new benchmarks_flatbuffers_pmr::EntryT(*entries_) : nullptr); }
+  title = o.title;
+  return *this;
+}
+
+inline CollectionT::CollectionT(const CollectionT &o, const allocator_type &_alloc)
+      : ::flatbuffers::PmrNativeTable(_alloc),
+        entries(_alloc),
+        title(o.title, _alloc) {
+  entries.reserve(o.entries.size());
+  for (const auto &entries_ : o.entries) { entries.emplace_back((entries_) ? ::flatbuffers::pmr_make_unique<benchmarks_flatbuffers_pmr::EntryT>(_alloc.resource(), *entries_) : nullptr); }
+}
+
+inline CollectionT::CollectionT(CollectionT &&o, const allocator_type &_alloc)
+      : ::flatbuffers::PmrNativeTable(_alloc),
+        entries(_alloc),
+        title(std::move(o.title), _alloc) {
+  if (o.get_allocator() == _alloc) {
+    entries = std::move(o.entries);
+  } else {
+    entries.reserve(o.entries.size());
+    for (const auto &entries_ : o.entries) { entries.emplace_back((entries_) ? ::flatbuffers::pmr_make_unique<benchmarks_flatbuffers_pmr::EntryT>(_alloc.resource(), *entries_) : nullptr); }
+  }
+}
+
+inline CollectionT *Collection::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<CollectionT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline ::flatbuffers::pmr_unique_ptr<CollectionT> Collection::UnPack(std::pmr::memory_resource *_resource, const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = ::flatbuffers::pmr_make_unique<CollectionT>(_resource);
+  UnPackTo(_o.get(), _resolver);
+  return _o;
+}
+
+inline void Collection::UnPackTo(CollectionT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = entries(); if (_e) { _o->entries.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->entries[_i]) { _e->Get(_i)->UnPackTo(_o->entries[_i].get(), _resolver); } else { _o->entries[_i] = _e->Get(_i)->UnPack(_o->get_allocator().resource(), _resolver); } } } else { _o->entries.resize(0); } }
+  { auto _e = title(); if (_e) _o->title = std::string_view(_e->c_str(), _e->size()); }
+}
+
+inline ::flatbuffers::Offset<Collection> CreateCollection(::flatbuffers::FlatBufferBuilder &_fbb, const CollectionT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return Collection::Pack(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<Collection> Collection::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CollectionT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CollectionT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _entries = _o->entries.size() ? _fbb.CreateVector<::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Entry>> (_o->entries.size(), [](size_t i, _VectorArgs *__va) { return benchmarks_flatbuffers_pmr::CreateEntry(*__va->__fbb, __va->__o->entries[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _title = _o->title.empty() ? 0 : _fbb.CreateString(_o->title);
+  return benchmarks_flatbuffers_pmr::CreateCollection(
+      _fbb,
+      _entries,
+      _title);
+}
+
+inline const benchmarks_flatbuffers_pmr::Collection *GetCollection(const void *buf) {
+  return ::flatbuffers::GetRoot<benchmarks_flatbuffers_pmr::Collection>(buf);
+}
+
+inline const benchmarks_flatbuffers_pmr::Collection *GetSizePrefixedCollection(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<benchmarks_flatbuffers_pmr::Collection>(buf);
+}
+
+template <bool B = false>
+inline bool VerifyCollectionBuffer(
+    ::flatbuffers::VerifierTemplate<B> &verifier) {
+  return verifier.template VerifyBuffer<benchmarks_flatbuffers_pmr::Collection>(nullptr);
+}
+
+template <bool B = false>
+inline bool VerifySizePrefixedCollectionBuffer(
+    ::flatbuffers::VerifierTemplate<B> &verifier) {
+  return verifier.template VerifySizePrefixedBuffer<benchmarks_flatbuffers_pmr::Collection>(nullptr);
+}
+
+inline void FinishCollectionBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Collection> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedCollectionBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<benchmarks_flatbuffers_pmr::Collection> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::CollectionT> UnPackCollection(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::CollectionT>(GetCollection(buf)->UnPack(res));
+}
+
+inline ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::CollectionT> UnPackSizePrefixedCollection(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::CollectionT>(GetSizePrefixedCollection(buf)->UnPack(res));
+}
+
+inline ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::CollectionT> UnPackCollection(
+    const void *buf, std::pmr::memory_resource *resource,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return GetCollection(buf)->UnPack(resource, res);
+}
+
+inline ::flatbuffers::pmr_unique_ptr<benchmarks_flatbuffers_pmr::CollectionT> UnPackSizePrefixedCollection(
+    const void *buf, std::pmr::memory_resource *resource,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return GetSizePrefixedCollection(buf)->UnPack(resource, res);
+}
+
+}  // namespace benchmarks_flatbuffers_pmr
+
+#endif  // FLATBUFFERS_GENERATED_PMRBENCH_BENCHMARKS_FLATBUFFERS_PMR_H_
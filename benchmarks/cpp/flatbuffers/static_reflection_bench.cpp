@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/minireflect.h"
+#include "flatbuffers/static_reflection.h"
+
+// The monster_test.fbs code generated with `--cpp-static-reflection`, which
+// needs C++17 code, in a namespace of its own so it doesn't clash with that of
+// monster_bench.cpp.
+namespace cpp17 {
+#include "generated_cpp17/monster_test_generated.h"
+}  // namespace cpp17
+
+using namespace flatbuffers;
+using namespace cpp17::MyGame::Example;
+
+// Benchmarks of the generic visitors of static_reflection.h against their
+// runtime counterparts of minireflect.h, over a root monster with
+// `state.range(0)` monsters in its `testarrayoftables`.
+
+namespace {
+
+const DetachedBuffer& MonstersBuffer(int64_t count) {
+  static DetachedBuffer buffer;
+  static int64_t built_count = -1;
+  if (built_count != count) {
+    FlatBufferBuilder fbb;
+    std::vector<Offset<Monster>> monsters;
+    for (int64_t i = 0; i < count; ++i) {
+      const auto name = fbb.CreateString("monster #" + std::to_string(i));
+      const Offset<String> strings[] = { fbb.CreateString("fire"),
+                                         fbb.CreateString("ice") };
+      const auto testarrayofstring = fbb.CreateVector(strings, 2);
+      uint8_t inventory[16];
+      for (uint8_t j = 0; j < 16; ++j) {
+        inventory[j] = static_cast<uint8_t>(i + j);
+      }
+      const auto inventory_offset = fbb.CreateVector(inventory, 16);
+      const Vec3 pos(static_cast<float>(i), 2.0f, 3.0f, 0.5, Color::Green,
+                     Test(10, 20));
+      MonsterBuilder builder(fbb);
+      builder.add_pos(&pos);
+      builder.add_hp(static_cast<int16_t>(i % 1000));
+      builder.add_name(name);
+      builder.add_inventory(inventory_offset);
+      builder.add_testarrayofstring(testarrayofstring);
+      builder.add_testf(static_cast<float>(i) * 0.5f);
+      builder.add_color(static_cast<Color>(1 << (i % 3)));
+      monsters.push_back(builder.Finish());
+    }
+    const auto children = fbb.CreateVectorOfSortedTables(&monsters);
+    const auto name = fbb.CreateString("root");
+    MonsterBuilder builder(fbb);
+    builder.add_name(name);
+    builder.add_testarrayoftables(children);
+    FinishMonsterBuffer(fbb, builder.Finish());
+    buffer = fbb.Release();
+    built_count = count;
+  }
+  return buffer;
+}
+
+void MonsterCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(8)->Range(1, 1 << 12);
+}
+
+}  // namespace
+
+static void BM_Monster_StaticToJson(benchmark::State& state) {
+  const Monster* monster = GetMonster(MonstersBuffer(state.range(0)).data());
+  std::string json;
+  for (auto _ : state) {
+    json.clear();
+    ToJson(*monster, &json);
+    benchmark::DoNotOptimize(json.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() *
+                                               json.size()));
+}
+BENCHMARK(BM_Monster_StaticToJson)->Apply(MonsterCounts);
+
+static void BM_Monster_FlatBufferToString(benchmark::State& state) {
+  const uint8_t* buffer = MonstersBuffer(state.range(0)).data();
+  size_t size = 0;
+  for (auto _ : state) {
+    const std::string json = FlatBufferToString(buffer, MonsterTypeTable());
+    benchmark::DoNotOptimize(json.data());
+    size = json.size();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_Monster_FlatBufferToString)->Apply(MonsterCounts);
+
+static void BM_Monster_StaticHash(benchmark::State& state) {
+  const Monster* monster = GetMonster(MonstersBuffer(state.range(0)).data());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(HashObject(*monster));
+  }
+}
+BENCHMARK(BM_Monster_StaticHash)->Apply(MonsterCounts);
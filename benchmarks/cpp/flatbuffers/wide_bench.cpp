@@ -0,0 +1,191 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmarks/cpp/flatbuffers/wide_bench_generated.h"
+#include "flatbuffers/flatbuffers.h"
+
+using namespace flatbuffers;
+using namespace benchmarks_flatbuffers;
+
+// Benchmarks over the 60 field `Wide` table of wide_bench.fbs, where the data
+// is a root table with `state.range(0)` fully populated children.
+
+namespace {
+
+// Sets all the fields of a Wide table, with values that depend on `i`.
+Offset<Wide> BuildWide(FlatBufferBuilder& fbb, int64_t i) {
+  Offset<String> strings[8];
+  for (int s = 0; s < 8; ++s) {
+    strings[s] = fbb.CreateString("string " + std::to_string(s) + " of #" +
+                                  std::to_string(i));
+  }
+  uint32_t ids[8];
+  double values[8];
+  for (int j = 0; j < 8; ++j) {
+    ids[j] = static_cast<uint32_t>(i * 8 + j);
+    values[j] = static_cast<double>(i) / (j + 1);
+  }
+  const auto ids_offset = fbb.CreateVector(ids, 8);
+  const auto values_offset = fbb.CreateVector(values, 8);
+  const auto tags = fbb.CreateVector(strings, 2);
+
+  // Let each of the children use a few vtables, as some fields would be at
+  // their defaults.
+  const int8_t v = static_cast<int8_t>(i % 4 + 1);
+  WideBuilder b(fbb);
+  b.add_f0(true);
+  b.add_f1(v);
+  b.add_f2(v);
+  b.add_f3(v);
+  b.add_f4(v);
+  b.add_f5(v);
+  b.add_f6(v);
+  b.add_f7(v);
+  b.add_f8(v);
+  b.add_f9(v);
+  b.add_f10(v);
+  b.add_f11(true);
+  b.add_f12(v);
+  b.add_f13(v);
+  b.add_f14(v);
+  b.add_f15(v);
+  b.add_f16(v);
+  b.add_f17(v);
+  b.add_f18(v);
+  b.add_f19(v);
+  b.add_f20(v);
+  b.add_f21(v);
+  b.add_f22(true);
+  b.add_f23(v);
+  b.add_f24(v);
+  b.add_f25(v);
+  b.add_f26(v);
+  b.add_f27(v);
+  b.add_f28(v);
+  b.add_f29(v);
+  b.add_f30(v);
+  b.add_f31(v);
+  b.add_f32(v);
+  b.add_f33(true);
+  b.add_f34(v);
+  b.add_f35(v);
+  b.add_f36(v);
+  b.add_f37(v);
+  b.add_f38(v);
+  b.add_f39(v);
+  b.add_f40(v);
+  b.add_f41(v);
+  b.add_f42(v);
+  b.add_f43(v);
+  b.add_f44(true);
+  b.add_f45(v);
+  b.add_f46(v);
+  b.add_f47(v);
+  b.add_s0(strings[0]);
+  b.add_s1(strings[1]);
+  b.add_s2(strings[2]);
+  b.add_s3(strings[3]);
+  b.add_s4(strings[4]);
+  b.add_s5(strings[5]);
+  b.add_s6(strings[6]);
+  b.add_s7(strings[7]);
+  b.add_ids(ids_offset);
+  b.add_values(values_offset);
+  b.add_tags(tags);
+  return b.Finish();
+}
+
+void BuildWides(FlatBufferBuilder& fbb, int64_t count, bool dedup_vtables) {
+  fbb.DedupVtables(dedup_vtables);
+  std::vector<Offset<Wide>> children;
+  children.reserve(static_cast<size_t>(count));
+  for (int64_t i = 0; i < count; ++i) children.push_back(BuildWide(fbb, i));
+  const auto children_offset = fbb.CreateVector(children);
+  WideBuilder root(fbb);
+  root.add_children(children_offset);
+  FinishWideBuffer(fbb, root.Finish());
+}
+
+const DetachedBuffer& WidesBuffer(int64_t count) {
+  static DetachedBuffer buffer;
+  static int64_t built_count = -1;
+  if (built_count != count) {
+    FlatBufferBuilder fbb;
+    BuildWides(fbb, count, true);
+    buffer = fbb.Release();
+    built_count = count;
+  }
+  return buffer;
+}
+
+// Reads all the scalars of a Wide table.
+double SumWide(const Wide& w) {
+  return w.f0() + w.f1() + w.f2() + w.f3() + w.f4() + w.f5() + w.f6() +
+         w.f7() + w.f8() + w.f9() + w.f10() + w.f11() + w.f12() + w.f13() +
+         w.f14() + w.f15() + w.f16() + w.f17() + w.f18() + w.f19() + w.f20() +
+         w.f21() + w.f22() + w.f23() + w.f24() + w.f25() + w.f26() + w.f27() +
+         w.f28() + w.f29() + w.f30() + w.f31() + w.f32() + w.f33() + w.f34() +
+         w.f35() + w.f36() + w.f37() + w.f38() + w.f39() + w.f40() + w.f41() +
+         w.f42() + w.f43() + w.f44() + w.f45() + w.f46() + w.f47();
+}
+
+void WideCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(8)->Range(1, 1 << 12);
+}
+
+}  // namespace
+
+static void BM_Wide_Build(benchmark::State& state) {
+  FlatBufferBuilder fbb(1 << 20);
+  for (auto _ : state) {
+    fbb.Clear();
+    BuildWides(fbb, state.range(0), true);
+    benchmark::DoNotOptimize(fbb.GetBufferPointer());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(fbb.GetSize()));
+  state.counters["buffer_bytes"] = static_cast<double>(fbb.GetSize());
+}
+BENCHMARK(BM_Wide_Build)->Apply(WideCounts);
+
+static void BM_Wide_Build_NoVTableDedup(benchmark::State& state) {
+  FlatBufferBuilder fbb(1 << 20);
+  for (auto _ : state) {
+    fbb.Clear();
+    BuildWides(fbb, state.range(0), false);
+    benchmark::DoNotOptimize(fbb.GetBufferPointer());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(fbb.GetSize()));
+  state.counters["buffer_bytes"] = static_cast<double>(fbb.GetSize());
+}
+BENCHMARK(BM_Wide_Build_NoVTableDedup)->Apply(WideCounts);
+
+static void BM_Wide_Read(benchmark::State& state) {
+  const DetachedBuffer& buf = WidesBuffer(state.range(0));
+  double sum = 0;
+  for (auto _ : state) {
+    sum = 0;
+    for (const Wide* child : *GetWide(buf.data())->children()) {
+      sum += SumWide(*child);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  EXPECT_GT(sum, 0);
+}
+BENCHMARK(BM_Wide_Read)->Apply(WideCounts);
+
+static void BM_Wide_Verify(benchmark::State& state) {
+  const DetachedBuffer& buf = WidesBuffer(state.range(0));
+  for (auto _ : state) {
+    Verifier verifier(buf.data(), buf.size());
+    benchmark::DoNotOptimize(VerifyWideBuffer(verifier));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_Wide_Verify)->Apply(WideCounts);
@@ -0,0 +1,839 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_WIDEBENCH_BENCHMARKS_FLATBUFFERS_H_
+#define FLATBUFFERS_GENERATED_WIDEBENCH_BENCHMARKS_FLATBUFFERS_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 19,
+             "Non-compatible flatbuffers version included");
+
+namespace benchmarks_flatbuffers {
+
+struct Wide;
+struct WideBuilder;
+
+struct Wide FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef WideBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_F0 = 4,
+    VT_F1 = 6,
+    VT_F2 = 8,
+    VT_F3 = 10,
+    VT_F4 = 12,
+    VT_F5 = 14,
+    VT_F6 = 16,
+    VT_F7 = 18,
+    VT_F8 = 20,
+    VT_F9 = 22,
+    VT_F10 = 24,
+    VT_F11 = 26,
+    VT_F12 = 28,
+    VT_F13 = 30,
+    VT_F14 = 32,
+    VT_F15 = 34,
+    VT_F16 = 36,
+    VT_F17 = 38,
+    VT_F18 = 40,
+    VT_F19 = 42,
+    VT_F20 = 44,
+    VT_F21 = 46,
+    VT_F22 = 48,
+    VT_F23 = 50,
+    VT_F24 = 52,
+    VT_F25 = 54,
+    VT_F26 = 56,
+    VT_F27 = 58,
+    VT_F28 = 60,
+    VT_F29 = 62,
+    VT_F30 = 64,
+    VT_F31 = 66,
+    VT_F32 = 68,
+    VT_F33 = 70,
+    VT_F34 = 72,
+    VT_F35 = 74,
+    VT_F36 = 76,
+    VT_F37 = 78,
+    VT_F38 = 80,
+    VT_F39 = 82,
+    VT_F40 = 84,
+    VT_F41 = 86,
+    VT_F42 = 88,
+    VT_F43 = 90,
+    VT_F44 = 92,
+    VT_F45 = 94,
+    VT_F46 = 96,
+    VT_F47 = 98,
+    VT_S0 = 100,
+    VT_S1 = 102,
+    VT_S2 = 104,
+    VT_S3 = 106,
+    VT_S4 = 108,
+    VT_S5 = 110,
+    VT_S6 = 112,
+    VT_S7 = 114,
+    VT_IDS = 116,
+    VT_VALUES = 118,
+    VT_TAGS = 120,
+    VT_CHILDREN = 122
+  };
+  bool f0() const {
+    return GetField<uint8_t>(VT_F0, 0) != 0;
+  }
+  int8_t f1() const {
+    return GetField<int8_t>(VT_F1, 0);
+  }
+  uint8_t f2() const {
+    return GetField<uint8_t>(VT_F2, 0);
+  }
+  int16_t f3() const {
+    return GetField<int16_t>(VT_F3, 0);
+  }
+  uint16_t f4() const {
+    return GetField<uint16_t>(VT_F4, 0);
+  }
+  int32_t f5() const {
+    return GetField<int32_t>(VT_F5, 0);
+  }
+  uint32_t f6() const {
+    return GetField<uint32_t>(VT_F6, 0);
+  }
+  int64_t f7() const {
+    return GetField<int64_t>(VT_F7, 0);
+  }
+  uint64_t f8() const {
+    return GetField<uint64_t>(VT_F8, 0);
+  }
+  float f9() const {
+    return GetField<float>(VT_F9, 0.0f);
+  }
+  double f10() const {
+    return GetField<double>(VT_F10, 0.0);
+  }
+  bool f11() const {
+    return GetField<uint8_t>(VT_F11, 0) != 0;
+  }
+  int8_t f12() const {
+    return GetField<int8_t>(VT_F12, 0);
+  }
+  uint8_t f13() const {
+    return GetField<uint8_t>(VT_F13, 0);
+  }
+  int16_t f14() const {
+    return GetField<int16_t>(VT_F14, 0);
+  }
+  uint16_t f15() const {
+    return GetField<uint16_t>(VT_F15, 0);
+  }
+  int32_t f16() const {
+    return GetField<int32_t>(VT_F16, 0);
+  }
+  uint32_t f17() const {
+    return GetField<uint32_t>(VT_F17, 0);
+  }
+  int64_t f18() const {
+    return GetField<int64_t>(VT_F18, 0);
+  }
+  uint64_t f19() const {
+    return GetField<uint64_t>(VT_F19, 0);
+  }
+  float f20() const {
+    return GetField<float>(VT_F20, 0.0f);
+  }
+  double f21() const {
+    return GetField<double>(VT_F21, 0.0);
+  }
+  bool f22() const {
+    return GetField<uint8_t>(VT_F22, 0) != 0;
+  }
+  int8_t f23() const {
+    return GetField<int8_t>(VT_F23, 0);
+  }
+  uint8_t f24() const {
+    return GetField<uint8_t>(VT_F24, 0);
+  }
+  int16_t f25() const {
+    return GetField<int16_t>(VT_F25, 0);
+  }
+  uint16_t f26() const {
+    return GetField<uint16_t>(VT_F26, 0);
+  }
+  int32_t f27() const {
+    return GetField<int32_t>(VT_F27, 0);
+  }
+  uint32_t f28() const {
+    return GetField<uint32_t>(VT_F28, 0);
+  }
+  int64_t f29() const {
+    return GetField<int64_t>(VT_F29, 0);
+  }
+  uint64_t f30() const {
+    return GetField<uint64_t>(VT_F30, 0);
+  }
+  float f31() const {
+    return GetField<float>(VT_F31, 0.0f);
+  }
+  double f32() const {
+    return GetField<double>(VT_F32, 0.0);
+  }
+  bool f33() const {
+    return GetField<uint8_t>(VT_F33, 0) != 0;
+  }
+  int8_t f34() const {
+    return GetField<int8_t>(VT_F34, 0);
+  }
+  uint8_t f35() const {
+    return GetField<uint8_t>(VT_F35, 0);
+  }
+  int16_t f36() const {
+    return GetField<int16_t>(VT_F36, 0);
+  }
+  uint16_t f37() const {
+    return GetField<uint16_t>(VT_F37, 0);
+  }
+  int32_t f38() const {
+    return GetField<int32_t>(VT_F38, 0);
+  }
+  uint32_t f39() const {
+    return GetField<uint32_t>(VT_F39, 0);
+  }
+  int64_t f40() const {
+    return GetField<int64_t>(VT_F40, 0);
+  }
+  uint64_t f41() const {
+    return GetField<uint64_t>(VT_F41, 0);
+  }
+  float f42() const {
+    return GetField<float>(VT_F42, 0.0f);
+  }
+  double f43() const {
+    return GetField<double>(VT_F43, 0.0);
+  }
+  bool f44() const {
+    return GetField<uint8_t>(VT_F44, 0) != 0;
+  }
+  int8_t f45() const {
+    return GetField<int8_t>(VT_F45, 0);
+  }
+  uint8_t f46() const {
+    return GetField<uint8_t>(VT_F46, 0);
+  }
+  int16_t f47() const {
+    return GetField<int16_t>(VT_F47, 0);
+  }
+  const ::flatbuffers::String *s0() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S0);
+  }
+  const ::flatbuffers::String *s1() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S1);
+  }
+  const ::flatbuffers::String *s2() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S2);
+  }
+  const ::flatbuffers::String *s3() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S3);
+  }
+  const ::flatbuffers::String *s4() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S4);
+  }
+  const ::flatbuffers::String *s5() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S5);
+  }
+  const ::flatbuffers::String *s6() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S6);
+  }
+  const ::flatbuffers::String *s7() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_S7);
+  }
+  const ::flatbuffers::Vector<uint32_t> *ids() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_IDS);
+  }
+  const ::flatbuffers::Vector<double> *values() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_VALUES);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *tags() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_TAGS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers::Wide>> *children() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers::Wide>> *>(VT_CHILDREN);
+  }
+  template <bool B = false>
+  bool Verify(::flatbuffers::VerifierTemplate<B> &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_F0, 1) &&
+           VerifyField<int8_t>(verifier, VT_F1, 1) &&
+           VerifyField<uint8_t>(verifier, VT_F2, 1) &&
+           VerifyField<int16_t>(verifier, VT_F3, 2) &&
+           VerifyField<uint16_t>(verifier, VT_F4, 2) &&
+           VerifyField<int32_t>(verifier, VT_F5, 4) &&
+           VerifyField<uint32_t>(verifier, VT_F6, 4) &&
+           VerifyField<int64_t>(verifier, VT_F7, 8) &&
+           VerifyField<uint64_t>(verifier, VT_F8, 8) &&
+           VerifyField<float>(verifier, VT_F9, 4) &&
+           VerifyField<double>(verifier, VT_F10, 8) &&
+           VerifyField<uint8_t>(verifier, VT_F11, 1) &&
+           VerifyField<int8_t>(verifier, VT_F12, 1) &&
+           VerifyField<uint8_t>(verifier, VT_F13, 1) &&
+           VerifyField<int16_t>(verifier, VT_F14, 2) &&
+           VerifyField<uint16_t>(verifier, VT_F15, 2) &&
+           VerifyField<int32_t>(verifier, VT_F16, 4) &&
+           VerifyField<uint32_t>(verifier, VT_F17, 4) &&
+           VerifyField<int64_t>(verifier, VT_F18, 8) &&
+           VerifyField<uint64_t>(verifier, VT_F19, 8) &&
+           VerifyField<float>(verifier, VT_F20, 4) &&
+           VerifyField<double>(verifier, VT_F21, 8) &&
+           VerifyField<uint8_t>(verifier, VT_F22, 1) &&
+           VerifyField<int8_t>(verifier, VT_F23, 1) &&
+           VerifyField<uint8_t>(verifier, VT_F24, 1) &&
+           VerifyField<int16_t>(verifier, VT_F25, 2) &&
+           VerifyField<uint16_t>(verifier, VT_F26, 2) &&
+           VerifyField<int32_t>(verifier, VT_F27, 4) &&
+           VerifyField<uint32_t>(verifier, VT_F28, 4) &&
+           VerifyField<int64_t>(verifier, VT_F29, 8) &&
+           VerifyField<uint64_t>(verifier, VT_F30, 8) &&
+           VerifyField<float>(verifier, VT_F31, 4) &&
+           VerifyField<double>(verifier, VT_F32, 8) &&
+           VerifyField<uint8_t>(verifier, VT_F33, 1) &&
+           VerifyField<int8_t>(verifier, VT_F34, 1) &&
+           VerifyField<uint8_t>(verifier, VT_F35, 1) &&
+           VerifyField<int16_t>(verifier, VT_F36, 2) &&
+           VerifyField<uint16_t>(verifier, VT_F37, 2) &&
+           VerifyField<int32_t>(verifier, VT_F38, 4) &&
+           VerifyField<uint32_t>(verifier, VT_F39, 4) &&
+           VerifyField<int64_t>(verifier, VT_F40, 8) &&
+           VerifyField<uint64_t>(verifier, VT_F41, 8) &&
+           VerifyField<float>(verifier, VT_F42, 4) &&
+           VerifyField<double>(verifier, VT_F43, 8) &&
+           VerifyField<uint8_t>(verifier, VT_F44, 1) &&
+           VerifyField<int8_t>(verifier, VT_F45, 1) &&
+           VerifyField<uint8_t>(verifier, VT_F46, 1) &&
+           VerifyField<int16_t>(verifier, VT_F47, 2) &&
+           VerifyOffset(verifier, VT_S0) &&
+           verifier.VerifyString(s0()) &&
+           VerifyOffset(verifier, VT_S1) &&
+           verifier.VerifyString(s1()) &&
+           VerifyOffset(verifier, VT_S2) &&
+           verifier.VerifyString(s2()) &&
+           VerifyOffset(verifier, VT_S3) &&
+           verifier.VerifyString(s3()) &&
+           VerifyOffset(verifier, VT_S4) &&
+           verifier.VerifyString(s4()) &&
+           VerifyOffset(verifier, VT_S5) &&
+           verifier.VerifyString(s5()) &&
+           VerifyOffset(verifier, VT_S6) &&
+           verifier.VerifyString(s6()) &&
+           VerifyOffset(verifier, VT_S7) &&
+           verifier.VerifyString(s7()) &&
+           VerifyOffset(verifier, VT_IDS) &&
+           verifier.VerifyVector(ids()) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyOffset(verifier, VT_CHILDREN) &&
+           verifier.VerifyVector(children()) &&
+           verifier.VerifyVectorOfTables(children()) &&
+           verifier.EndTable();
+  }
+};
+
+struct WideBuilder {
+  typedef Wide Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_f0(bool f0) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F0, static_cast<uint8_t>(f0), 0);
+  }
+  void add_f1(int8_t f1) {
+    fbb_.AddElement<int8_t>(Wide::VT_F1, f1, 0);
+  }
+  void add_f2(uint8_t f2) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F2, f2, 0);
+  }
+  void add_f3(int16_t f3) {
+    fbb_.AddElement<int16_t>(Wide::VT_F3, f3, 0);
+  }
+  void add_f4(uint16_t f4) {
+    fbb_.AddElement<uint16_t>(Wide::VT_F4, f4, 0);
+  }
+  void add_f5(int32_t f5) {
+    fbb_.AddElement<int32_t>(Wide::VT_F5, f5, 0);
+  }
+  void add_f6(uint32_t f6) {
+    fbb_.AddElement<uint32_t>(Wide::VT_F6, f6, 0);
+  }
+  void add_f7(int64_t f7) {
+    fbb_.AddElement<int64_t>(Wide::VT_F7, f7, 0);
+  }
+  void add_f8(uint64_t f8) {
+    fbb_.AddElement<uint64_t>(Wide::VT_F8, f8, 0);
+  }
+  void add_f9(float f9) {
+    fbb_.AddElement<float>(Wide::VT_F9, f9, 0.0f);
+  }
+  void add_f10(double f10) {
+    fbb_.AddElement<double>(Wide::VT_F10, f10, 0.0);
+  }
+  void add_f11(bool f11) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F11, static_cast<uint8_t>(f11), 0);
+  }
+  void add_f12(int8_t f12) {
+    fbb_.AddElement<int8_t>(Wide::VT_F12, f12, 0);
+  }
+  void add_f13(uint8_t f13) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F13, f13, 0);
+  }
+  void add_f14(int16_t f14) {
+    fbb_.AddElement<int16_t>(Wide::VT_F14, f14, 0);
+  }
+  void add_f15(uint16_t f15) {
+    fbb_.AddElement<uint16_t>(Wide::VT_F15, f15, 0);
+  }
+  void add_f16(int32_t f16) {
+    fbb_.AddElement<int32_t>(Wide::VT_F16, f16, 0);
+  }
+  void add_f17(uint32_t f17) {
+    fbb_.AddElement<uint32_t>(Wide::VT_F17, f17, 0);
+  }
+  void add_f18(int64_t f18) {
+    fbb_.AddElement<int64_t>(Wide::VT_F18, f18, 0);
+  }
+  void add_f19(uint64_t f19) {
+    fbb_.AddElement<uint64_t>(Wide::VT_F19, f19, 0);
+  }
+  void add_f20(float f20) {
+    fbb_.AddElement<float>(Wide::VT_F20, f20, 0.0f);
+  }
+  void add_f21(double f21) {
+    fbb_.AddElement<double>(Wide::VT_F21, f21, 0.0);
+  }
+  void add_f22(bool f22) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F22, static_cast<uint8_t>(f22), 0);
+  }
+  void add_f23(int8_t f23) {
+    fbb_.AddElement<int8_t>(Wide::VT_F23, f23, 0);
+  }
+  void add_f24(uint8_t f24) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F24, f24, 0);
+  }
+  void add_f25(int16_t f25) {
+    fbb_.AddElement<int16_t>(Wide::VT_F25, f25, 0);
+  }
+  void add_f26(uint16_t f26) {
+    fbb_.AddElement<uint16_t>(Wide::VT_F26, f26, 0);
+  }
+  void add_f27(int32_t f27) {
+    fbb_.AddElement<int32_t>(Wide::VT_F27, f27, 0);
+  }
+  void add_f28(uint32_t f28) {
+    fbb_.AddElement<uint32_t>(Wide::VT_F28, f28, 0);
+  }
+  void add_f29(int64_t f29) {
+    fbb_.AddElement<int64_t>(Wide::VT_F29, f29, 0);
+  }
+  void add_f30(uint64_t f30) {
+    fbb_.AddElement<uint64_t>(Wide::VT_F30, f30, 0);
+  }
+  void add_f31(float f31) {
+    fbb_.AddElement<float>(Wide::VT_F31, f31, 0.0f);
+  }
+  void add_f32(double f32) {
+    fbb_.AddElement<double>(Wide::VT_F32, f32, 0.0);
+  }
+  void add_f33(bool f33) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F33, static_cast<uint8_t>(f33), 0);
+  }
+  void add_f34(int8_t f34) {
+    fbb_.AddElement<int8_t>(Wide::VT_F34, f34, 0);
+  }
+  void add_f35(uint8_t f35) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F35, f35, 0);
+  }
+  void add_f36(int16_t f36) {
+    fbb_.AddElement<int16_t>(Wide::VT_F36, f36, 0);
+  }
+  void add_f37(uint16_t f37) {
+    fbb_.AddElement<uint16_t>(Wide::VT_F37, f37, 0);
+  }
+  void add_f38(int32_t f38) {
+    fbb_.AddElement<int32_t>(Wide::VT_F38, f38, 0);
+  }
+  void add_f39(uint32_t f39) {
+    fbb_.AddElement<uint32_t>(Wide::VT_F39, f39, 0);
+  }
+  void add_f40(int64_t f40) {
+    fbb_.AddElement<int64_t>(Wide::VT_F40, f40, 0);
+  }
+  void add_f41(uint64_t f41) {
+    fbb_.AddElement<uint64_t>(Wide::VT_F41, f41, 0);
+  }
+  void add_f42(float f42) {
+    fbb_.AddElement<float>(Wide::VT_F42, f42, 0.0f);
+  }
+  void add_f43(double f43) {
+    fbb_.AddElement<double>(Wide::VT_F43, f43, 0.0);
+  }
+  void add_f44(bool f44) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F44, static_cast<uint8_t>(f44), 0);
+  }
+  void add_f45(int8_t f45) {
+    fbb_.AddElement<int8_t>(Wide::VT_F45, f45, 0);
+  }
+  void add_f46(uint8_t f46) {
+    fbb_.AddElement<uint8_t>(Wide::VT_F46, f46, 0);
+  }
+  void add_f47(int16_t f47) {
+    fbb_.AddElement<int16_t>(Wide::VT_F47, f47, 0);
+  }
+  void add_s0(::flatbuffers::Offset<::flatbuffers::String> s0) {
+    fbb_.AddOffset(Wide::VT_S0, s0);
+  }
+  void add_s1(::flatbuffers::Offset<::flatbuffers::String> s1) {
+    fbb_.AddOffset(Wide::VT_S1, s1);
+  }
+  void add_s2(::flatbuffers::Offset<::flatbuffers::String> s2) {
+    fbb_.AddOffset(Wide::VT_S2, s2);
+  }
+  void add_s3(::flatbuffers::Offset<::flatbuffers::String> s3) {
+    fbb_.AddOffset(Wide::VT_S3, s3);
+  }
+  void add_s4(::flatbuffers::Offset<::flatbuffers::String> s4) {
+    fbb_.AddOffset(Wide::VT_S4, s4);
+  }
+  void add_s5(::flatbuffers::Offset<::flatbuffers::String> s5) {
+    fbb_.AddOffset(Wide::VT_S5, s5);
+  }
+  void add_s6(::flatbuffers::Offset<::flatbuffers::String> s6) {
+    fbb_.AddOffset(Wide::VT_S6, s6);
+  }
+  void add_s7(::flatbuffers::Offset<::flatbuffers::String> s7) {
+    fbb_.AddOffset(Wide::VT_S7, s7);
+  }
+  void add_ids(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> ids) {
+    fbb_.AddOffset(Wide::VT_IDS, ids);
+  }
+  void add_values(::flatbuffers::Offset<::flatbuffers::Vector<double>> values) {
+    fbb_.AddOffset(Wide::VT_VALUES, values);
+  }
+  void add_tags(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Wide::VT_TAGS, tags);
+  }
+  void add_children(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers::Wide>>> children) {
+    fbb_.AddOffset(Wide::VT_CHILDREN, children);
+  }
+  explicit WideBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Wide> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Wide>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Wide> CreateWide(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    bool f0 = false,
+    int8_t f1 = 0,
+    uint8_t f2 = 0,
+    int16_t f3 = 0,
+    uint16_t f4 = 0,
+    int32_t f5 = 0,
+    uint32_t f6 = 0,
+    int64_t f7 = 0,
+    uint64_t f8 = 0,
+    float f9 = 0.0f,
+    double f10 = 0.0,
+    bool f11 = false,
+    int8_t f12 = 0,
+    uint8_t f13 = 0,
+    int16_t f14 = 0,
+    uint16_t f15 = 0,
+    int32_t f16 = 0,
+    uint32_t f17 = 0,
+    int64_t f18 = 0,
+    uint64_t f19 = 0,
+    float f20 = 0.0f,
+    double f21 = 0.0,
+    bool f22 = false,
+    int8_t f23 = 0,
+    uint8_t f24 = 0,
+    int16_t f25 = 0,
+    uint16_t f26 = 0,
+    int32_t f27 = 0,
+    uint32_t f28 = 0,
+    int64_t f29 = 0,
+    uint64_t f30 = 0,
+    float f31 = 0.0f,
+    double f32 = 0.0,
+    bool f33 = false,
+    int8_t f34 = 0,
+    uint8_t f35 = 0,
+    int16_t f36 = 0,
+    uint16_t f37 = 0,
+    int32_t f38 = 0,
+    uint32_t f39 = 0,
+    int64_t f40 = 0,
+    uint64_t f41 = 0,
+    float f42 = 0.0f,
+    double f43 = 0.0,
+    bool f44 = false,
+    int8_t f45 = 0,
+    uint8_t f46 = 0,
+    int16_t f47 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s0 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s1 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s2 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s3 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s4 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s5 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s6 = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> s7 = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> ids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> values = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> tags = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<benchmarks_flatbuffers::Wide>>> children = 0) {
+  WideBuilder builder_(_fbb);
+  builder_.add_f43(f43);
+  builder_.add_f41(f41);
+  builder_.add_f40(f40);
+  builder_.add_f32(f32);
+  builder_.add_f30(f30);
+  builder_.add_f29(f29);
+  builder_.add_f21(f21);
+  builder_.add_f19(f19);
+  builder_.add_f18(f18);
+  builder_.add_f10(f10);
+  builder_.add_f8(f8);
+  builder_.add_f7(f7);
+  builder_.add_children(children);
+  builder_.add_tags(tags);
+  builder_.add_values(values);
+  builder_.add_ids(ids);
+  builder_.add_s7(s7);
+  builder_.add_s6(s6);
+  builder_.add_s5(s5);
+  builder_.add_s4(s4);
+  builder_.add_s3(s3);
+  builder_.add_s2(s2);
+  builder_.add_s1(s1);
+  builder_.add_s0(s0);
+  builder_.add_f42(f42);
+  builder_.add_f39(f39);
+  builder_.add_f38(f38);
+  builder_.add_f31(f31);
+  builder_.add_f28(f28);
+  builder_.add_f27(f27);
+  builder_.add_f20(f20);
+  builder_.add_f17(f17);
+  builder_.add_f16(f16);
+  builder_.add_f9(f9);
+  builder_.add_f6(f6);
+  builder_.add_f5(f5);
+  builder_.add_f47(f47);
+  builder_.add_f37(f37);
+  builder_.add_f36(f36);
+  builder_.add_f26(f26);
+  builder_.add_f25(f25);
+  builder_.add_f15(f15);
+  builder_.add_f14(f14);
+  builder_.add_f4(f4);
+  builder_.add_f3(f3);
+  builder_.add_f46(f46);
+  builder_.add_f45(f45);
+  builder_.add_f44(f44);
+  builder_.add_f35(f35);
+  builder_.add_f34(f34);
+  builder_.add_f33(f33);
+  builder_.add_f24(f24);
+  builder_.add_f23(f23);
+  builder_.add_f22(f22);
+  builder_.add_f13(f13);
+  builder_.add_f12(f12);
+  builder_.add_f11(f11);
+  builder_.add_f2(f2);
+  builder_.add_f1(f1);
+  builder_.add_f0(f0);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<Wide> CreateWideDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    bool f0 = false,
+    int8_t f1 = 0,
+    uint8_t f2 = 0,
+    int16_t f3 = 0,
+    uint16_t f4 = 0,
+    int32_t f5 = 0,
+    uint32_t f6 = 0,
+    int64_t f7 = 0,
+    uint64_t f8 = 0,
+    float f9 = 0.0f,
+    double f10 = 0.0,
+    bool f11 = false,
+    int8_t f12 = 0,
+    uint8_t f13 = 0,
+    int16_t f14 = 0,
+    uint16_t f15 = 0,
+    int32_t f16 = 0,
+    uint32_t f17 = 0,
+    int64_t f18 = 0,
+    uint64_t f19 = 0,
+    float f20 = 0.0f,
+    double f21 = 0.0,
+    bool f22 = false,
+    int8_t f23 = 0,
+    uint8_t f24 = 0,
+    int16_t f25 = 0,
+    uint16_t f26 = 0,
+    int32_t f27 = 0,
+    uint32_t f28 = 0,
+    int64_t f29 = 0,
+    uint64_t f30 = 0,
+    float f31 = 0.0f,
+    double f32 = 0.0,
+    bool f33 = false,
+    int8_t f34 = 0,
+    uint8_t f35 = 0,
+    int16_t f36 = 0,
+    uint16_t f37 = 0,
+    int32_t f38 = 0,
+    uint32_t f39 = 0,
+    int64_t f40 = 0,
+    uint64_t f41 = 0,
+    float f42 = 0.0f,
+    double f43 = 0.0,
+    bool f44 = false,
+    int8_t f45 = 0,
+    uint8_t f46 = 0,
+    int16_t f47 = 0,
+    const char *s0 = nullptr,
+    const char *s1 = nullptr,
+    const char *s2 = nullptr,
+    const char *s3 = nullptr,
+    const char *s4 = nullptr,
+    const char *s5 = nullptr,
+    const char *s6 = nullptr,
+    const char *s7 = nullptr,
+    const std::vector<uint32_t> *ids = nullptr,
+    const std::vector<double> *values = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *tags = nullptr,
+    const std::vector<::flatbuffers::Offset<benchmarks_flatbuffers::Wide>> *children = nullptr) {
+  auto s0__ = s0 ? _fbb.CreateString(s0) : 0;
+  auto s1__ = s1 ? _fbb.CreateString(s1) : 0;
+  auto s2__ = s2 ? _fbb.CreateString(s2) : 0;
+  auto s3__ = s3 ? _fbb.CreateString(s3) : 0;
+  auto s4__ = s4 ? _fbb.CreateString(s4) : 0;
+  auto s5__ = s5 ? _fbb.CreateString(s5) : 0;
+  auto s6__ = s6 ? _fbb.CreateString(s6) : 0;
+  auto s7__ = s7 ? _fbb.CreateString(s7) : 0;
+  auto ids__ = ids ? _fbb.CreateVector<uint32_t>(*ids) : 0;
+  auto values__ = values ? _fbb.CreateVector<double>(*values) : 0;
+  auto tags__ = tags ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*tags) : 0;
+  auto children__ = children ? _fbb.CreateVector<::flatbuffers::Offset<benchmarks_flatbuffers::Wide>>(*children) : 0;
+  return benchmarks_flatbuffers::CreateWide(
+      _fbb,
+      f0,
+      f1,
+      f2,
+      f3,
+      f4,
+      f5,
+      f6,
+      f7,
+      f8,
+      f9,
+      f10,
+      f11,
+      f12,
+      f13,
+      f14,
+      f15,
+      f16,
+      f17,
+      f18,
+      f19,
+      f20,
+      f21,
+      f22,
+      f23,
+      f24,
+      f25,
+      f26,
+      f27,
+      f28,
+      f29,
+      f30,
+      f31,
+      f32,
+      f33,
+      f34,
+      f35,
+      f36,
+      f37,
+      f38,
+      f39,
+      f40,
+      f41,
+      f42,
+      f43,
+      f44,
+      f45,
+      f46,
+      f47,
+      s0__,
+      s1__,
+      s2__,
+      s3__,
+      s4__,
+      s5__,
+      s6__,
+      s7__,
+      ids__,
+      values__,
+      tags__,
+      children__);
+}
+
+inline const benchmarks_flatbuffers::Wide *GetWide(const void *buf) {
+  return ::flatbuffers::GetRoot<benchmarks_flatbuffers::Wide>(buf);
+}
+
+inline const benchmarks_flatbuffers::Wide *GetSizePrefixedWide(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<benchmarks_flatbuffers::Wide>(buf);
+}
+
+template <bool B = false>
+inline bool VerifyWideBuffer(
+    ::flatbuffers::VerifierTemplate<B> &verifier) {
+  return verifier.template VerifyBuffer<benchmarks_flatbuffers::Wide>(nullptr);
+}
+
+template <bool B = false>
+inline bool VerifySizePrefixedWideBuffer(
+    ::flatbuffers::VerifierTemplate<B> &verifier) {
+  return verifier.template VerifySizePrefixedBuffer<benchmarks_flatbuffers::Wide>(nullptr);
+}
+
+inline void FinishWideBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<benchmarks_flatbuffers::Wide> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedWideBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<benchmarks_flatbuffers::Wide> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace benchmarks_flatbuffers
+
+#endif  // FLATBUFFERS_GENERATED_WIDEBENCH_BENCHMARKS_FLATBUFFERS_H_
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flex_json.h"
+#include "flatbuffers/flexbuffers.h"
+#include "flatbuffers/idl.h"
+
+// Benchmarks building, reading and verifying a vector of `state.range(0)`
+// maps, each a record with a few scalars, strings and a typed vector.
+
+namespace {
+
+void BuildRecords(flexbuffers::Builder& fbb, int64_t records) {
+  fbb.Vector([&]() {
+    for (int64_t i = 0; i < records; ++i) {
+      fbb.Map([&]() {
+        fbb.Int("id", i);
+        fbb.String("name", "record #" + std::to_string(i));
+        fbb.String("kind", i % 2 ? "odd" : "even");
+        fbb.Double("score", static_cast<double>(i) * 0.25);
+        fbb.Bool("active", i % 3 == 0);
+        fbb.TypedVector("values", [&]() {
+          for (int j = 0; j < 8; ++j) fbb.Int(i * j);
+        });
+      });
+    }
+  });
+  fbb.Finish();
+}
+
+const std::vector<uint8_t>& RecordsBuffer(int64_t records) {
+  static std::vector<uint8_t> buffer;
+  static int64_t built_records = -1;
+  if (built_records != records) {
+    flexbuffers::Builder fbb;
+    BuildRecords(fbb, records);
+    buffer = fbb.GetBuffer();
+    built_records = records;
+  }
+  return buffer;
+}
+
+// The records as JSON, with the keys quoted.
+const std::string& RecordsJson(int64_t records) {
+  static std::string json;
+  static int64_t built_records = -1;
+  if (built_records != records) {
+    json.clear();
+    flexbuffers::GetRoot(RecordsBuffer(records)).ToString(true, true, json);
+    built_records = records;
+  }
+  return json;
+}
+
+void RecordCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(8)->Range(1, 1 << 12);
+}
+
+// The number of elements of the typed vectors built on their own.
+void ElementCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+}
+
+}  // namespace
+
+static void BM_FlexBuffers_Build(benchmark::State& state) {
+  flexbuffers::Builder fbb(1 << 20);
+  for (auto _ : state) {
+    fbb.Clear();
+    BuildRecords(fbb, state.range(0));
+    benchmark::DoNotOptimize(fbb.GetSize());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(fbb.GetSize()));
+}
+BENCHMARK(BM_FlexBuffers_Build)->Apply(RecordCounts);
+
+static void BM_FlexBuffers_Build_ShareKeysAndStrings(benchmark::State& state) {
+  flexbuffers::Builder fbb(1 << 20, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+  for (auto _ : state) {
+    fbb.Clear();
+    BuildRecords(fbb, state.range(0));
+    benchmark::DoNotOptimize(fbb.GetSize());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(fbb.GetSize()));
+}
+BENCHMARK(BM_FlexBuffers_Build_ShareKeysAndStrings)->Apply(RecordCounts);
+
+static void BM_FlexBuffers_Read(benchmark::State& state) {
+  const std::vector<uint8_t>& buf = RecordsBuffer(state.range(0));
+  int64_t sum = 0;
+  for (auto _ : state) {
+    sum = 0;
+    const auto records = flexbuffers::GetRoot(buf).AsVector();
+    for (size_t i = 0; i < records.size(); ++i) {
+      const auto record = records[i].AsMap();
+      sum += record["id"].AsInt64();
+      sum += static_cast<int64_t>(record["name"].AsString().length());
+      sum += record["active"].AsBool();
+      const auto values = record["values"].AsTypedVector();
+      for (size_t j = 0; j < values.size(); ++j) sum += values[j].AsInt64();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  EXPECT_GT(sum, 0);
+}
+BENCHMARK(BM_FlexBuffers_Read)->Apply(RecordCounts);
+
+static void BM_FlexBuffers_Verify(benchmark::State& state) {
+  const std::vector<uint8_t>& buf = RecordsBuffer(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(flexbuffers::VerifyBuffer(buf.data(), buf.size()));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_FlexBuffers_Verify)->Apply(RecordCounts);
+
+static void BM_FlexBuffers_ParseJson(benchmark::State& state) {
+  const std::string& json = RecordsJson(state.range(0));
+  flexbuffers::Builder fbb(1 << 20);
+  flatbuffers::Parser parser;
+  for (auto _ : state) {
+    fbb.Clear();
+    EXPECT_TRUE(parser.ParseFlexBuffer(json.c_str(), nullptr, &fbb));
+    benchmark::DoNotOptimize(fbb.GetSize());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(json.size()));
+}
+BENCHMARK(BM_FlexBuffers_ParseJson)->Apply(RecordCounts);
+
+static void BM_FlexBuffers_JsonParser(benchmark::State& state) {
+  const std::string& json = RecordsJson(state.range(0));
+  flexbuffers::Builder fbb(1 << 20);
+  flexbuffers::JsonParser parser;
+  for (auto _ : state) {
+    fbb.Clear();
+    EXPECT_TRUE(parser.Parse(json.data(), json.size(), &fbb));
+    benchmark::DoNotOptimize(fbb.GetSize());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(json.size()));
+}
+BENCHMARK(BM_FlexBuffers_JsonParser)->Apply(RecordCounts);
+
+static void BM_FlexBuffers_BuildTypedVector(benchmark::State& state) {
+  const int64_t count = state.range(0);
+  flexbuffers::Builder fbb(static_cast<size_t>(count) * 4 + 64);
+  for (auto _ : state) {
+    fbb.Clear();
+    fbb.TypedVector([&]() {
+      for (int64_t i = 0; i < count; ++i) fbb.Int(i & 0x7FFFFFFF);
+    });
+    fbb.Finish();
+    benchmark::DoNotOptimize(fbb.GetSize());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlexBuffers_BuildTypedVector)->Apply(ElementCounts);
+
+static void BM_FlexBuffers_BuildStreamedVector(benchmark::State& state) {
+  const int64_t count = state.range(0);
+  flexbuffers::Builder fbb(static_cast<size_t>(count) * 4 + 64);
+  for (auto _ : state) {
+    fbb.Clear();
+    const size_t start = fbb.StartStreamedVector<int64_t>(
+        static_cast<size_t>(count), flexbuffers::BIT_WIDTH_32);
+    for (int64_t i = 0; i < count; ++i) fbb.StreamedElement(i & 0x7FFFFFFF);
+    fbb.EndStreamedVector(start);
+    fbb.Finish();
+    benchmark::DoNotOptimize(fbb.GetSize());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlexBuffers_BuildStreamedVector)->Apply(ElementCounts);
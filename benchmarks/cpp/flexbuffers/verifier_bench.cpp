@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+
+namespace {
+
+// A large buffer of records that share their keys and some strings, which is
+// what the reuse trackers are for.
+const std::vector<uint8_t>& SharedBuffer(int64_t records) {
+  static std::vector<uint8_t> buffer;
+  static int64_t built_records = 0;
+  if (built_records != records) {
+    flexbuffers::Builder fbb(1024, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+    fbb.Vector([&]() {
+      for (int64_t i = 0; i < records; ++i) {
+        fbb.Map([&]() {
+          fbb.String("kind", "a string shared by all records");
+          fbb.String("name", "record #" + std::to_string(i));
+          fbb.Int("id", i);
+          fbb.Vector("values", [&]() {
+            for (int j = 0; j < 8; ++j) fbb.Int(i * j);
+          });
+        });
+      }
+    });
+    fbb.Finish();
+    buffer = fbb.GetBuffer();
+    built_records = records;
+  }
+  return buffer;
+}
+
+}  // namespace
+
+static void BM_FlexBuffers_Verify_NoTracker(benchmark::State& state) {
+  const auto& buf = SharedBuffer(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(flexbuffers::VerifyBuffer(buf.data(), buf.size()));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_FlexBuffers_Verify_NoTracker)->Range(1 << 10, 1 << 18);
+
+static void BM_FlexBuffers_Verify_DenseTracker(benchmark::State& state) {
+  const auto& buf = SharedBuffer(state.range(0));
+  std::vector<uint8_t> tracker;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        flexbuffers::VerifyBuffer(buf.data(), buf.size(), &tracker));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(buf.size()));
+  state.counters["tracker_bytes"] = static_cast<double>(tracker.capacity());
+}
+BENCHMARK(BM_FlexBuffers_Verify_DenseTracker)->Range(1 << 10, 1 << 18);
+
+static void BM_FlexBuffers_Verify_ReuseTracker(benchmark::State& state) {
+  const auto& buf = SharedBuffer(state.range(0));
+  flexbuffers::ReuseTracker tracker;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        flexbuffers::VerifyBuffer(buf.data(), buf.size(), tracker));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(buf.size()));
+  state.counters["tracker_bytes"] =
+      static_cast<double>(tracker.memory_usage());
+}
+BENCHMARK(BM_FlexBuffers_Verify_ReuseTracker)->Range(1 << 10, 1 << 18);
@@ -137,6 +137,21 @@ void RetrieveRPC(MonsterStorage::Stub* stub) {
   }
 }
 
+// A message large enough for gRPC to deliver it in several slices.
+void LargeStoreRPC(MonsterStorage::Stub* stub) {
+  const std::string name(1 << 20, 'x');
+  MessageBuilder mb;
+  mb.Finish(CreateMonster(mb, 0, 0, 0, mb.CreateString(name)));
+  auto request = mb.ReleaseMessage<Monster>();
+  flatbuffers::grpc::Message<Stat> response;
+
+  grpc::ClientContext context;
+  auto status = stub->Store(&context, request, &response);
+  TEST_ASSERT(status.ok());
+  TEST_ASSERT(response.Verify());
+  TEST_EQ(response.GetRoot()->id()->str(), "Hello, " + name);
+}
+
 int grpc_server_test() {
   // Launch server.
   std::thread server_thread(RunServer);
@@ -156,6 +171,14 @@ int grpc_server_test() {
   RetrieveRPC<MessageBuilder>(stub.get());
   RetrieveRPC<FlatBufferBuilder>(stub.get());
 
+  LargeStoreRPC(stub.get());
+  // Again over an in-process channel.
+  grpc::ChannelArguments args;
+  LargeStoreRPC(
+      MyGame::Example::MonsterStorage::NewStub(
+          server_instance->InProcessChannel(args))
+          .get());
+
 #if !FLATBUFFERS_GRPC_DISABLE_AUTO_VERIFICATION
   {
     // Test that an invalid request errors out correctly
@@ -202,6 +202,94 @@ void slice_allocator_tests() {
   }
 }
 
+void multi_slice_deserialize_test() {
+  flatbuffers::grpc::MessageBuilder mb;
+  mb.Finish(populate1(mb));
+  auto whole = mb.ReleaseMessage<Monster>();
+
+  // Split the message into three slices, as gRPC may hand it over.
+  const size_t third = whole.size() / 3;
+  std::vector<::grpc::Slice> slices;
+  slices.emplace_back(whole.data(), third);
+  slices.emplace_back(whole.data() + third, third);
+  slices.emplace_back(whole.data() + 2 * third, whole.size() - 2 * third);
+
+  const uint8_t* first_data = nullptr;
+  for (int i = 0; i < 2; ++i) {
+    ::grpc::ByteBuffer buffer(slices.data(), slices.size());
+    flatbuffers::grpc::Message<Monster> msg;
+    auto status =
+        ::grpc::SerializationTraits<flatbuffers::grpc::Message<Monster>>::
+            Deserialize(&buffer, &msg);
+    TEST_ASSERT_FUNC(status.ok());
+    TEST_EQ_FUNC(msg.size(), whole.size());
+    TEST_ASSERT_FUNC(msg.Verify());
+    TEST_ASSERT_FUNC(verify(msg, m1_name(), m1_color()));
+    // The reassembly buffer is recycled by the second message.
+    if (i == 0) first_data = msg.data();
+    if (i == 1) TEST_ASSERT_FUNC(msg.data() == first_data);
+  }
+}
+
+void message_buffer_pool_tests() {
+  flatbuffers::grpc::MessageBufferPool pool(1);
+  const uint8_t* kept;
+  {
+    ::grpc::Slice a = pool.Allocate(100);
+    ::grpc::Slice b = pool.Allocate(100);
+    kept = b.begin();  // Released first.
+    TEST_EQ_FUNC(a.size(), 100);
+    TEST_ASSERT_FUNC(a.begin() != b.begin());
+    TEST_EQ_FUNC(pool.free_buffers(), 0);
+  }
+  // Only one buffer is kept.
+  TEST_EQ_FUNC(pool.free_buffers(), 1);
+
+  // A smaller request reuses it, a larger one doesn't.
+  {
+    ::grpc::Slice c = pool.Allocate(50);
+    TEST_ASSERT_FUNC(c.begin() == kept);
+    TEST_EQ_FUNC(c.size(), 50);
+    TEST_EQ_FUNC(pool.free_buffers(), 0);
+    ::grpc::Slice d = pool.Allocate(200);
+    TEST_EQ_FUNC(d.size(), 200);
+  }
+
+  // A request gets the smallest buffer that fits.
+  flatbuffers::grpc::MessageBufferPool sized(4, 1000);
+  const uint8_t* small;
+  {
+    ::grpc::Slice a = sized.Allocate(200);
+    ::grpc::Slice b = sized.Allocate(100);
+    ::grpc::Slice c = sized.Allocate(400);  // Released first.
+    small = a.begin();
+  }
+  TEST_EQ_FUNC(sized.free_buffers(), 3);
+  TEST_EQ_FUNC(sized.free_bytes(), 700);
+  {
+    ::grpc::Slice e = sized.Allocate(150);
+    TEST_ASSERT_FUNC(e.begin() == small);
+    TEST_EQ_FUNC(sized.free_bytes(), 500);
+    // Buffers that would take the free ones over 1000 bytes are freed.
+    ::grpc::Slice f = sized.Allocate(600);
+  }
+  TEST_EQ_FUNC(sized.free_buffers(), 3);
+  TEST_EQ_FUNC(sized.free_bytes(), 700);
+
+  // Lowering the limit frees the largest buffers.
+  sized.set_max_free_bytes(350);
+  TEST_EQ_FUNC(sized.free_buffers(), 2);
+  TEST_EQ_FUNC(sized.free_bytes(), 300);
+
+  // Slices may outlive their pool.
+  ::grpc::Slice outliving;
+  {
+    flatbuffers::grpc::MessageBufferPool short_lived;
+    outliving = short_lived.Allocate(10);
+  }
+  memset(const_cast<uint8_t*>(outliving.begin()), 0, outliving.size());
+}
+
 /// This function does not populate exactly the first half of the table. But it
 /// could.
 void populate_first_half(MyGame::Example::MonsterBuilder& wrapper,
@@ -346,6 +434,8 @@ void message_builder_tests() {
   using flatbuffers::grpc::MessageBuilder;
 
   slice_allocator_tests();
+  message_buffer_pool_tests();
+  multi_slice_deserialize_test();
 
 #ifndef __APPLE__
   builder_move_ctor_conversion_before_finish_half_n_half_table_test();
@@ -316,6 +316,24 @@ namespace flatbuffers {
   #endif
 #endif
 
+// Asks the processor to fetch the memory at `addr` into the cache, for loops
+// that know which (scattered) memory they'll read next.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+  #define FLATBUFFERS_PREFETCH(addr) ((void)(addr))
+#endif
+
+// Keeps a rarely taken path out of line, so the function calling it stays
+// small enough to be inlined.
+#if defined(_MSC_VER)
+  #define FLATBUFFERS_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_NOINLINE __attribute__((noinline))
+#else
+  #define FLATBUFFERS_NOINLINE
+#endif
+
 /// @endcond
 
 /// @file
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_BUILDER_STATS_H_
+#define FLATBUFFERS_BUILDER_STATS_H_
+
+#include "flatbuffers/base.h"
+
+// Defining FLATBUFFERS_BUILDER_STATS makes FlatBufferBuilder and
+// flexbuffers::Builder count how much work they do (see BuilderStats below),
+// and adds GetStats() and ResetStats() to them. Without it the counters and
+// the code updating them don't exist, so they cost nothing.
+// As this changes the layout of the builders, it has to be defined the same
+// way for the whole program (e.g. with the FLATBUFFERS_BUILDER_STATS CMake
+// option), just like the other build configuration macros.
+#ifdef FLATBUFFERS_BUILDER_STATS
+  #define FLATBUFFERS_BUILDER_STAT(...) __VA_ARGS__
+#else
+  #define FLATBUFFERS_BUILDER_STAT(...)
+#endif
+
+namespace flatbuffers {
+
+// Counters a builder keeps when FLATBUFFERS_BUILDER_STATS is defined. They
+// accumulate over all the buffers built until ResetStats() is called, so call
+// that before building a message to get the numbers for that message alone.
+struct BuilderStats {
+  // The number of times the buffer was grown, and the bytes that were copied
+  // to the new allocation because of it.
+  size_t reallocations;
+  size_t bytes_copied;
+  // The high-water mark of the temporary data kept while building, in bytes:
+  // the scratch-pad of a FlatBufferBuilder, the value stack of a
+  // flexbuffers::Builder.
+  size_t max_scratch_size;
+  // The number of tables that reused an identical vtable.
+  size_t vtable_dedup_hits;
+  // The number of strings (CreateSharedString(), or flexbuffers with
+  // BUILDER_FLAG_SHARE_STRINGS) and flexbuffers map keys that reused an
+  // identical one already in the buffer.
+  size_t shared_string_hits;
+  size_t shared_key_hits;
+  // The bytes of padding inserted to align values.
+  size_t padding_bytes;
+
+  BuilderStats() { Reset(); }
+
+  void Reset() {
+    reallocations = 0;
+    bytes_copied = 0;
+    max_scratch_size = 0;
+    vtable_dedup_hits = 0;
+    shared_string_hits = 0;
+    shared_key_hits = 0;
+    padding_bytes = 0;
+  }
+
+  // Calls `f(name, value)` for every counter, with `name` a const char *
+  // and `value` a size_t, e.g. to export them to a metrics system.
+  template <typename F>
+  void ForEach(F f) const {
+    f("reallocations", reallocations);
+    f("bytes_copied", bytes_copied);
+    f("max_scratch_size", max_scratch_size);
+    f("vtable_dedup_hits", vtable_dedup_hits);
+    f("shared_string_hits", shared_string_hits);
+    f("shared_key_hits", shared_key_hits);
+    f("padding_bytes", padding_bytes);
+  }
+
+  /// @cond FLATBUFFERS_INTERNAL
+  void AddReallocation(size_t copied) {
+    reallocations++;
+    bytes_copied += copied;
+  }
+
+  void TrackScratchSize(size_t size) {
+    if (size > max_scratch_size) max_scratch_size = size;
+  }
+  /// @endcond
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_BUILDER_STATS_H_
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_DELTA_H_
+#define FLATBUFFERS_DELTA_H_
+
+#include <vector>
+
+#include "flatbuffers/reflection.h"
+
+// Deltas describe the changes between two FlatBuffers of the same schema, so
+// that a buffer that changes a little at a time (e.g. replicated state) can be
+// shipped as its changes instead of as a whole.
+//
+// A delta is a tree following the tables and vectors that changed, addressing
+// fields by their index in the schema and elements by their index, so it
+// doesn't depend on where things are stored in the buffer. Patching applies it
+// in place, with the same means as the mutation functions of reflection.h:
+//
+//  - Scalars and structs are overwritten.
+//  - Vectors are resized (see ResizeAnyVector()), and their changed elements
+//    overwritten or patched.
+//  - Changed strings, and tables that can't be patched, are appended to the
+//    buffer (see AddFlatBuffer()) and the offsets to them updated. The bytes
+//    they replace are left in the buffer, unused; CopyTable() removes them.
+//
+// Tables can only be patched if the same fields are present in the old and
+// the new version, as adding a field to a table in place isn't possible. If
+// that isn't the case, the delta holds a copy of the new table, or of the new
+// buffer for the root table.
+//
+// Patching preserves which fields are present, so a delta can be applied to
+// any buffer with the same contents as the one it was computed from, e.g. one
+// that was patched by earlier deltas. Like CopyTable(), it doesn't deal with
+// DAGs: strings or tables referred to from several places are changed for all
+// of them.
+
+namespace flatbuffers {
+
+// Computes the delta that turns `old_buf` into `new_buf` (of `new_size`
+// bytes), both FlatBuffers with the schema's root table (or `root_table`),
+// and stores it in `delta`. Both buffers must have been verified. Vectors of
+// unions aren't patched, if they changed their table is copied.
+void DiffFlatBuffers(const reflection::Schema& schema, const uint8_t* old_buf,
+                     const uint8_t* new_buf, size_t new_size,
+                     std::vector<uint8_t>* delta,
+                     const reflection::Object* root_table = nullptr);
+
+// Applies `delta`, as computed by DiffFlatBuffers() with the same schema, to
+// `flatbuf`, which must have the same contents as the old buffer. Returns
+// false if the delta doesn't fit `flatbuf`, which may then be partially
+// patched.
+bool PatchFlatBuffer(const reflection::Schema& schema, const uint8_t* delta,
+                     size_t delta_size, std::vector<uint8_t>* flatbuf,
+                     const reflection::Object* root_table = nullptr);
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_DELTA_H_
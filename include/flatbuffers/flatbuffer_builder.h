@@ -50,6 +50,29 @@ inline voffset_t FieldIndexToOffset(voffset_t field_id) {
   return static_cast<voffset_t>(offset);
 }
 
+// Upper bounds of the number of bytes serializing an object takes, including
+// alignment padding and builder scratch space. These are used by the generated
+// `PackedSizeUpperBound()` functions (see `--gen-packed-size`).
+inline size_t PackedStringSizeUpperBound(size_t len) {
+  // Matches what CreateString() reserves: terminator, length and padding.
+  return len + 1 + 2 * sizeof(uoffset_t);
+}
+
+inline size_t PackedVectorSizeUpperBound(size_t len, size_t elem_size,
+                                         size_t alignment) {
+  // Covers both the 32-bit and 64-bit length prefix and its padding.
+  return len * elem_size + 2 * alignment + 2 * sizeof(uoffset64_t);
+}
+
+inline size_t PackedTableSizeUpperBound(size_t num_fields,
+                                        size_t fields_size) {
+  return fields_size +
+         // The offset to the vtable, padding, and the vtable itself.
+         2 * sizeof(soffset_t) + (num_fields + 2) * sizeof(voffset_t) +
+         // Scratch space for the field locations and the vtable offset.
+         num_fields * 2 * sizeof(uoffset_t) + sizeof(uoffset_t);
+}
+
 template <typename T, typename Alloc = std::allocator<T>>
 const T* data(const std::vector<T, Alloc>& v) {
   // Eventually the returned pointer gets passed down to memcpy, so
@@ -108,10 +131,66 @@ class FlatBufferBuilderImpl {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
-        string_pool(nullptr) {
+        string_pool(nullptr),
+        fixed_string_pool_(),
+        static_vtables_(),
+        nested_buffer_start_(0) {
     EndianCheck();
   }
 
+  /// @brief Constructor for a fixed-capacity FlatBufferBuilder, which builds
+  /// into `buffer` and never allocates memory: its temporary data (the field
+  /// locations and vtable offsets of the tables being built, and the string
+  /// pool of `CreateSharedString()`) are kept in `buffer` as well.
+  /// Instead of growing, it stops storing anything once `buffer` is full and
+  /// `HasOverflowed()` returns true until `Clear()` is called, so the message
+  /// can be dropped or built again in a larger buffer.
+  /// The `CreateVector()` overloads taking a function to produce the elements
+  /// do allocate, and can't be used with such a builder.
+  /// @param[in] buffer The memory to build into, which remains owned by the
+  /// caller and must outlive the builder. The finished FlatBuffer ends at the
+  /// (aligned) end of `buffer`.
+  /// @param[in] max_shared_strings How many different strings
+  /// `CreateSharedString()` remembers to share, beyond that it just creates
+  /// them. Its table takes 8 bytes per string from the start of `buffer`.
+  explicit FlatBufferBuilderImpl(flatbuffers::span<uint8_t> buffer,
+                                 size_t max_shared_strings = 0)
+      : buf_(0, nullptr, false, AlignOf<largest_scalar_t>(),
+             static_cast<SizeT>(Is64Aware ? FLATBUFFERS_MAX_64_BUFFER_SIZE
+                                          : FLATBUFFERS_MAX_BUFFER_SIZE)),
+        num_field_loc(0),
+        max_voffset_(0),
+        length_of_64_bit_region_(0),
+        nested(false),
+        finished(false),
+        minalign_(1),
+        force_defaults_(false),
+        dedup_vtables_(true),
+        string_pool(nullptr),
+        fixed_string_pool_(),
+        static_vtables_(),
+        nested_buffer_start_(0) {
+    EndianCheck();
+    uint8_t* data = buffer.data();
+    size_t size = buffer.size();
+    if (max_shared_strings) {
+      // Keep the table at most half full, so probing stays short.
+      size_t capacity = 1;
+      while (capacity < 2 * max_shared_strings) capacity *= 2;
+      const size_t padding =
+          PaddingBytes(reinterpret_cast<size_t>(data), sizeof(uoffset_t));
+      const size_t table_size = padding + capacity * sizeof(uoffset_t);
+      if (table_size <= size) {
+        fixed_string_pool_.slots = reinterpret_cast<uoffset_t*>(data + padding);
+        fixed_string_pool_.capacity = capacity;
+        memset(fixed_string_pool_.slots, 0, capacity * sizeof(uoffset_t));
+        data += table_size;
+        size -= table_size;
+      }
+    }
+    buf_.set_fixed_buffer(data, size);
+  }
+
   /// @brief Move constructor for FlatBufferBuilder.
   FlatBufferBuilderImpl(FlatBufferBuilderImpl&& other) noexcept
       : buf_(1024, nullptr, false, AlignOf<largest_scalar_t>(),
@@ -125,7 +204,10 @@ class FlatBufferBuilderImpl {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
-        string_pool(nullptr) {
+        string_pool(nullptr),
+        fixed_string_pool_(),
+        static_vtables_(),
+        nested_buffer_start_(0) {
     EndianCheck();
     // Default construct and swap idiom.
     // Lack of delegating constructors in vs2010 makes it more verbose than
@@ -153,6 +235,9 @@ class FlatBufferBuilderImpl {
     swap(force_defaults_, other.force_defaults_);
     swap(dedup_vtables_, other.dedup_vtables_);
     swap(string_pool, other.string_pool);
+    swap(fixed_string_pool_, other.fixed_string_pool_);
+    swap(static_vtables_, other.static_vtables_);
+    swap(nested_buffer_start_, other.nested_buffer_start_);
   }
 
   ~FlatBufferBuilderImpl() {
@@ -174,12 +259,40 @@ class FlatBufferBuilderImpl {
     minalign_ = 1;
     length_of_64_bit_region_ = 0;
     if (string_pool) string_pool->clear();
+    if (fixed_string_pool_.size) {
+      memset(fixed_string_pool_.slots, 0,
+             fixed_string_pool_.capacity * sizeof(uoffset_t));
+      fixed_string_pool_.size = 0;
+    }
+    memset(static_vtables_, 0, sizeof(static_vtables_));
+    nested_buffer_start_ = 0;
   }
 
   /// @brief The current size of the serialized buffer, counting from the end.
   /// @return Returns an `SizeT` with the current size of the buffer.
   SizeT GetSize() const { return buf_.size(); }
 
+#ifdef FLATBUFFERS_BUILDER_STATS
+  /// @brief The counters of the work this builder did since it was created, or
+  /// since the last `ResetStats()`. `Clear()` doesn't reset them.
+  /// Only available if FLATBUFFERS_BUILDER_STATS is defined.
+  const BuilderStats& GetStats() const { return buf_.stats(); }
+
+  /// @brief Resets all the counters returned by `GetStats()` to 0.
+  void ResetStats() { buf_.stats().Reset(); }
+#endif
+
+  /// @brief Whether a fixed-capacity builder (see the constructor taking a
+  /// span) ran out of space since it was last cleared. The buffer is then
+  /// incomplete and must not be used, even though building could carry on and
+  /// `GetSize()` reports the size it would have had.
+  bool HasOverflowed() const { return buf_.overflowed(); }
+
+  /// @brief The number of bytes currently allocated for the buffer (or its
+  /// current segment, see `SetSegmentSize()`).
+  /// @return Returns 0 if nothing has been allocated yet.
+  size_t GetBufferCapacity() const { return buf_.capacity(); }
+
   /// @brief The current size of the serialized buffer relative to the end of
   /// the 32-bit region.
   /// @return Returns an `uoffset_t` with the current size of the buffer.
@@ -208,6 +321,9 @@ class FlatBufferBuilderImpl {
   /// buffer.
   uint8_t* GetBufferPointer() const {
     Finished();
+    // If you hit this, the buffer is stored in multiple segments, see
+    // SetSegmentSize(). Call FlattenBuffer() first or use GetBufferSegments().
+    FLATBUFFERS_ASSERT(buf_.num_segments() == 1);
     return buf_.data();
   }
 
@@ -216,15 +332,43 @@ class FlatBufferBuilderImpl {
   /// FlatBuffer data inside the buffer.
   flatbuffers::span<uint8_t> GetBufferSpan() const {
     Finished();
+    FLATBUFFERS_ASSERT(buf_.num_segments() == 1);
+    // An overflowed buffer has no valid contents, see HasOverflowed().
+    if (buf_.overflowed()) return flatbuffers::span<uint8_t>();
     return flatbuffers::span<uint8_t>(buf_.data(), buf_.size());
   }
 
+  /// @brief Get the serialized buffer (after you call `Finish()`) as a list of
+  /// memory regions, e.g. for use with `writev` or scatter-gather I/O.
+  /// @return Returns the regions in order: concatenating them yields the same
+  /// bytes as `GetBufferSpan()`. Unless `SetSegmentSize()` was used, this
+  /// always is a single region.
+  std::vector<flatbuffers::span<const uint8_t>> GetBufferSegments() const {
+    Finished();
+    std::vector<flatbuffers::span<const uint8_t>> segments;
+    segments.reserve(buf_.num_segments());
+    for (size_t i = 0; i < buf_.num_segments(); i++) {
+      size_t len = 0;
+      const uint8_t* data = buf_.segment_data(i, &len);
+      if (len) segments.push_back(flatbuffers::span<const uint8_t>(data, len));
+    }
+    return segments;
+  }
+
+  /// @brief Copy a segmented buffer into a single contiguous memory block,
+  /// after which `GetBufferPointer()` can be used. This is a no-op if the
+  /// buffer is already contiguous.
+  void FlattenBuffer() { buf_.flatten(); }
+
   /// @brief Get a pointer to an unfinished buffer.
   /// @return Returns a `uint8_t` pointer to the unfinished buffer.
   uint8_t* GetCurrentBufferPointer() const { return buf_.data(); }
 
   /// @brief Get the released DetachedBuffer.
   /// @return A `DetachedBuffer` that owns the buffer and its allocator.
+  /// A segmented buffer is flattened into a single memory block first.
+  /// A fixed-capacity builder doesn't own its buffer, so it can't release it,
+  /// use `GetBufferSpan()` instead.
   DetachedBuffer Release() {
     Finished();
     DetachedBuffer buffer = buf_.release();
@@ -269,6 +413,21 @@ class FlatBufferBuilderImpl {
   }
   /// @endcond
 
+  /// @brief Make sure `size` bytes worth of objects, followed by `Finish()`,
+  /// can be serialized without the buffer having to grow. Growing copies the
+  /// buffer, so if the final size is known (or bounded, see the generated
+  /// `PackedSizeUpperBound()` functions) this allocates just once.
+  /// In segmented mode (see `SetSegmentSize()`) growing doesn't copy, and a
+  /// fixed-capacity builder never grows, so then this does nothing.
+  /// @param[in] size The number of bytes to make room for.
+  void Reserve(size_t size) {
+    if (buf_.segment_size() || buf_.fixed()) return;
+    // Finishing writes at most a size prefix, file identifier and root
+    // offset, aligned to the largest alignment in the buffer.
+    buf_.ensure_space(size + sizeof(SizeT) + kFileIdentifierLength +
+                      sizeof(uoffset_t) + FLATBUFFERS_MAX_ALIGNMENT);
+  }
+
   /// @brief In order to save space, fields that are set to their default value
   /// don't get serialized into the buffer.
   /// @param[in] fd When set to `true`, always serializes default values that
@@ -280,8 +439,142 @@ class FlatBufferBuilderImpl {
   /// @param[in] dedup When set to `true`, dedup vtables.
   void DedupVtables(bool dedup) { dedup_vtables_ = dedup; }
 
+  /// @brief By default the buffer grows by reallocating it, which copies
+  /// everything written so far. For very large buffers, this instead grows
+  /// the buffer by adding segments of (at least) `segment_size` bytes, which
+  /// never copies. The finished buffer is then available through
+  /// `GetBufferSegments()`, or contiguously through `FlattenBuffer()` and
+  /// `Release()`.
+  /// @param[in] segment_size The minimum size of a new segment, or 0 to go
+  /// back to contiguous growth.
+  /// @remark `GetTemporaryPointer()` and `CreateVectorOfSortedTables()` are
+  /// only supported while the buffer consists of a single segment.
+  void SetSegmentSize(size_t segment_size) {
+    buf_.set_segment_size(segment_size);
+  }
+
+  /// @brief Copies everything built so far in another builder into this one,
+  /// so that the parts of a large buffer can be built in parallel, each in
+  /// its own builder, and then be combined.
+  /// All offsets within a buffer are relative, so the bytes of `part` are
+  /// copied as they are, only padded to keep them aligned. The offsets
+  /// `part` returned refer to the copy after adding the returned value to
+  /// them, see `SplicedOffset()`.
+  /// @param[in] part A builder that isn't finished or building a table, and
+  /// doesn't use 64-bit offsets. It is left as it is, call `Clear()` on it to
+  /// build the next part.
+  /// @param[in] share_vtables Whether the tables built in this builder from
+  /// now on may use the vtables of `part` (those that differ from the ones
+  /// already in this builder). The tables of `part` keep using its own
+  /// vtables, so identical vtables of different parts are each kept.
+  /// Strings created with `CreateSharedString()` aren't shared across parts.
+  /// @return The offset in this builder that the end of `part` is at.
+  uoffset_t Splice(const FlatBufferBuilderImpl& part,
+                   bool share_vtables = true) {
+    NotNested();
+    FLATBUFFERS_ASSERT(!part.nested && !part.finished);
+    // If you hit this, `part` has a 64-bit region, which has to stay at the
+    // end of the buffer.
+    FLATBUFFERS_ASSERT(!part.length_of_64_bit_region_);
+    Align(part.minalign_);
+    const uoffset_t base = GetSizeRelative32BitRegion();
+    // The segments of `part` go from its front to its end, so they are
+    // pushed in reverse.
+    for (size_t i = part.buf_.num_segments(); i > 0; i--) {
+      size_t len = 0;
+      const uint8_t* data = part.buf_.segment_data(i - 1, &len);
+      PushBytes(data, len);
+    }
+    if (share_vtables && dedup_vtables_ && !buf_.overflowed()) {
+      const size_t num_vtables = NumVTables();
+      const uoffset_t* part_vtables =
+          reinterpret_cast<const uoffset_t*>(part.buf_.scratch_data());
+      for (size_t i = 0; i < part.NumVTables(); i++) {
+        const uoffset_t vt_offset = base + part_vtables[i];
+        if (!FindVTable(buf_.data_at(vt_offset + length_of_64_bit_region_),
+                        num_vtables)) {
+          buf_.scratch_push_small(vt_offset);
+        }
+      }
+    }
+    return base;
+  }
+
+  /// @brief Converts an offset returned by a builder passed to `Splice()`
+  /// into the corresponding offset in the builder it was spliced into.
+  /// @param[in] offset The offset returned by the spliced builder.
+  /// @param[in] splice The value `Splice()` returned for it.
+  template <typename T>
+  static Offset<T> SplicedOffset(Offset<T> offset, uoffset_t splice) {
+    return offset.IsNull() ? offset : Offset<T>(offset.o + splice);
+  }
+
+  /// @brief The state `StartNestedFlatBuffer()` returns, to be passed to
+  /// `EndNestedFlatBuffer()`.
+  struct NestedFlatBuffer {
+    uoffset_t start;
+    uoffset_t enclosing_start;
+  };
+
+  /// @brief Starts building a FlatBuffer inside this one, for a field with the
+  /// `nested_flatbuffer` attribute. Everything created until the matching
+  /// `EndNestedFlatBuffer()` becomes part of the nested buffer, which saves
+  /// building it in a separate builder and copying it with `CreateVector()`.
+  /// Objects created before can't be referred to from the nested buffer:
+  /// vtables and shared strings aren't shared with it.
+  /// Nested buffers can be nested themselves.
+  /// @remark Only supported while the buffer consists of a single segment,
+  /// see `SetSegmentSize()`.
+  /// @return The state to pass to `EndNestedFlatBuffer()`.
+  NestedFlatBuffer StartNestedFlatBuffer() {
+    NotNested();
+    NestedFlatBuffer nested_buffer;
+    nested_buffer.start = GetSizeRelative32BitRegion();
+    nested_buffer.enclosing_start = nested_buffer_start_;
+    nested_buffer_start_ = nested_buffer.start;
+    return nested_buffer;
+  }
+
+  /// @brief Finishes a FlatBuffer started with `StartNestedFlatBuffer()`, the
+  /// way `Finish()` does, and turns it into a vector of bytes.
+  /// @param[in] nested_buffer The value `StartNestedFlatBuffer()` returned.
+  /// Nested buffers have to be ended in the reverse order they were started.
+  /// @param[in] root The root table of the nested buffer.
+  /// @param[in] file_identifier A file identifier for the nested buffer, or
+  /// nullptr.
+  /// @return The offset of the vector, to be stored in the
+  /// `nested_flatbuffer` field, e.g. with the generated `CreateX()`.
+  template <typename T>
+  Offset<Vector<uint8_t>> EndNestedFlatBuffer(
+      const NestedFlatBuffer& nested_buffer, Offset<T> root,
+      const char* file_identifier = nullptr) {
+    NotNested();
+    // If you hit this, the nested buffers weren't ended in reverse order.
+    FLATBUFFERS_ASSERT(nested_buffer_start_ == nested_buffer.start);
+    // A nested buffer must be contiguous to be a vector.
+    FLATBUFFERS_ASSERT(buf_.num_segments() == 1);
+    const size_t file_id_size = file_identifier ? kFileIdentifierLength : 0;
+    // Align the start of the nested buffer to the largest alignment in it, as
+    // Finish() does, which also aligns the length of the vector.
+    PreAlign(sizeof(uoffset_t) + file_id_size,
+             (std::max)(minalign_, sizeof(uoffset_t)));
+    if (file_identifier) {
+      FLATBUFFERS_ASSERT(strlen(file_identifier) == kFileIdentifierLength);
+      PushBytes(reinterpret_cast<const uint8_t*>(file_identifier),
+                kFileIdentifierLength);
+    }
+    PushElement(ReferTo(root.o));
+    nested_buffer_start_ = nested_buffer.enclosing_start;
+    const uoffset_t nested_size =
+        GetSizeRelative32BitRegion() - nested_buffer.start;
+    return Offset<Vector<uint8_t>>(PushElement(nested_size));
+  }
+
   /// @cond FLATBUFFERS_INTERNAL
-  void Pad(size_t num_bytes) { buf_.fill(num_bytes); }
+  void Pad(size_t num_bytes) {
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().padding_bytes += num_bytes);
+    buf_.fill(num_bytes);
+  }
 
   void TrackMinAlign(size_t elem_size) {
     if (elem_size > minalign_) minalign_ = elem_size;
@@ -289,7 +582,9 @@ class FlatBufferBuilderImpl {
 
   void Align(size_t elem_size) {
     TrackMinAlign(elem_size);
-    buf_.fill(PaddingBytes(buf_.size(), elem_size));
+    const size_t padding = PaddingBytes(buf_.size(), elem_size);
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().padding_bytes += padding);
+    buf_.fill(padding);
   }
 
   void PushFlatBuffer(const uint8_t* bytes, size_t size) {
@@ -446,6 +741,12 @@ class FlatBufferBuilderImpl {
     const uoffset_t table_object_size = vtable_offset_loc - start;
     // Vtable use 16bit offsets.
     FLATBUFFERS_ASSERT(table_object_size < 0x10000);
+    if (buf_.overflowed()) {
+      // Nothing is stored anymore, so there is no vtable to fill in or share.
+      ClearOffsets();
+      nested = false;
+      return vtable_offset_loc;
+    }
     WriteScalar<voffset_t>(buf_.data() + sizeof(voffset_t),
                            static_cast<voffset_t>(table_object_size));
     WriteScalar<voffset_t>(buf_.data(), max_voffset_);
@@ -461,22 +762,24 @@ class FlatBufferBuilderImpl {
       WriteScalar<voffset_t>(buf_.data() + field_location->id, pos);
     }
     ClearOffsets();
-    auto vt1 = reinterpret_cast<voffset_t*>(buf_.data());
-    auto vt1_size = ReadScalar<voffset_t>(vt1);
+    LinkVTable(vtable_offset_loc);
+    nested = false;
+    return vtable_offset_loc;
+  }
+
+  // Shares the vtable just written to the buffer with an identical earlier
+  // one if there is any, and makes the table at `vtable_offset_loc` refer to
+  // the vtable used. Returns the offset of that vtable.
+  uoffset_t LinkVTable(uoffset_t vtable_offset_loc) {
     auto vt_use = GetSizeRelative32BitRegion();
     // See if we already have generated a vtable with this exact same
     // layout before. If so, make it point to the old one, remove this one.
     if (dedup_vtables_) {
-      for (auto it = buf_.scratch_data(); it < buf_.scratch_end();
-           it += sizeof(uoffset_t)) {
-        auto vt_offset_ptr = reinterpret_cast<uoffset_t*>(it);
-        auto vt2 = reinterpret_cast<voffset_t*>(
-            buf_.data_at(*vt_offset_ptr + length_of_64_bit_region_));
-        auto vt2_size = ReadScalar<voffset_t>(vt2);
-        if (vt1_size != vt2_size || 0 != memcmp(vt2, vt1, vt1_size)) continue;
-        vt_use = *vt_offset_ptr;
+      const uoffset_t vt_found = FindVTable(buf_.data(), NumVTables());
+      if (vt_found) {
+        vt_use = vt_found;
         buf_.pop(GetSizeRelative32BitRegion() - vtable_offset_loc);
-        break;
+        FLATBUFFERS_BUILDER_STAT(buf_.stats().vtable_dedup_hits++);
       }
     }
     // If this is a new vtable, remember it.
@@ -491,7 +794,85 @@ class FlatBufferBuilderImpl {
     WriteScalar(buf_.data_at(vtable_offset_loc + length_of_64_bit_region_),
                 static_cast<soffset_t>(vt_use) -
                     static_cast<soffset_t>(vtable_offset_loc));
+    return vt_use;
+  }
+
+  // The number of vtables remembered for dedup, whose offsets are the
+  // contents of the scratch-pad (outside of EndTable()).
+  size_t NumVTables() const {
+    return static_cast<size_t>(buf_.scratch_end() - buf_.scratch_data()) /
+           sizeof(uoffset_t);
+  }
+
+  // Returns the offset of a vtable equal to `vt` among the first
+  // `num_vtables` remembered ones, or 0 if there is none. Vtables outside of
+  // the nested FlatBuffer being built, if any, are skipped.
+  uoffset_t FindVTable(const uint8_t* vt, size_t num_vtables) const {
+    const voffset_t vt_size = ReadScalar<voffset_t>(vt);
+    const uoffset_t* vt_offsets =
+        reinterpret_cast<const uoffset_t*>(buf_.scratch_data());
+    for (size_t i = 0; i < num_vtables; i++) {
+      if (vt_offsets[i] <= nested_buffer_start_) continue;
+      const uint8_t* vt2 =
+          buf_.data_at(vt_offsets[i] + length_of_64_bit_region_);
+      if (vt_size == ReadScalar<voffset_t>(vt2) &&
+          0 == memcmp(vt2, vt, vt_size)) {
+        return vt_offsets[i];
+      }
+    }
+    return 0;
+  }
+
+  // Code generated with --cpp-static-vtables builds tables that store all
+  // their fields at offsets known at compile time, so their vtable is known
+  // at compile time too. Such a table starts aligned to the largest of its
+  // fields, after which the fields are pushed in a fixed order with
+  // PushElement() and PushStruct(), without tracking them.
+  uoffset_t StartTableWithStaticVTable(size_t alignment) {
+    NotNested();
+    Align(alignment);
+    nested = true;
+    return GetSizeRelative32BitRegion();
+  }
+
+  template <typename T>
+  void PushStruct(const T& structobj) {
+    Align(AlignOf<T>());
+    buf_.push_small(structobj);
+  }
+
+  // Finishes a table started with StartTableWithStaticVTable(), given its
+  // precomputed vtable (in native endianness). Instead of being searched for,
+  // the copy of the vtable in the buffer is looked up by that address.
+  uoffset_t EndTableWithStaticVTable(uoffset_t start, const voffset_t* vtable) {
+    FLATBUFFERS_ASSERT(nested);
     nested = false;
+    const uoffset_t vtable_offset_loc =
+        static_cast<uoffset_t>(PushElement<soffset_t>(0));
+    // If this fails, the fields weren't pushed the way `vtable` lays out.
+    FLATBUFFERS_ASSERT(vtable_offset_loc - start == vtable[1]);
+    (void)start;
+    if (buf_.overflowed()) return vtable_offset_loc;
+    StaticVTable& cached =
+        static_vtables_[(reinterpret_cast<size_t>(vtable) / sizeof(voffset_t)) %
+                        kStaticVTables];
+    if (cached.vtable == vtable && dedup_vtables_ &&
+        cached.offset > nested_buffer_start_) {
+      WriteScalar(buf_.data_at(vtable_offset_loc + length_of_64_bit_region_),
+                  static_cast<soffset_t>(cached.offset) -
+                      static_cast<soffset_t>(vtable_offset_loc));
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().vtable_dedup_hits++);
+      return vtable_offset_loc;
+    }
+    const voffset_t vtable_size = vtable[0];
+    uint8_t* vt = buf_.make_space(vtable_size);
+    if (!vt) return vtable_offset_loc;
+    for (voffset_t i = 0; i < vtable_size / sizeof(voffset_t); i++) {
+      WriteScalar<voffset_t>(vt + i * sizeof(voffset_t), vtable[i]);
+    }
+    // The vtable may still equal one written by EndTable().
+    cached.vtable = vtable;
+    cached.offset = LinkVTable(vtable_offset_loc);
     return vtable_offset_loc;
   }
 
@@ -504,8 +885,13 @@ class FlatBufferBuilderImpl {
   // just been constructed.
   template <typename T>
   void Required(Offset<T> table, voffset_t field) {
-    auto table_ptr = reinterpret_cast<const Table*>(buf_.data_at(table.o));
-    bool ok = table_ptr->GetOptionalFieldOffset(field) != 0;
+    if (buf_.overflowed()) return;
+    // Resolve the vtable through its offset, as it may be stored in a
+    // different segment than the table itself.
+    auto vtable_offset = ReadScalar<soffset_t>(buf_.data_at(table.o));
+    auto vtable = buf_.data_at(table.o + vtable_offset);
+    auto vtable_size = ReadScalar<voffset_t>(vtable);
+    bool ok = field < vtable_size && ReadScalar<voffset_t>(vtable + field) != 0;
     // If this fails, the caller will show what field needs to be set.
     FLATBUFFERS_ASSERT(ok);
     (void)ok;
@@ -529,7 +915,9 @@ class FlatBufferBuilderImpl {
   void PreAlign(size_t len, size_t alignment) {
     if (len == 0) return;
     TrackMinAlign(alignment);
-    buf_.fill(PaddingBytes(GetSize() + len, alignment));
+    const size_t padding = PaddingBytes(GetSize() + len, alignment);
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().padding_bytes += padding);
+    buf_.fill(padding);
   }
 
   // Aligns such than when "len" bytes are written, an object of type `AlignT`
@@ -616,6 +1004,7 @@ class FlatBufferBuilderImpl {
   /// @param[in] len The number of bytes that should be stored from `str`.
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateSharedString(const char* str, size_t len) {
+    if (buf_.fixed()) return CreateFixedSharedString(str, len);
     FLATBUFFERS_ASSERT(FLATBUFFERS_GENERAL_HEAP_ALLOC_OK);
     if (!string_pool) {
       string_pool = new StringOffsetMap(StringOffsetCompare(buf_));
@@ -628,9 +1017,15 @@ class FlatBufferBuilderImpl {
     auto it = string_pool->find(off);
     // If it exists we reuse existing serialized data!
     if (it != string_pool->end()) {
-      // We can remove the string we serialized.
-      buf_.pop(buf_.size() - size_before_string);
-      return *it;
+      if (it->o > nested_buffer_start_) {
+        // We can remove the string we serialized.
+        buf_.pop(buf_.size() - size_before_string);
+        FLATBUFFERS_BUILDER_STAT(buf_.stats().shared_string_hits++);
+        return *it;
+      }
+      // It is outside of the nested FlatBuffer being built, so share the new
+      // one from now on.
+      string_pool->erase(it);
     }
     // Record this string for future use.
     string_pool->insert(off);
@@ -819,15 +1214,17 @@ class FlatBufferBuilderImpl {
   }
 
   template <template <typename...> class VectorT = Vector64,
-            int&... ExplicitArgumentBarrier, typename T>
-  Offset64<VectorT<T>> CreateVector64(const std::vector<T>& v) {
+            int&... ExplicitArgumentBarrier, typename T,
+            typename Alloc = std::allocator<T>>
+  Offset64<VectorT<T>> CreateVector64(const std::vector<T, Alloc>& v) {
     return CreateVector<T, Offset64, VectorT>(data(v), v.size());
   }
 
   // vector<bool> may be implemented using a bit-set, so we can't access it as
   // an array. Instead, read elements manually.
   // Background: https://isocpp.org/blog/2012/11/on-vectorbool
-  Offset<Vector<uint8_t>> CreateVector(const std::vector<bool>& v) {
+  template <int&... ExplicitArgumentBarrier, typename Alloc>
+  Offset<Vector<uint8_t>> CreateVector(const std::vector<bool, Alloc>& v) {
     StartVector<uint8_t>(v.size());
     for (auto i = v.size(); i > 0;) {
       PushElement(static_cast<uint8_t>(v[--i]));
@@ -835,7 +1232,9 @@ class FlatBufferBuilderImpl {
     return Offset<Vector<uint8_t>>(EndVector(v.size()));
   }
 
-  Offset64<Vector64<uint8_t>> CreateVector64(const std::vector<bool>& v) {
+  template <int&... ExplicitArgumentBarrier, typename Alloc>
+  Offset64<Vector64<uint8_t>> CreateVector64(
+      const std::vector<bool, Alloc>& v) {
     StartVector<uint8_t, Offset64, Vector64<uint8_t>::size_type>(v.size());
     for (auto i = v.size(); i > 0;) {
       PushElement(static_cast<uint8_t>(v[--i]));
@@ -852,10 +1251,13 @@ class FlatBufferBuilderImpl {
   /// returns any type that you can construct a FlatBuffers vector out of.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
+  /// @note This collects the elements in a `std::vector` on the heap, so it
+  /// can't be used with a fixed-capacity builder.
   template <typename T>
   Offset<Vector<T>> CreateVector(size_t vector_size,
                                  const std::function<T(size_t i)>& f) {
     FLATBUFFERS_ASSERT(FLATBUFFERS_GENERAL_HEAP_ALLOC_OK);
+    FLATBUFFERS_ASSERT(!buf_.fixed());
     std::vector<T> elems(vector_size);
     for (size_t i = 0; i < vector_size; i++) elems[i] = f(i);
     return CreateVector(elems);
@@ -872,9 +1274,12 @@ class FlatBufferBuilderImpl {
   /// @param state State passed to f.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
+  /// @note As it uses the heap, this can't be used with a fixed-capacity
+  /// builder.
   template <typename T, typename F, typename S>
   Offset<Vector<T>> CreateVector(size_t vector_size, F f, S* state) {
     FLATBUFFERS_ASSERT(FLATBUFFERS_GENERAL_HEAP_ALLOC_OK);
+    FLATBUFFERS_ASSERT(!buf_.fixed());
     std::vector<T> elems(vector_size);
     for (size_t i = 0; i < vector_size; i++) elems[i] = f(i, state);
     return CreateVector(elems);
@@ -915,11 +1320,16 @@ class FlatBufferBuilderImpl {
       buf_.scratch_push_small(CreateString(*it));
     }
     StartVector<Offset<String>>(size);
-    for (size_t i = 1; i <= size; i++) {
-      // Note we re-evaluate the buf location each iteration to account for any
-      // underlying buffer resizing that may occur.
-      PushElement(*reinterpret_cast<Offset<String>*>(
-          buf_.scratch_end() - i * sizeof(Offset<String>)));
+    if (buf_.overflowed()) {
+      // The offsets may not all have made it into the scratch-pad.
+      buf_.fill(size * sizeof(Offset<String>));
+    } else {
+      for (size_t i = 1; i <= size; i++) {
+        // Note we re-evaluate the buf location each iteration to account for
+        // any underlying buffer resizing that may occur.
+        PushElement(*reinterpret_cast<Offset<String>*>(
+            buf_.scratch_end() - i * sizeof(Offset<String>)));
+      }
     }
     buf_.scratch_pop(scratch_buffer_usage);
     return Offset<Vector<Offset<String>>>(EndVector(size));
@@ -958,7 +1368,7 @@ class FlatBufferBuilderImpl {
   Offset<Vector<const T*>> CreateVectorOfStructs(
       size_t vector_size, const std::function<void(size_t i, T*)>& filler) {
     T* structs = StartVectorOfStructs<T>(vector_size);
-    for (size_t i = 0; i < vector_size; i++) {
+    for (size_t i = 0; structs && i < vector_size; i++) {
       filler(i, structs);
       structs++;
     }
@@ -978,7 +1388,7 @@ class FlatBufferBuilderImpl {
   Offset<Vector<const T*>> CreateVectorOfStructs(size_t vector_size, F f,
                                                  S* state) {
     T* structs = StartVectorOfStructs<T>(vector_size);
-    for (size_t i = 0; i < vector_size; i++) {
+    for (size_t i = 0; structs && i < vector_size; i++) {
       f(i, structs, state);
       structs++;
     }
@@ -1000,8 +1410,9 @@ class FlatBufferBuilderImpl {
   }
 
   template <template <typename...> class VectorT = Vector64, int&...,
-            typename T>
-  Offset64<VectorT<const T*>> CreateVectorOfStructs64(const std::vector<T>& v) {
+            typename T, typename Alloc = std::allocator<T>>
+  Offset64<VectorT<const T*>> CreateVectorOfStructs64(
+      const std::vector<T, Alloc>& v) {
     return CreateVectorOfStructs<T, Offset64, VectorT>(data(v), v.size());
   }
 
@@ -1020,7 +1431,7 @@ class FlatBufferBuilderImpl {
       const S* v, size_t len, T (*const pack_func)(const S&)) {
     FLATBUFFERS_ASSERT(pack_func);
     auto structs = StartVectorOfStructs<T>(len);
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 0; structs && i < len; i++) {
       structs[i] = pack_func(v[i]);
     }
     return EndVectorOfStructs<T>(len);
@@ -1133,10 +1544,12 @@ class FlatBufferBuilderImpl {
   Offset<Vector<const T*>> CreateVectorOfSortedNativeStructs(S* v, size_t len) {
     extern T Pack(const S&);
     auto structs = StartVectorOfStructs<T>(len);
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 0; structs && i < len; i++) {
       structs[i] = Pack(v[i]);
     }
-    std::stable_sort(structs, structs + len, StructKeyComparator<T>());
+    if (structs) {
+      std::stable_sort(structs, structs + len, StructKeyComparator<T>());
+    }
     return EndVectorOfStructs<T>(len);
   }
 
@@ -1169,7 +1582,12 @@ class FlatBufferBuilderImpl {
   template <typename T>
   Offset<Vector<Offset<T>>> CreateVectorOfSortedTables(Offset<T>* v,
                                                        size_t len) {
-    std::stable_sort(v, v + len, TableKeyComparator<T>(buf_));
+    // Comparing keys requires the tables to be stored contiguously.
+    FLATBUFFERS_ASSERT(buf_.num_segments() == 1);
+    // An overflowed buffer has no tables to compare.
+    if (!buf_.overflowed()) {
+      std::stable_sort(v, v + len, TableKeyComparator<T>(buf_));
+    }
     return CreateVector(v, len);
   }
 
@@ -1192,7 +1610,7 @@ class FlatBufferBuilderImpl {
   /// @param[in] elemsize The size of each element in the `vector`.
   /// @param[out] buf A pointer to a `uint8_t` pointer that can be
   /// written to at a later time to serialize the data into a `vector`
-  /// in the buffer.
+  /// in the buffer. Set to nullptr if a fixed-capacity builder has overflowed.
   uoffset_t CreateUninitializedVector(size_t len, size_t elemsize,
                                       size_t alignment, uint8_t** buf) {
     NotNested();
@@ -1200,7 +1618,7 @@ class FlatBufferBuilderImpl {
     buf_.make_space(len * elemsize);
     const uoffset_t vec_start = GetSizeRelative32BitRegion();
     auto vec_end = EndVector(len);
-    *buf = buf_.data_at(vec_start);
+    *buf = buf_.overflowed() ? nullptr : buf_.data_at(vec_start);
     return vec_end;
   }
 
@@ -1217,7 +1635,7 @@ class FlatBufferBuilderImpl {
   /// @param[in] len The number of elements to store in the `vector`.
   /// @param[out] buf A pointer to a pointer of type `T` that can be
   /// written to at a later time to serialize the data into a `vector`
-  /// in the buffer.
+  /// in the buffer. Set to nullptr if a fixed-capacity builder has overflowed.
   template <typename T>
   Offset<Vector<T>> CreateUninitializedVector(size_t len, T** buf) {
     AssertScalarT<T>();
@@ -1240,8 +1658,18 @@ class FlatBufferBuilderImpl {
     AssertScalarT<T>();
     AssertScalarT<U>();
     StartVector<T>(len);
-    for (auto i = len; i > 0;) {
-      PushElement(static_cast<T>(v[--i]));
+    // Casting between same sized integers and enums doesn't change any bits,
+    // so if the host is little endian too the elements can be copied as is.
+    if (sizeof(T) == sizeof(U) && !std::is_floating_point<T>::value &&
+        !std::is_floating_point<U>::value &&
+        (FLATBUFFERS_LITTLEENDIAN || sizeof(T) == 1)) {
+      if (len > 0) {
+        PushBytes(reinterpret_cast<const uint8_t*>(v), len * sizeof(T));
+      }
+    } else {
+      for (auto i = len; i > 0;) {
+        PushElement(static_cast<T>(v[--i]));
+      }
     }
     return Offset<Vector<T>>(EndVector(len));
   }
@@ -1381,6 +1809,31 @@ class FlatBufferBuilderImpl {
   typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
   StringOffsetMap* string_pool;
 
+  // The string pool of a fixed-capacity builder instead: a hash set of string
+  // offsets at the start of its buffer, using linear probing. Empty slots are
+  // 0, which can't be the offset of a string.
+  struct FixedStringPool {
+    uoffset_t* slots;
+    size_t capacity;  // A power of 2, or 0 if there is no pool.
+    size_t size;
+  };
+  FixedStringPool fixed_string_pool_;
+
+  // The vtables EndTableWithStaticVTable() wrote, by the address of their
+  // precomputed version: a direct-mapped cache, so a miss only costs
+  // writing (or sharing) the vtable again.
+  struct StaticVTable {
+    const voffset_t* vtable;
+    uoffset_t offset;
+  };
+  static const size_t kStaticVTables = 16;
+  StaticVTable static_vtables_[kStaticVTables];
+
+  // While building a nested FlatBuffer in place, the offset its end is at:
+  // the vtables and shared strings at or below it are outside of the nested
+  // buffer, so they can't be used in it. 0 otherwise.
+  uoffset_t nested_buffer_start_;
+
  private:
   void CanAddOffset64() {
     // If you hit this assertion, you are attempting to add a 64-bit offset to
@@ -1411,12 +1864,57 @@ class FlatBufferBuilderImpl {
   /// @return Returns the offset in the buffer where the string starts.
   void CreateStringImpl(const char* str, size_t len) {
     NotNested();
+    // When growing by segments, reserve the whole string up front, so it
+    // never straddles two of them.
+    if (buf_.segment_size()) {
+      buf_.ensure_space(len + 1 + 2 * sizeof(uoffset_t));
+    }
     PreAlign<uoffset_t>(len + 1);  // Always 0-terminated.
     buf_.fill(1);
     PushBytes(reinterpret_cast<const uint8_t*>(str), len);
     PushElement(static_cast<uoffset_t>(len));
   }
 
+  Offset<String> CreateFixedSharedString(const char* str, size_t len) {
+    FixedStringPool& pool = fixed_string_pool_;
+    if (!pool.capacity || buf_.overflowed()) {
+      return CreateString<Offset>(str, len);
+    }
+    // FNV-1a.
+    uint32_t hash = 0x811c9dc5;
+    for (size_t i = 0; i < len; i++) {
+      hash = (hash ^ static_cast<uint8_t>(str[i])) * 0x01000193;
+    }
+    const size_t mask = pool.capacity - 1;
+    size_t slot = hash & mask;
+    bool replace = false;
+    for (; pool.slots[slot]; slot = (slot + 1) & mask) {
+      auto existing = reinterpret_cast<const String*>(
+          buf_.data_at(pool.slots[slot] + length_of_64_bit_region_));
+      if (existing->size() == len && !memcmp(existing->data(), str, len)) {
+        if (pool.slots[slot] > nested_buffer_start_) {
+          FLATBUFFERS_BUILDER_STAT(buf_.stats().shared_string_hits++);
+          return Offset<String>(pool.slots[slot]);
+        }
+        // It is outside of the nested FlatBuffer being built, so share the
+        // new one from now on.
+        replace = true;
+        break;
+      }
+    }
+    const Offset<String> off = CreateString<Offset>(str, len);
+    if (replace) {
+      if (!buf_.overflowed()) pool.slots[slot] = off.o;
+      return off;
+    }
+    // Only remember the string if it was stored, and the pool isn't full.
+    if (!buf_.overflowed() && 2 * pool.size < pool.capacity) {
+      pool.slots[slot] = off.o;
+      pool.size++;
+    }
+    return off;
+  }
+
   // Allocates space for a vector of structures.
   // Must be completed with EndVectorOfStructs().
   template <typename T, template <typename> class OffsetT = Offset>
@@ -1500,7 +1998,7 @@ inline void FlatBufferBuilder64::StartVector<Offset64, uint64_t>(
 
 /// Helpers to get a typed pointer to objects that are currently being built.
 /// @warning Creating new objects will lead to reallocations and invalidates
-/// the pointer!
+/// the pointer! Not supported for segmented buffers.
 template <typename T>
 T* GetMutableTemporaryPointer(FlatBufferBuilder& fbb, Offset<T> offset) {
   return reinterpret_cast<T*>(fbb.GetCurrentBufferPointer() + fbb.GetSize() -
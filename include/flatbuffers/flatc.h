@@ -48,11 +48,16 @@ struct FlatCOptions {
   std::vector<bool> generator_enabled;
   size_t binary_files_from = std::numeric_limits<size_t>::max();
   std::string conform_to_schema;
+  std::string transcode_from;
+  std::string transcode_mapping;
   std::string annotate_schema;
   bool annotate_include_vector_contents = true;
+  bool annotate_stats = false;
+  bool annotate_stats_csv = false;
   bool any_generator = false;
   bool print_make_rules = false;
   bool raw_binary = false;
+  bool record_stream = false;
   bool schema_binary = false;
   bool grpc_enabled = false;
   bool requires_bfbs = false;
@@ -114,12 +119,26 @@ class FlatCompiler {
                         uint64_t binary_schema_size,
                         const FlatCOptions& options);
 
+  void ProfileBinaries(const uint8_t* binary_schema,
+                       uint64_t binary_schema_size,
+                       const FlatCOptions& options);
+
   void ValidateOptions(const FlatCOptions& options);
 
   Parser GetConformParser(const FlatCOptions& options);
 
+  void ConvertRecordStream(const FlatCOptions& options, const Parser& parser,
+                           const std::string& filename);
+
+  std::string GetTranscodeSchema(const FlatCOptions& options);
+
+  void TranscodeBinary(const FlatCOptions& options, Parser& parser,
+                       const std::string& source_schema,
+                       const std::string& filename);
+
   std::unique_ptr<Parser> GenerateCode(const FlatCOptions& options,
-                                       Parser& conform_parser);
+                                       Parser& conform_parser,
+                                       const std::string& transcode_schema);
 
   std::map<std::string, std::shared_ptr<CodeGenerator>> code_generators_;
 
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_FLEX_JSON_H_
+#define FLATBUFFERS_FLEX_JSON_H_
+
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+
+// Parses JSON into a FlexBuffer without going through the tokenizer of the
+// IDL `Parser` (see `Parser::ParseFlexBuffer()`).
+//
+// The JSON is parsed in two passes, as simdjson does: the first finds the
+// structural characters (brackets, colons, commas and quotes outside of
+// strings) and the starts of numbers and literals eight bytes at a time, the
+// second walks over those and adds the values to the `Builder`.
+
+namespace flexbuffers {
+
+class JsonParser {
+ public:
+  JsonParser()
+      : builder_(nullptr),
+        json_(nullptr),
+        length_(0),
+        has_non_ascii_(false),
+        num_structurals_(0),
+        next_(0) {}
+
+  // Parses the JSON value `json` of `length` bytes into `builder`, and
+  // finishes it. Returns false, with an error(), and clears `builder` if the
+  // JSON isn't valid.
+  //
+  // Numbers without a fraction or exponent are added as integers (unsigned
+  // if they only fit in a uint64_t), others as doubles, and maps are checked
+  // for duplicate keys. Unlike the `Parser`, only strict JSON is accepted:
+  // keys must be quoted, and comments, trailing commas, `nan` and `inf`
+  // aren't allowed. Keys and strings are shared as the flags of the `Builder`
+  // say.
+  bool Parse(const char* json, size_t length, Builder* builder);
+
+  // Parses the null-terminated `json`.
+  bool Parse(const char* json, Builder* builder) {
+    return Parse(json, strlen(json), builder);
+  }
+
+  const std::string& error() const { return error_; }
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(JsonParser(const JsonParser&));
+  FLATBUFFERS_DELETE_FUNC(JsonParser& operator=(const JsonParser&));
+
+  bool IndexStructurals();
+  size_t NextPosition();
+  char PeekChar() const;
+  char CharAt(size_t position) const {
+    return position < length_ ? json_[position] : '\0';
+  }
+  bool ParseValue(int depth);
+  bool ParseString(size_t position);
+  bool Unescape(size_t begin, size_t end);
+  static bool ParseHex4(const char* p, const char* end, uint32_t* value);
+  bool ParseNumber(size_t position);
+  bool ParseLiteral(size_t position);
+  bool EndsToken(size_t position) const;
+  bool Error(size_t position, const char* message);
+
+  Builder* builder_;
+  const char* json_;
+  size_t length_;
+  bool has_non_ascii_;
+  // The offsets of the structural characters in the JSON, followed by
+  // `length_`, and the one to look at next.
+  std::vector<uint32_t> structurals_;
+  size_t num_structurals_;
+  size_t next_;
+  // The last key or string, unescaped.
+  std::string scratch_;
+  std::string error_;
+};
+
+}  // namespace flexbuffers
+
+#endif  // FLATBUFFERS_FLEX_JSON_H_
@@ -21,6 +21,8 @@
 #include <map>
 // Used to select STL variant.
 #include "flatbuffers/base.h"
+#include "flatbuffers/builder_stats.h"
+#include "flatbuffers/detached_buffer.h"
 // We use the basic binary writing functions from the regular FlatBuffers.
 #include "flatbuffers/util.h"
 
@@ -1046,11 +1048,26 @@ class Builder FLATBUFFERS_FINAL_CLASS {
         has_duplicate_keys_(false),
         flags_(flags),
         force_min_bit_width_(BIT_WIDTH_8),
+        stream_vector_type_(FBT_NULL),
+        stream_element_type_(FBT_NULL),
+        stream_bit_width_(BIT_WIDTH_8),
+        stream_byte_width_(1),
+        stream_next_(0),
+        stream_end_(0),
         key_pool(KeyOffsetCompare(buf_)),
         string_pool(StringOffsetCompare(buf_)) {
     buf_.clear();
   }
 
+  // Builds into `buffer`, after clearing it, so that its memory can be reused,
+  // for example that of a vector from an earlier ReleaseVector().
+  explicit Builder(std::vector<uint8_t>&& buffer,
+                   BuilderFlag flags = BUILDER_FLAG_SHARE_KEYS)
+      : Builder(0, flags) {
+    buf_.swap(buffer);
+    buf_.clear();
+  }
+
 #ifdef FLATBUFFERS_DEFAULT_DECLARATION
   Builder(Builder&&) = default;
   Builder& operator=(Builder&&) = default;
@@ -1066,6 +1083,40 @@ class Builder FLATBUFFERS_FINAL_CLASS {
   // Size of the buffer. Does not include unfinished values.
   size_t GetSize() const { return buf_.size(); }
 
+  /// @brief Get the released DetachedBuffer, like
+  /// `FlatBufferBuilder::Release()`, without copying the buffer (after you
+  /// call `Finish()`). The builder is then cleared, and allocates a new buffer
+  /// as it builds the next one.
+  /// @return A `DetachedBuffer` that owns the buffer.
+  flatbuffers::DetachedBuffer Release() {
+    Finished();
+    VectorOwner* owner = new VectorOwner(ReleaseVector());
+    std::vector<uint8_t>& buffer = owner->buffer_;
+    return flatbuffers::DetachedBuffer(owner, true, buffer.data(),
+                                       buffer.capacity(), buffer.data(),
+                                       buffer.size());
+  }
+
+  /// @brief Get the released buffer, without copying it (after you call
+  /// `Finish()`). The builder is then cleared.
+  std::vector<uint8_t> ReleaseVector() {
+    Finished();
+    std::vector<uint8_t> buffer;
+    buffer.swap(buf_);
+    Clear();
+    return buffer;
+  }
+
+#ifdef FLATBUFFERS_BUILDER_STATS
+  // The counters of the work this builder did since it was created, or since
+  // the last ResetStats(). Clear() doesn't reset them. vtable_dedup_hits is
+  // always 0, as FlexBuffers have no vtables.
+  // Only available if FLATBUFFERS_BUILDER_STATS is defined.
+  const flatbuffers::BuilderStats& GetStats() const { return stats_; }
+
+  void ResetStats() { stats_.Reset(); }
+#endif
+
   // Reset all state so we can re-use the buffer.
   void Clear() {
     buf_.clear();
@@ -1073,6 +1124,8 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     finished_ = false;
     // flags_ remains as-is;
     force_min_bit_width_ = BIT_WIDTH_8;
+    has_duplicate_keys_ = false;
+    stream_next_ = stream_end_ = 0;
     key_pool.clear();
     string_pool.clear();
   }
@@ -1157,6 +1210,7 @@ class Builder FLATBUFFERS_FINAL_CLASS {
         // existing offset instead.
         buf_.resize(sloc);
         sloc = *it;
+        FLATBUFFERS_BUILDER_STAT(stats_.shared_key_hits++);
       } else {
         key_pool.insert(sloc);
       }
@@ -1179,6 +1233,7 @@ class Builder FLATBUFFERS_FINAL_CLASS {
         // existing offset instead.
         buf_.resize(reset_to);
         sloc = it->first;
+        FLATBUFFERS_BUILDER_STAT(stats_.shared_string_hits++);
         stack_.back().u_ = sloc;
       } else {
         string_pool.insert(so);
@@ -1399,6 +1454,100 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     return FixedTypedVector(elems, len);
   }
 
+  // Streamed vectors and maps write their elements straight into the buffer
+  // as they are added, instead of keeping them on the value stack until the
+  // end, so building one takes memory in proportion to its size in the
+  // buffer only. That takes knowing up front how many elements there are, and
+  // their bit width (which defaults to that of T): a typed vector of
+  // `len` scalars of type T, for example:
+  //
+  //   auto start = builder.StartStreamedVector<int64_t>(n, BIT_WIDTH_16);
+  //   for (size_t i = 0; i < n; i++) builder.StreamedElement(values[i]);
+  //   builder.EndStreamedVector(start);
+  //
+  // The elements must all be added before anything else is.
+  template <typename T>
+  size_t StartStreamedVector(size_t len,
+                             BitWidth bit_width = WidthB(sizeof(T))) {
+    const Type type = GetScalarType<T>();
+    bit_width = (std::max)(bit_width, WidthU(len));
+    if (type == FBT_FLOAT) bit_width = (std::max)(bit_width, BIT_WIDTH_32);
+    const uint8_t byte_width = Align(bit_width);
+    Write<uint64_t>(len, byte_width);
+    return StartStreamed(ToTypedVector(type), type, bit_width, len, 0);
+  }
+  template <typename T>
+  size_t StartStreamedVector(const char* key, size_t len,
+                             BitWidth bit_width = WidthB(sizeof(T))) {
+    Key(key);
+    return StartStreamedVector<T>(len, bit_width);
+  }
+
+  size_t EndStreamedVector(size_t start) { return EndStreamed(start); }
+
+  // The same for a map with the `len` keys `keys`, in strcmp() order, whose
+  // values are scalars of type T added in the order of their keys. The keys
+  // go through the value stack as usual.
+  template <typename T>
+  size_t StartStreamedMap(const char* const* keys, size_t len,
+                          BitWidth bit_width = WidthB(sizeof(T))) {
+    const Type type = GetScalarType<T>();
+    const size_t start = stack_.size();
+    for (size_t i = 0; i < len; i++) {
+      // If you get this assert, the keys aren't sorted.
+      FLATBUFFERS_ASSERT(!i || strcmp(keys[i - 1], keys[i]) <= 0);
+      if (i && !strcmp(keys[i - 1], keys[i])) has_duplicate_keys_ = true;
+      Key(keys[i]);
+    }
+    const Value key_vector = CreateVector(start, len, 1, true, false);
+    stack_.resize(start);
+    bit_width = (std::max)(bit_width, WidthU(len));
+    if (type == FBT_FLOAT) bit_width = (std::max)(bit_width, BIT_WIDTH_32);
+    bit_width = (std::max)(bit_width, key_vector.ElemWidth(buf_.size(), 0));
+    const uint8_t byte_width = Align(bit_width);
+    WriteOffset(key_vector.u_, byte_width);
+    Write<uint64_t>(1ULL << key_vector.min_bit_width_, byte_width);
+    Write<uint64_t>(len, byte_width);
+    // All the values have the same type.
+    return StartStreamed(FBT_MAP, type, bit_width, len,
+                         PackedType(bit_width, type));
+  }
+  template <typename T>
+  size_t StartStreamedMap(const char* key, const char* const* keys,
+                          size_t len, BitWidth bit_width = WidthB(sizeof(T))) {
+    Key(key);
+    return StartStreamedMap<T>(keys, len, bit_width);
+  }
+
+  size_t EndStreamedMap(size_t start) { return EndStreamed(start); }
+
+  // Adds the next element of the streamed vector or map, which must fit in
+  // its bit width (a double is stored as a float if that is 32 bits).
+  template <typename T>
+  void StreamedElement(T val) {
+    // If you get these asserts, the element has the wrong type, or is one
+    // too many.
+    FLATBUFFERS_ASSERT(GetScalarType<T>() == stream_element_type_);
+    FLATBUFFERS_ASSERT(stream_next_ < stream_end_);
+    uint8_t* dst = buf_.data() + stream_next_;
+    if (stream_element_type_ == FBT_FLOAT) {
+      if (stream_byte_width_ == 8) {
+        WriteScalarTo(dst, static_cast<double>(val), 8);
+      } else {
+        WriteScalarTo(dst, static_cast<float>(val), 4);
+      }
+    } else if (stream_element_type_ == FBT_INT) {
+      const int64_t i = static_cast<int64_t>(val);
+      FLATBUFFERS_ASSERT((1U << WidthI(i)) <= stream_byte_width_);
+      WriteScalarTo(dst, i, stream_byte_width_);
+    } else {
+      const uint64_t u = static_cast<uint64_t>(val);
+      FLATBUFFERS_ASSERT((1U << WidthU(u)) <= stream_byte_width_);
+      WriteScalarTo(dst, u, stream_byte_width_);
+    }
+    stream_next_ += stream_byte_width_;
+  }
+
   template <typename F>
   size_t Map(F f) {
     auto start = StartMap();
@@ -1535,15 +1684,30 @@ class Builder FLATBUFFERS_FINAL_CLASS {
   // Align to prepare for writing a scalar with a certain size.
   uint8_t Align(BitWidth alignment) {
     auto byte_width = 1U << alignment;
-    buf_.insert(buf_.end(), flatbuffers::PaddingBytes(buf_.size(), byte_width),
-                0);
+    const size_t padding = flatbuffers::PaddingBytes(buf_.size(), byte_width);
+    FLATBUFFERS_BUILDER_STAT(stats_.padding_bytes += padding);
+    FLATBUFFERS_BUILDER_STAT(const size_t capacity = buf_.capacity();
+                             const size_t size = buf_.size());
+    buf_.insert(buf_.end(), padding, 0);
+    FLATBUFFERS_BUILDER_STAT(TrackGrowth(capacity, size));
     return static_cast<uint8_t>(byte_width);
   }
 
   void WriteBytes(const void* val, size_t size) {
+    FLATBUFFERS_BUILDER_STAT(const size_t capacity = buf_.capacity();
+                             const size_t buf_size = buf_.size());
     buf_.insert(buf_.end(), reinterpret_cast<const uint8_t*>(val),
                 reinterpret_cast<const uint8_t*>(val) + size);
+    FLATBUFFERS_BUILDER_STAT(TrackGrowth(capacity, buf_size));
+  }
+
+#ifdef FLATBUFFERS_BUILDER_STATS
+  // Counts a reallocation if the last write grew buf_ beyond `capacity`, which
+  // copied the `size` bytes it held.
+  void TrackGrowth(size_t capacity, size_t size) {
+    if (buf_.capacity() != capacity) stats_.AddReallocation(size);
   }
+#endif
 
   template <typename T>
   void Write(T val, size_t byte_width) {
@@ -1573,6 +1737,65 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     Write(reloff, byte_width);
   }
 
+  // Owns the vector of a released buffer for its DetachedBuffer, which frees
+  // it by deleting this.
+  class VectorOwner : public flatbuffers::Allocator {
+   public:
+    explicit VectorOwner(std::vector<uint8_t>&& buffer) {
+      buffer_.swap(buffer);
+    }
+
+    uint8_t* allocate(size_t) FLATBUFFERS_OVERRIDE {
+      FLATBUFFERS_ASSERT(false);
+      return nullptr;
+    }
+
+    void deallocate(uint8_t* p, size_t) FLATBUFFERS_OVERRIDE {
+      FLATBUFFERS_ASSERT(p == buffer_.data());
+      (void)p;
+      std::vector<uint8_t>().swap(buffer_);
+    }
+
+    std::vector<uint8_t> buffer_;
+  };
+
+  template <typename T>
+  static void WriteScalarTo(uint8_t* dst, T val, size_t byte_width) {
+    FLATBUFFERS_ASSERT(sizeof(T) >= byte_width);
+    val = flatbuffers::EndianScalar(val);
+    memcpy(dst, &val, byte_width);
+  }
+
+  // Makes room for the `len` elements of a streamed vector or map, and the
+  // `type_byte` of each if not 0, after the ones written so far.
+  size_t StartStreamed(Type vector_type, Type element_type, BitWidth bit_width,
+                       size_t len, uint8_t type_byte) {
+    // If you get this assert, the last streamed vector wasn't ended.
+    FLATBUFFERS_ASSERT(stream_end_ == 0);
+    const size_t vloc = buf_.size();
+    stream_vector_type_ = vector_type;
+    stream_element_type_ = element_type;
+    stream_bit_width_ = bit_width;
+    stream_byte_width_ = static_cast<uint8_t>(1U << bit_width);
+    stream_next_ = vloc;
+    stream_end_ = vloc + len * stream_byte_width_;
+    FLATBUFFERS_BUILDER_STAT(const size_t capacity = buf_.capacity());
+    buf_.resize(stream_end_);
+    if (type_byte) buf_.insert(buf_.end(), len, type_byte);
+    FLATBUFFERS_BUILDER_STAT(TrackGrowth(capacity, vloc));
+    return vloc;
+  }
+
+  size_t EndStreamed(size_t start) {
+    // If you get this assert, not all elements were added, or other values
+    // were added in between.
+    FLATBUFFERS_ASSERT(stream_next_ == stream_end_);
+    stack_.push_back(Value(static_cast<uint64_t>(start), stream_vector_type_,
+                           stream_bit_width_));
+    stream_next_ = stream_end_ = 0;
+    return start;
+  }
+
   template <typename T>
   void PushIndirect(T val, Type type, BitWidth bit_width) {
     auto byte_width = Align(bit_width);
@@ -1741,6 +1964,9 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     FLATBUFFERS_ASSERT(
         !fixed ||
         typed);  // typed=false, fixed=true combination is not supported.
+    // The stack is at its largest when a vector or map is being ended.
+    FLATBUFFERS_BUILDER_STAT(
+        stats_.TrackScratchSize(stack_.size() * sizeof(Value)));
     // Figure out smallest bit width we can store this vector with.
     auto bit_width = (std::max)(force_min_bit_width_, WidthU(vec_len));
     auto prefix_elems = 1;
@@ -1783,9 +2009,12 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     }
     // Then the types.
     if (!typed) {
+      FLATBUFFERS_BUILDER_STAT(const size_t capacity = buf_.capacity();
+                               const size_t size = buf_.size());
       for (size_t i = start; i < stack_.size(); i += step) {
         buf_.push_back(stack_[i].StoredPackedType(bit_width));
       }
+      FLATBUFFERS_BUILDER_STAT(TrackGrowth(capacity, size));
     }
     return Value(static_cast<uint64_t>(vloc),
                  keys ? FBT_MAP
@@ -1808,6 +2037,16 @@ class Builder FLATBUFFERS_FINAL_CLASS {
 
   BitWidth force_min_bit_width_;
 
+  // The streamed vector or map being added to: the types of it and its
+  // elements, their width, and the offsets of the next element and after the
+  // last one (0 if none).
+  Type stream_vector_type_;
+  Type stream_element_type_;
+  BitWidth stream_bit_width_;
+  uint8_t stream_byte_width_;
+  size_t stream_next_;
+  size_t stream_end_;
+
   struct KeyOffsetCompare {
     explicit KeyOffsetCompare(const std::vector<uint8_t>& buf) : buf_(&buf) {}
     bool operator()(size_t a, size_t b) const {
@@ -1837,9 +2076,140 @@ class Builder FLATBUFFERS_FINAL_CLASS {
   KeyOffsetMap key_pool;
   StringOffsetMap string_pool;
 
+#ifdef FLATBUFFERS_BUILDER_STATS
+  flatbuffers::BuilderStats stats_;
+#endif
+
   friend class Verifier;
 };
 
+// Remembers which offsets of a FlexBuffer the Verifier has already verified,
+// and as what type. The dense std::vector<uint8_t> tracker takes one byte per
+// buffer byte, and is cleared on every verification. This one is a two level
+// bitmap instead: the buffer is split into pages, which are only allocated
+// once the Verifier visits them, with a bit per offset. Most offsets are only
+// visited once, so their type is only recorded when they are visited again,
+// in a hash table of the shared offsets, with the most recent ones cached in
+// front of it. So it takes an eighth of the memory of the dense tracker (and
+// none for parts of a buffer without vectors, strings or keys, like large
+// blobs) plus a little per shared offset, and is about as fast: faster than
+// verifying without a tracker even if only keys are shared (see
+// benchmarks/cpp/flexbuffers/verifier_bench.cpp). Unlike with the dense
+// tracker, shared data is verified twice rather than once, and a buffer using
+// it as two different types is only rejected from the third use on.
+class ReuseTracker FLATBUFFERS_FINAL_CLASS {
+ public:
+  ReuseTracker() : num_used_pages_(0), num_shared_(0), shift_(0) {
+    std::fill(recent_, recent_ + kRecent, uint64_t(0));
+  }
+
+  // Forgets all offsets, and prepares for a buffer of `size` bytes.
+  void Reset(size_t size) {
+    pages_.assign((size >> kPageBits) + 1, nullptr);
+    num_used_pages_ = 0;
+    if (num_shared_) {
+      std::fill(shared_.begin(), shared_.end(), uint64_t(0));
+      num_shared_ = 0;
+    }
+    std::fill(recent_, recent_ + kRecent, uint64_t(0));
+  }
+
+  // Records `packed_type` for `offset` (less than the size given to Reset()),
+  // unless one was recorded before. Returns the previously recorded packed
+  // type, or 0 if there was none, which it is on the first visit.
+  uint8_t Insert(size_t offset, uint8_t packed_type) {
+    FLATBUFFERS_ASSERT((offset >> kPageBits) < pages_.size());
+    const uint64_t key = (static_cast<uint64_t>(offset) + 1) << 8;
+    const uint64_t recent = recent_[offset & (kRecent - 1)];
+    if ((recent & ~uint64_t(0xFF)) == key) return static_cast<uint8_t>(recent);
+    uint64_t* bits = pages_[offset >> kPageBits];
+    if (!bits) bits = UsePage(offset >> kPageBits);
+    auto& word = bits[(offset & kPageMask) >> 6];
+    const uint64_t bit = uint64_t(1) << (offset & 63);
+    if (!(word & bit)) {
+      word |= bit;
+      return 0;
+    }
+    return InsertShared(key, packed_type);
+  }
+
+  // Bytes allocated for the pages and the shared offsets.
+  size_t memory_usage() const {
+    return pages_.capacity() * sizeof(uint64_t*) +
+           pages_storage_.size() * kPageWords * sizeof(uint64_t) +
+           shared_.capacity() * sizeof(uint64_t);
+  }
+
+ private:
+  static const size_t kPageBits = 15;
+  static const size_t kPageMask = (size_t(1) << kPageBits) - 1;
+  static const size_t kPageWords = (kPageMask + 1) / 64;
+  static const size_t kRecent = 64;
+
+  FLATBUFFERS_NOINLINE uint64_t* UsePage(size_t page_index) {
+    if (num_used_pages_ == pages_storage_.size()) {
+      pages_storage_.emplace_back(new uint64_t[kPageWords]);
+    }
+    uint64_t* bits = pages_storage_[num_used_pages_++].get();
+    std::fill(bits, bits + kPageWords, uint64_t(0));
+    return pages_[page_index] = bits;
+  }
+
+  // Looks up `key` (the offset + 1 shifted by 8) in the shared offsets, or
+  // records `packed_type` for it.
+  FLATBUFFERS_NOINLINE uint8_t InsertShared(uint64_t key,
+                                            uint8_t packed_type) {
+    // Grow when 3/4 full.
+    if (num_shared_ >= shared_.size() / 4 * 3) Grow();
+    const size_t mask = shared_.size() - 1;
+    auto& recent = recent_[((key >> 8) - 1) & (kRecent - 1)];
+    for (size_t i = Hash(key);; i = (i + 1) & mask) {
+      const uint64_t slot = shared_[i];
+      if (!slot) {
+        shared_[i] = recent = key | packed_type;
+        num_shared_++;
+        return 0;
+      }
+      if ((slot & ~uint64_t(0xFF)) == key) {
+        recent = slot;
+        return static_cast<uint8_t>(slot);
+      }
+    }
+  }
+
+  size_t Hash(uint64_t key) const {
+    return static_cast<size_t>(
+        (static_cast<uint32_t>(key >> 8) * 0x9E3779B1u) >> shift_);
+  }
+
+  FLATBUFFERS_NOINLINE void Grow() {
+    std::vector<uint64_t> old(shared_.empty() ? 16 : shared_.size() * 2, 0);
+    old.swap(shared_);
+    shift_ = 32;
+    for (size_t size = shared_.size(); size > 1; size >>= 1) shift_--;
+    for (auto slot : old) {
+      if (!slot) continue;
+      size_t i = Hash(slot);
+      while (shared_[i]) i = (i + 1) & (shared_.size() - 1);
+      shared_[i] = slot;
+    }
+  }
+
+  // The bitmap of each page, nullptr until visited, and the storage of the
+  // bitmaps, of which the first `num_used_pages_` are in use.
+  std::vector<uint64_t*> pages_;
+  std::vector<std::unique_ptr<uint64_t[]>> pages_storage_;
+  size_t num_used_pages_;
+  // An open addressing hash table of the offsets visited more than once, each
+  // slot (offset + 1) << 8 | packed type, or 0 if empty.
+  std::vector<uint64_t> shared_;
+  size_t num_shared_;
+  unsigned shift_;
+  // The slots last found in (or added to) `shared_`, by the low bits of their
+  // offset.
+  uint64_t recent_[kRecent];
+};
+
 // Helper class to verify the integrity of a FlexBuffer
 class Verifier FLATBUFFERS_FINAL_CLASS {
  public:
@@ -1848,6 +2218,7 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
            // of larger buffers with many shared keys/strings, but
            // comes at the cost of using additional memory the same size of
            // the buffer being verified, so it is by default off.
+           // See ReuseTracker above for a more compact alternative.
            std::vector<uint8_t>* reuse_tracker = nullptr,
            bool _check_alignment = true, size_t max_depth = 64)
       : buf_(buf),
@@ -1857,7 +2228,8 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
         num_vectors_(0),
         max_vectors_(buf_len),
         check_alignment_(_check_alignment),
-        reuse_tracker_(reuse_tracker) {
+        reuse_tracker_(reuse_tracker),
+        compact_reuse_tracker_(nullptr) {
     FLATBUFFERS_ASSERT(static_cast<int32_t>(size_) <
                        FLATBUFFERS_MAX_BUFFER_SIZE);
     if (reuse_tracker_) {
@@ -1866,6 +2238,15 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     }
   }
 
+  // Same, but tracks reuse in a ReuseTracker, whose memory use depends on the
+  // number of vectors, strings and keys rather than on the buffer size.
+  Verifier(const uint8_t* buf, size_t buf_len, ReuseTracker& reuse_tracker,
+           bool _check_alignment = true, size_t max_depth = 64)
+      : Verifier(buf, buf_len, nullptr, _check_alignment, max_depth) {
+    compact_reuse_tracker_ = &reuse_tracker;
+    compact_reuse_tracker_->Reset(buf_len);
+  }
+
  private:
   // Central location where any verification failures register.
   bool Check(bool ok) const {
@@ -1911,27 +2292,35 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   }
 
 // Macro, since we want to escape from parent function & use lazy args.
-#define FLEX_CHECK_VERIFIED(P, PACKED_TYPE)                     \
-  if (reuse_tracker_) {                                         \
-    auto packed_type = PACKED_TYPE;                             \
-    auto existing = (*reuse_tracker_)[P - buf_];                \
-    if (existing == packed_type) return true;                   \
-    /* Fail verification if already set with different type! */ \
-    if (!Check(existing == 0)) return false;                    \
-    (*reuse_tracker_)[P - buf_] = packed_type;                  \
+#define FLEX_CHECK_VERIFIED(P, PACKED_TYPE)                           \
+  if (reuse_tracker_) {                                               \
+    auto packed_type = PACKED_TYPE;                                   \
+    auto existing = (*reuse_tracker_)[P - buf_];                      \
+    if (existing == packed_type) return true;                         \
+    /* Fail verification if already set with different type! */       \
+    if (!Check(existing == 0)) return false;                          \
+    (*reuse_tracker_)[P - buf_] = packed_type;                        \
+  } else if (compact_reuse_tracker_) {                                \
+    auto packed_type = PACKED_TYPE;                                   \
+    auto existing = compact_reuse_tracker_->Insert(                   \
+        static_cast<size_t>(P - buf_), packed_type);                 \
+    if (existing == packed_type) return true;                         \
+    if (!Check(existing == 0)) return false;                          \
   }
 
   bool VerifyVector(Reference r, const uint8_t* p, Type elem_type) {
     // Any kind of nesting goes thru this function, so guard against that
     // here, both with simple nesting checks, and the reuse tracker if on.
-    depth_++;
+    // Every vector counts towards max_vectors_, also those the tracker skips
+    // as already verified, but only the ones verified here nest deeper.
     num_vectors_++;
-    if (!Check(depth_ <= max_depth_ && num_vectors_ <= max_vectors_))
-      return false;
+    if (!Check(num_vectors_ <= max_vectors_)) return false;
     auto size_byte_width = r.byte_width_;
     if (!VerifyBeforePointer(p, size_byte_width)) return false;
     FLEX_CHECK_VERIFIED(p - size_byte_width,
                         PackedType(Builder::WidthB(size_byte_width), r.type_));
+    depth_++;
+    if (!Check(depth_ <= max_depth_)) return false;
     auto sized = Sized(p, size_byte_width);
     auto num_elems = sized.size();
     auto elem_byte_width = r.type_ == FBT_STRING || r.type_ == FBT_BLOB
@@ -2067,6 +2456,7 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   const size_t max_vectors_;
   bool check_alignment_;
   std::vector<uint8_t>* reuse_tracker_;
+  ReuseTracker* compact_reuse_tracker_;
 };
 
 // Utility function that constructs the Verifier for you, see above for
@@ -2077,6 +2467,12 @@ inline bool VerifyBuffer(const uint8_t* buf, size_t buf_len,
   return verifier.VerifyBuffer();
 }
 
+inline bool VerifyBuffer(const uint8_t* buf, size_t buf_len,
+                         ReuseTracker& reuse_tracker) {
+  Verifier verifier(buf, buf_len, reuse_tracker);
+  return verifier.VerifyBuffer();
+}
+
 }  // namespace flexbuffers
 
 #if defined(_MSC_VER)
@@ -19,6 +19,12 @@
 
 // Helper functionality to glue FlatBuffers and GRPC.
 
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "flatbuffers/flatbuffers.h"
 #include "grpcpp/support/byte_buffer.h"
 #include "grpcpp/support/slice.h"
@@ -67,6 +73,150 @@ class Message {
   ::grpc::Slice slice_;
 };
 
+// MessageBufferPool recycles the contiguous buffers that messages which
+// arrive as more than one slice are reassembled into. A FlatBuffer has to be
+// contiguous to be verified and read, so a multi-slice `ByteBuffer` is copied
+// once into a pooled buffer instead of into a freshly allocated slice per
+// call. The buffer goes back to the pool when the last slice referring to it
+// is released; the pool itself may be destroyed before that.
+// A request gets the smallest free buffer that is large enough. The pool
+// keeps at most `max_free_buffers` buffers of `max_free_bytes` in total, and
+// frees buffers returned beyond that.
+class MessageBufferPool {
+ public:
+  explicit MessageBufferPool(size_t max_free_buffers = 4,
+                             size_t max_free_bytes = 1 << 20)
+      : state_(std::make_shared<State>(max_free_buffers, max_free_bytes)) {}
+
+  MessageBufferPool(const MessageBufferPool& other) = delete;
+  MessageBufferPool& operator=(const MessageBufferPool& other) = delete;
+
+  // The pool used to deserialize `Message`s.
+  static MessageBufferPool& Default() {
+    static MessageBufferPool pool;
+    return pool;
+  }
+
+  // Returns a slice of `size` bytes, backed by a recycled buffer if one that
+  // is large enough is available.
+  ::grpc::Slice Allocate(size_t size) {
+    Block* block = state_->Take(size);
+    if (block) {
+      block->state = state_;
+    } else {
+      block = new Block(state_, size);
+    }
+    return ::grpc::Slice(block->data.get(), size, &Block::Release, block);
+  }
+
+  // Copies `slices` back to back into a single pooled slice.
+  ::grpc::Slice Join(const std::vector<::grpc::Slice>& slices) {
+    size_t size = 0;
+    for (const auto& slice : slices) size += slice.size();
+    ::grpc::Slice joined = Allocate(size);
+    uint8_t* dst = const_cast<uint8_t*>(joined.begin());
+    for (const auto& slice : slices) {
+      if (slice.size()) memcpy(dst, slice.begin(), slice.size());
+      dst += slice.size();
+    }
+    return joined;
+  }
+
+  // Changes how many bytes of free buffers the pool keeps, freeing the
+  // largest of those it has until they fit.
+  void set_max_free_bytes(size_t max_free_bytes) {
+    std::vector<Block*> evicted;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->max_free_bytes = max_free_bytes;
+      while (state_->free_bytes > max_free_bytes) {
+        auto largest = std::prev(state_->free.end());
+        state_->free_bytes -= largest->first;
+        evicted.push_back(largest->second);
+        state_->free.erase(largest);
+      }
+    }
+    for (auto block : evicted) delete block;
+  }
+
+  // Number of buffers currently waiting to be reused.
+  size_t free_buffers() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->free.size();
+  }
+
+  // Total size of the buffers currently waiting to be reused.
+  size_t free_bytes() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->free_bytes;
+  }
+
+ private:
+  struct State;
+
+  struct Block {
+    Block(std::shared_ptr<State> s, size_t size)
+        : state(std::move(s)), capacity(size), data(new uint8_t[size]) {}
+
+    static void Release(void* p) {
+      Block* block = static_cast<Block*>(p);
+      // Keep the state alive while the block is handed back to it.
+      std::shared_ptr<State> state = block->state;
+      state->Give(block);
+    }
+
+    std::shared_ptr<State> state;
+    size_t capacity;
+    std::unique_ptr<uint8_t[]> data;
+  };
+
+  struct State {
+    State(size_t max_buffers, size_t max_bytes)
+        : free_bytes(0), max_free(max_buffers), max_free_bytes(max_bytes) {}
+
+    ~State() {
+      for (auto& entry : free) delete entry.second;
+    }
+
+    Block* Take(size_t size) {
+      std::lock_guard<std::mutex> lock(mutex);
+      // The smallest block that fits, leaving larger ones for larger
+      // messages.
+      auto it = free.lower_bound(size);
+      if (it == free.end()) return nullptr;
+      Block* block = it->second;
+      free_bytes -= it->first;
+      free.erase(it);
+      return block;
+    }
+
+    void Give(Block* block) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (free.size() < max_free &&
+            block->capacity <= max_free_bytes - free_bytes) {
+          // Free blocks don't keep the state alive, so it can go away
+          // together with the pool.
+          block->state.reset();
+          free_bytes += block->capacity;
+          free.emplace(block->capacity, block);
+          return;
+        }
+      }
+      delete block;
+    }
+
+    mutable std::mutex mutex;
+    // The free blocks by capacity.
+    std::multimap<size_t, Block*> free;
+    size_t free_bytes;
+    size_t max_free;
+    size_t max_free_bytes;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
 class MessageBuilder;
 
 // SliceAllocator is a gRPC-specific allocator that uses the `grpc_slice`
@@ -273,15 +423,18 @@ class SerializationTraits<flatbuffers::grpc::Message<T>> {
     return grpc::Status::OK;
   }
 
-  // Deserialize by pulling the
+  // Deserialize by referencing the payload's slice. A payload that arrived
+  // in several slices is joined into a buffer from the MessageBufferPool.
   static grpc::Status Deserialize(ByteBuffer* buf,
                                   flatbuffers::grpc::Message<T>* msg) {
     Slice slice;
     if (!buf->TrySingleSlice(&slice).ok()) {
-      if (!buf->DumpToSingleSlice(&slice).ok()) {
+      std::vector<Slice> slices;
+      if (!buf->Dump(&slices).ok()) {
         buf->Clear();
         return ::grpc::Status(::grpc::StatusCode::INTERNAL, "No payload");
       }
+      slice = flatbuffers::grpc::MessageBufferPool::Default().Join(slices);
     }
     *msg = flatbuffers::grpc::Message<T>(slice);
     buf->Clear();
@@ -673,6 +673,7 @@ struct IDLOptions {
   bool generate_name_strings;
   bool generate_object_based_api;
   bool gen_compare;
+  bool gen_packed_size;
   bool gen_absl_hash;
   std::string cpp_object_api_pointer_type;
   std::string cpp_object_api_string_type;
@@ -707,6 +708,8 @@ struct IDLOptions {
   std::vector<std::string> cpp_includes;
   std::string cpp_std;
   bool cpp_static_reflection;
+  bool cpp_static_vtables;
+  bool cpp_pmr;
   std::string proto_namespace_suffix;
   std::string filename_suffix;
   std::string filename_extension;
@@ -767,6 +770,7 @@ struct IDLOptions {
     kNim = 1 << 17,
     kProto = 1 << 18,
     kKotlinKmp = 1 << 19,
+    kLayoutReport = 1 << 20,
     kMAX
   };
 
@@ -829,6 +833,7 @@ struct IDLOptions {
         generate_name_strings(false),
         generate_object_based_api(false),
         gen_compare(false),
+        gen_packed_size(false),
         gen_absl_hash(false),
         cpp_object_api_pointer_type("std::unique_ptr"),
         cpp_object_api_string_flexible_constructor(false),
@@ -853,6 +858,8 @@ struct IDLOptions {
         java_primitive_has_method(false),
         cs_gen_json_serializer(false),
         cpp_static_reflection(false),
+        cpp_static_vtables(false),
+        cpp_pmr(false),
         filename_suffix("_generated"),
         filename_extension(),
         no_warnings(false),
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_PMR_H_
+#define FLATBUFFERS_PMR_H_
+
+// Support for the object-based API generated with `flatc --cpp-pmr`, where
+// native objects and everything they own are allocated from a
+// std::pmr::memory_resource, e.g. a std::pmr::monotonic_buffer_resource that
+// frees a whole unpacked object graph at once. Requires C++17.
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace flatbuffers {
+
+// Deleter for objects allocated from a memory_resource. A null resource means
+// the object was allocated with new, which is what the object-based API does
+// for objects it creates outside of UnPack(), such as copies.
+template <typename T>
+struct pmr_delete {
+  pmr_delete() = default;
+  explicit pmr_delete(std::pmr::memory_resource* r) : resource(r) {}
+
+  void operator()(T* p) const {
+    if (resource) {
+      std::pmr::polymorphic_allocator<T> alloc(resource);
+      std::allocator_traits<decltype(alloc)>::destroy(alloc, p);
+      alloc.deallocate(p, 1);
+    } else {
+      delete p;
+    }
+  }
+
+  std::pmr::memory_resource* resource = nullptr;
+};
+
+template <typename T>
+using pmr_unique_ptr = std::unique_ptr<T, pmr_delete<T>>;
+
+// Allocate and construct a T from `resource`. Allocator aware types, such as
+// the generated native tables, are handed the resource as well.
+template <typename T, typename... Args>
+pmr_unique_ptr<T> pmr_make_unique(std::pmr::memory_resource* resource,
+                                  Args&&... args) {
+  std::pmr::polymorphic_allocator<T> alloc(resource);
+  T* p = alloc.allocate(1);
+  alloc.construct(p, std::forward<Args>(args)...);
+  return pmr_unique_ptr<T>(p, pmr_delete<T>(resource));
+}
+
+// Base of the native tables generated with --cpp-pmr. It remembers the
+// memory_resource the table's strings, vectors and sub-tables are allocated
+// from. Like the std::pmr containers, copies use the default resource and
+// assignment keeps the resource of the target.
+struct PmrNativeTable : public NativeTable {
+  typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+  PmrNativeTable() = default;
+  explicit PmrNativeTable(const allocator_type& alloc) : allocator_(alloc) {}
+  PmrNativeTable(const PmrNativeTable&) {}
+  PmrNativeTable(PmrNativeTable&& o) FLATBUFFERS_NOEXCEPT
+      : allocator_(o.allocator_) {}
+  PmrNativeTable& operator=(const PmrNativeTable&) { return *this; }
+
+  allocator_type get_allocator() const { return allocator_; }
+
+ private:
+  allocator_type allocator_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_PMR_H_
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_RECORD_STREAM_H_
+#define FLATBUFFERS_RECORD_STREAM_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+
+// Record streams are files holding a sequence of FlatBuffers (records), such
+// as an append-only log, that can be read sequentially as well as by record
+// number. All integers are little endian. A stream consists of:
+//
+//  - A 16 byte header: "FBRS", the format version (uint32, 1), flags (uint32,
+//    kRecordStreamChecksums) and the alignment of the records (uint32, a
+//    power of 2 of at least 4).
+//  - The records, each starting at a multiple of the alignment: a size
+//    prefixed FlatBuffer (as written by FinishSizePrefixed()). With
+//    kRecordStreamChecksums it is followed by the CRC-32C of its bytes (the
+//    size prefix included), at the next multiple of 4.
+//  - The index, once the stream is closed, at the next multiple of 8: the
+//    offset in the file (uint64) of every `index_interval`th record, followed
+//    by the number of records (uint64), the offset of the index (uint64), the
+//    index interval (uint32) and "FBRI".
+//
+// A stream without an index, e.g. because the program writing it crashed,
+// can still be read: RecordStreamReader then scans it for the records, and
+// ignores an incomplete last record. It also reads files that are just
+// size-prefixed FlatBuffers one after the other, as many logs are.
+
+namespace flatbuffers {
+
+enum RecordStreamFlags {
+  kRecordStreamChecksums = 1,
+};
+
+// Computes the CRC-32C (Castagnoli) of `size` bytes, as used in record
+// streams.
+uint32_t Crc32c(const uint8_t* data, size_t size);
+
+struct RecordStreamOptions {
+  // The records start at a multiple of this, a power of 2 of at least 4.
+  // Must be at least the largest alignment in the records, for them to be
+  // read in place.
+  size_t alignment;
+  // Whether to store a checksum with every record.
+  bool checksums;
+  // The index stores the offset of every `index_interval`th record, so
+  // reading record i by number steps over at most `index_interval - 1`
+  // records. 1 makes the index store every record.
+  uint32_t index_interval;
+  // The bytes kept in memory before they are written to the file.
+  size_t batch_size;
+
+  RecordStreamOptions()
+      : alignment(8),
+        checksums(true),
+        index_interval(64),
+        batch_size(1 << 16) {}
+};
+
+// Writes a record stream file. The records are appended in memory and
+// written to the file in batches, the index when the stream is closed.
+// Errors are sticky: once writing failed, all further calls fail.
+class RecordStreamWriter {
+ public:
+  explicit RecordStreamWriter(
+      const RecordStreamOptions& options = RecordStreamOptions());
+  ~RecordStreamWriter() { Close(); }
+
+  // Creates (or truncates) `filename`, and writes the header to it.
+  bool Open(const std::string& filename);
+
+  // Appends a FlatBuffer finished by FinishSizePrefixed() as the next record.
+  // It is stored as is, as its alignment depends on the size prefix.
+  bool Append(const uint8_t* buffer);
+
+  // Appends the buffer finished by `builder` with FinishSizePrefixed().
+  bool Append(const FlatBufferBuilder& builder) {
+    return Append(builder.GetBufferPointer());
+  }
+
+  // Writes the records appended so far to the file.
+  bool Flush();
+
+  // Writes the index and closes the file. Returns whether the whole stream
+  // was written successfully.
+  bool Close();
+
+  // The number of records appended.
+  size_t size() const { return static_cast<size_t>(num_records_); }
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(RecordStreamWriter(const RecordStreamWriter&));
+  FLATBUFFERS_DELETE_FUNC(
+      RecordStreamWriter& operator=(const RecordStreamWriter&));
+
+  template <typename T>
+  void Write(T value) {
+    uint8_t bytes[sizeof(T)];
+    WriteScalar(bytes, value);
+    pending_.insert(pending_.end(), bytes, bytes + sizeof(T));
+  }
+
+  void Pad(size_t alignment);
+
+  uint64_t position() const { return written_ + pending_.size(); }
+
+  RecordStreamOptions options_;
+  FILE* file_;
+  bool ok_;
+  std::vector<uint8_t> pending_;
+  uint64_t written_;
+  uint64_t num_records_;
+  std::vector<uint64_t> index_;
+};
+
+// Reads a record stream (or a file of size-prefixed FlatBuffers one after the
+// other) in place, from a file mapped into memory or from memory.
+class RecordStreamReader {
+ public:
+  // A FlatBuffer stored in the stream, without its size prefix. `data` is
+  // nullptr for records that don't exist or are damaged.
+  struct Record {
+    const uint8_t* data;
+    size_t size;
+
+    Record() : data(nullptr), size(0) {}
+    Record(const uint8_t* record_data, size_t record_size)
+        : data(record_data), size(record_size) {}
+  };
+
+  // Iterates over the records in order, getting from one to the next in
+  // constant time.
+  class Iterator {
+   public:
+    Iterator(const RecordStreamReader* reader, size_t index, size_t position)
+        : reader_(reader), index_(index), position_(position) {}
+
+    Record operator*() const { return reader_->RecordAt(position_); }
+
+    Iterator& operator++() {
+      index_++;
+      position_ = reader_->NextPosition(position_);
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    // The number of the record this is at.
+    size_t index() const { return index_; }
+
+   private:
+    const RecordStreamReader* reader_;
+    size_t index_;
+    size_t position_;
+  };
+
+  RecordStreamReader();
+  ~RecordStreamReader() { Close(); }
+
+  // Maps `filename` into memory (or loads it, on platforms without support
+  // for that), and reads its header and index. Returns false if the file
+  // can't be read, or isn't a supported record stream.
+  bool Open(const std::string& filename);
+
+  // Reads a stream that is in memory already, which must outlive the reader,
+  // and start at a multiple of the alignment of its records.
+  bool Open(const uint8_t* data, size_t size);
+
+  void Close();
+
+  // The number of records.
+  size_t size() const { return num_records_; }
+
+  // Whether the records have checksums.
+  bool has_checksums() const { return (flags_ & kRecordStreamChecksums) != 0; }
+
+  // Whether the stream has an index, i.e. was closed properly.
+  bool has_index() const { return has_index_; }
+
+  // Returns record `i`, stepping over at most `index_interval - 1` records
+  // from the closest one in the index.
+  Record Get(size_t i) const { return *At(i); }
+
+  // Returns the root of record `i`, or nullptr if it doesn't exist. Use
+  // VerifyRecord() first if the stream isn't trusted.
+  template <typename T>
+  const T* GetRoot(size_t i) const {
+    const Record record = Get(i);
+    return record.data ? flatbuffers::GetRoot<T>(record.data) : nullptr;
+  }
+
+  // Whether the checksum of `record` matches its contents, or the stream has
+  // no checksums.
+  bool CheckRecord(const Record& record) const;
+
+  // Checks the checksum of record `i`, then verifies it as a size-prefixed
+  // buffer with root type `T`.
+  template <typename T>
+  bool VerifyRecord(size_t i, const char* identifier = nullptr,
+                    const Verifier::Options& options = Verifier::Options())
+      const {
+    const Record record = Get(i);
+    if (!record.data || !CheckRecord(record)) return false;
+    Verifier verifier(record.data - sizeof(uoffset_t),
+                      record.size + sizeof(uoffset_t), options);
+    return verifier.VerifySizePrefixedBuffer<T>(identifier);
+  }
+
+  Iterator begin() const { return Iterator(this, 0, records_begin_); }
+  Iterator end() const { return Iterator(this, num_records_, records_end_); }
+
+  // Returns an iterator at record `i`, or end() if there is no such record.
+  Iterator At(size_t i) const;
+
+  // Calls `f(i, record)` for the records [begin, end). Threads can each
+  // iterate over a different range of the same reader in parallel.
+  template <typename F>
+  void ForEach(size_t begin, size_t end, F f) const {
+    if (end > num_records_) end = num_records_;
+    for (Iterator it = At(begin); it.index() < end; ++it) f(it.index(), *it);
+  }
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(RecordStreamReader(const RecordStreamReader&));
+  FLATBUFFERS_DELETE_FUNC(
+      RecordStreamReader& operator=(const RecordStreamReader&));
+
+  bool Parse(const uint8_t* data, size_t size);
+  bool ReadIndex();
+  void ScanRecords();
+  Record RecordAt(size_t position) const;
+  size_t NextPosition(size_t position) const;
+
+  const uint8_t* data_;
+  size_t size_;
+  void* mapping_;
+  std::string contents_;
+  uint32_t flags_;
+  size_t alignment_;
+  bool has_index_;
+  size_t records_begin_;
+  size_t records_end_;
+  size_t num_records_;
+  size_t index_interval_;
+  std::vector<size_t> index_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_RECORD_STREAM_H_
@@ -28,6 +28,108 @@
 
 namespace flatbuffers {
 
+// ------------------------- COMPILED SCHEMAS -------------------------
+
+// A schema (e.g. loaded from a .bfbs file) indexed once for fast lookups:
+// objects, enums and fields are found by name through hash tables rather than
+// by binary search, union fields know their type field and the object of each
+// of their types, and each field caches what accessing it needs. The overloads
+// below taking its fields and objects don't read the schema at all.
+// The schema must outlive it.
+class CompiledSchema {
+  // Open addressing hash tables from names to the index of their definition:
+  // each slot holds the hash of the name, and the index + 1 (0 if empty).
+  typedef std::vector<std::pair<uint32_t, uint32_t>> NameIndex;
+
+ public:
+  struct Object;
+
+  struct Enum {
+    const reflection::Enum* def;
+    // For unions, indexed by the value of each union type: its base type (Obj
+    // or String, None for NONE and values that aren't in the union), and its
+    // table or struct (nullptr if it isn't one).
+    std::vector<reflection::BaseType> union_base_types;
+    std::vector<const Object*> union_types;
+  };
+
+  struct Field {
+    const reflection::Field* def;
+    voffset_t offset;
+    reflection::BaseType base_type;
+    // The type of the elements of vectors, None for other fields.
+    reflection::BaseType element;
+    // The index of the object or enum of the type, -1 if it has none.
+    int type_index;
+    // The size of the field inline in its table or struct.
+    size_t size;
+    // The size of the elements of vectors inline in the vector.
+    size_t element_size;
+    bool required;
+    int64_t default_integer;
+    double default_real;
+    // The table or struct of object fields and vectors of objects.
+    const Object* object;
+    // The enum of enum and union fields, and vectors of them.
+    const Enum* enum_def;
+    // The field holding the type of union fields and vectors of unions.
+    const Field* union_type;
+  };
+
+  struct Object {
+    const reflection::Object* def;
+    bool is_struct;
+    size_t bytesize;
+    size_t minalign;
+    // The fields, in the order of the schema (by name).
+    std::vector<Field> fields;
+
+    // Returns the field called `name`, or nullptr if there is none.
+    const Field* LookupField(const char* name) const;
+    const Field* LookupField(const std::string& name) const {
+      return LookupField(name.c_str());
+    }
+
+   private:
+    friend class CompiledSchema;
+    NameIndex field_index_;
+  };
+
+  explicit CompiledSchema(const reflection::Schema& schema);
+
+  const reflection::Schema& schema() const { return schema_; }
+
+  // The objects and enums in the order of the schema, such that a
+  // reflection::Type index() indexes them.
+  const std::vector<Object>& objects() const { return objects_; }
+  const std::vector<Enum>& enums() const { return enums_; }
+
+  // The root table, nullptr if the schema has none.
+  const Object* root_table() const { return root_table_; }
+
+  // Returns the object or enum with the fully qualified name `name` (e.g.
+  // "MyGame.Example.Monster"), or nullptr if there is none.
+  const Object* LookupObject(const char* name) const;
+  const Object* LookupObject(const std::string& name) const {
+    return LookupObject(name.c_str());
+  }
+  const Enum* LookupEnum(const char* name) const;
+  const Enum* LookupEnum(const std::string& name) const {
+    return LookupEnum(name.c_str());
+  }
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(CompiledSchema(const CompiledSchema&));
+  FLATBUFFERS_DELETE_FUNC(CompiledSchema& operator=(const CompiledSchema&));
+
+  const reflection::Schema& schema_;
+  std::vector<Object> objects_;
+  std::vector<Enum> enums_;
+  NameIndex object_index_;
+  NameIndex enum_index_;
+  const Object* root_table_;
+};
+
 // ------------------------- GETTERS -------------------------
 
 constexpr bool IsScalar(reflection::BaseType t) {
@@ -242,6 +344,47 @@ inline std::string GetAnyFieldS(const Struct& st,
                       st.GetAddressOf(field.offset()), nullptr, -1);
 }
 
+// The same, for the fields of a CompiledSchema.
+inline int64_t GetAnyFieldI(const Table& table,
+                            const CompiledSchema::Field& field) {
+  auto field_ptr = table.GetAddressOf(field.offset);
+  return field_ptr ? GetAnyValueI(field.base_type, field_ptr)
+                   : field.default_integer;
+}
+
+inline double GetAnyFieldF(const Table& table,
+                           const CompiledSchema::Field& field) {
+  auto field_ptr = table.GetAddressOf(field.offset);
+  return field_ptr ? GetAnyValueF(field.base_type, field_ptr)
+                   : field.default_real;
+}
+
+inline std::string GetAnyFieldS(const Table& table,
+                                const CompiledSchema::Field& field,
+                                const CompiledSchema* schema) {
+  auto field_ptr = table.GetAddressOf(field.offset);
+  return field_ptr ? GetAnyValueS(field.base_type, field_ptr,
+                                  schema ? &schema->schema() : nullptr,
+                                  field.type_index)
+                   : "";
+}
+
+inline int64_t GetAnyFieldI(const Struct& st,
+                            const CompiledSchema::Field& field) {
+  return GetAnyValueI(field.base_type, st.GetAddressOf(field.offset));
+}
+
+inline double GetAnyFieldF(const Struct& st,
+                           const CompiledSchema::Field& field) {
+  return GetAnyValueF(field.base_type, st.GetAddressOf(field.offset));
+}
+
+inline std::string GetAnyFieldS(const Struct& st,
+                                const CompiledSchema::Field& field) {
+  return GetAnyValueS(field.base_type, st.GetAddressOf(field.offset), nullptr,
+                      -1);
+}
+
 // Get any vector element as a 64bit int, regardless of what type it is.
 inline int64_t GetAnyVectorElemI(const VectorOfAny* vec,
                                  reflection::BaseType elem_type, size_t i) {
@@ -375,6 +518,46 @@ inline void SetAnyFieldS(Struct* st, const reflection::Field& field,
                val);
 }
 
+// The same, for the fields of a CompiledSchema.
+inline bool SetAnyFieldI(Table* table, const CompiledSchema::Field& field,
+                         int64_t val) {
+  auto field_ptr = table->GetAddressOf(field.offset);
+  if (!field_ptr) return val == field.default_integer;
+  SetAnyValueI(field.base_type, field_ptr, val);
+  return true;
+}
+
+inline bool SetAnyFieldF(Table* table, const CompiledSchema::Field& field,
+                         double val) {
+  auto field_ptr = table->GetAddressOf(field.offset);
+  if (!field_ptr) return val == field.default_real;
+  SetAnyValueF(field.base_type, field_ptr, val);
+  return true;
+}
+
+inline bool SetAnyFieldS(Table* table, const CompiledSchema::Field& field,
+                         const char* val) {
+  auto field_ptr = table->GetAddressOf(field.offset);
+  if (!field_ptr) return false;
+  SetAnyValueS(field.base_type, field_ptr, val);
+  return true;
+}
+
+inline void SetAnyFieldI(Struct* st, const CompiledSchema::Field& field,
+                         int64_t val) {
+  SetAnyValueI(field.base_type, st->GetAddressOf(field.offset), val);
+}
+
+inline void SetAnyFieldF(Struct* st, const CompiledSchema::Field& field,
+                         double val) {
+  SetAnyValueF(field.base_type, st->GetAddressOf(field.offset), val);
+}
+
+inline void SetAnyFieldS(Struct* st, const CompiledSchema::Field& field,
+                         const char* val) {
+  SetAnyValueS(field.base_type, st->GetAddressOf(field.offset), val);
+}
+
 // Set any vector element as a 64bit int, regardless of type what it is.
 inline void SetAnyVectorElemI(VectorOfAny* vec, reflection::BaseType elem_type,
                               size_t i, int64_t val) {
@@ -438,6 +621,16 @@ inline const reflection::Object& GetUnionType(
   return *schema.objects()->Get(enumval->union_type()->index());
 }
 
+// The same, for the fields of a CompiledSchema, without any lookups. Returns
+// nullptr if the union is NONE or a string.
+inline const CompiledSchema::Object* GetUnionType(
+    const CompiledSchema::Field& unionfield, const Table& table) {
+  FLATBUFFERS_ASSERT(unionfield.base_type == reflection::Union);
+  auto union_type = table.GetField<uint8_t>(unionfield.union_type->offset, 0);
+  auto& union_types = unionfield.enum_def->union_types;
+  return union_type < union_types.size() ? union_types[union_type] : nullptr;
+}
+
 // Changes the contents of a string inside a FlatBuffer. FlatBuffer must
 // live inside a std::vector so we can resize the buffer if needed.
 // "str" must live inside "flatbuf" and may be invalidated after this call.
@@ -512,6 +705,12 @@ Offset<const Table*> CopyTable(FlatBufferBuilder& fbb,
                                const Table& table,
                                bool use_string_pooling = false);
 
+// The same, for an object of a CompiledSchema.
+Offset<const Table*> CopyTable(FlatBufferBuilder& fbb,
+                               const CompiledSchema::Object& objectdef,
+                               const Table& table,
+                               bool use_string_pooling = false);
+
 // Verifies the provided flatbuffer using reflection.
 // root should point to the root type for this flatbuffer.
 // buf should point to the start of flatbuffer data.
@@ -525,6 +724,15 @@ bool VerifySizePrefixed(const reflection::Schema& schema,
                         size_t length, uoffset_t max_depth = 64,
                         uoffset_t max_tables = 1000000);
 
+// The same, for an object of a CompiledSchema.
+bool Verify(const CompiledSchema::Object& root, const uint8_t* buf,
+            size_t length, uoffset_t max_depth = 64,
+            uoffset_t max_tables = 1000000);
+
+bool VerifySizePrefixed(const CompiledSchema::Object& root, const uint8_t* buf,
+                        size_t length, uoffset_t max_depth = 64,
+                        uoffset_t max_tables = 1000000);
+
 }  // namespace flatbuffers
 
 #endif  // FLATBUFFERS_REFLECTION_H_
@@ -0,0 +1,435 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_STATIC_REFLECTION_H_
+#define FLATBUFFERS_STATIC_REFLECTION_H_
+
+// Generic visitors over the tables and structs of code generated with
+// `--cpp-static-reflection` (C++17). Where minireflect.h interprets a
+// TypeTable at runtime and makes a virtual call for every value, these iterate
+// over the fields listed in the generated `Traits` at compile time, reading
+// each with its accessor, so the visitor is inlined into the loop:
+//
+//  - ForEachField() and ForEachPresentField() call a function with the name
+//    and value of each field.
+//  - ToJson() prints a table or struct as (compact) JSON.
+//  - HashObject() and ObjectsEqual() hash and compare them by value.
+//
+// Enums are named with, and the values of unions reached through, the
+// EnumName() and VisitUnion() functions generated along with the `Traits`.
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/hash.h"
+#include "flatbuffers/util.h"
+
+namespace flatbuffers {
+
+/// @cond FLATBUFFERS_INTERNAL
+namespace internal {
+
+template <typename T, typename = void>
+struct HasStaticReflection : std::false_type {};
+
+template <typename T>
+struct HasStaticReflection<T, std::void_t<decltype(T::Traits::fields_number)>>
+    : std::true_type {};
+
+template <typename E, typename = void>
+struct HasEnumName : std::false_type {};
+
+template <typename E>
+struct HasEnumName<E, std::void_t<decltype(EnumName(std::declval<E>()))>>
+    : std::true_type {};
+
+template <typename T>
+struct IsVectorOrArray : std::false_type {};
+
+template <typename T, typename SizeT>
+struct IsVectorOrArray<Vector<T, SizeT>> : std::true_type {};
+
+template <typename T, uint16_t length>
+struct IsVectorOrArray<Array<T, length>> : std::true_type {};
+
+template <typename T>
+constexpr size_t NumFields() {
+  static_assert(HasStaticReflection<T>::value,
+                "T must be a table or struct generated with "
+                "--cpp-static-reflection");
+  return T::Traits::fields_number;
+}
+
+// Fields of structs are always present.
+template <size_t Index, typename T>
+bool IsFieldPresent(const T& object) {
+  if constexpr (std::is_base_of_v<Table, T>) {
+    return reinterpret_cast<const Table&>(object).CheckField(
+        T::Traits::field_offsets[Index]);
+  } else {
+    (void)object;
+    return true;
+  }
+}
+
+// The value of a union field is the field after its type.
+template <size_t Index, typename T>
+constexpr bool IsUnionValue() {
+  using Value = typename T::Traits::template FieldType<Index>;
+  return std::is_same_v<Value, const void*> ||
+         std::is_same_v<Value, const Vector<Offset<void>>*>;
+}
+
+template <typename T, typename F, size_t... Indexes>
+void ForEachFieldImpl(const T& object, F& f, std::index_sequence<Indexes...>) {
+  (f(T::Traits::field_names[Indexes], object.template get_field<Indexes>()),
+   ...);
+}
+
+template <typename T, typename F, size_t... Indexes>
+void ForEachPresentFieldImpl(const T& object, F& f,
+                             std::index_sequence<Indexes...>) {
+  ((IsFieldPresent<Indexes>(object)
+        ? (void)f(T::Traits::field_names[Indexes],
+                  object.template get_field<Indexes>())
+        : void()),
+   ...);
+}
+
+}  // namespace internal
+/// @endcond
+
+// Calls `f(name, value)` for each field of the table or struct `object`, in
+// the order of the schema, with the value its accessor returns (so the
+// default of scalars that aren't present, nullptr for other fields).
+template <typename T, typename F>
+void ForEachField(const T& object, F f) {
+  internal::ForEachFieldImpl(
+      object, f, std::make_index_sequence<internal::NumFields<T>()>());
+}
+
+// The same, skipping the fields of tables that aren't present.
+template <typename T, typename F>
+void ForEachPresentField(const T& object, F f) {
+  internal::ForEachPresentFieldImpl(
+      object, f, std::make_index_sequence<internal::NumFields<T>()>());
+}
+
+/// @cond FLATBUFFERS_INTERNAL
+namespace internal {
+
+template <typename T>
+void AppendJson(const T& value, std::string* json);
+
+template <typename T>
+void AppendJsonUnion(T type, const void* value, std::string* json) {
+  bool found = false;
+  VisitUnion(type, value, [&](const auto* member) {
+    AppendJson(member, json);
+    found = true;
+  });
+  if (!found) *json += "null";
+}
+
+template <size_t Index, typename T>
+void AppendJsonField(const T& object, bool* first, std::string* json) {
+  if (!IsFieldPresent<Index>(object)) return;
+  if (!*first) *json += ',';
+  *first = false;
+  *json += '"';
+  *json += T::Traits::field_names[Index];
+  *json += "\":";
+  const auto value = object.template get_field<Index>();
+  if constexpr (IsUnionValue<Index, T>()) {
+    const auto types = object.template get_field<Index - 1>();
+    if constexpr (std::is_same_v<decltype(value), const void* const>) {
+      AppendJsonUnion(types, value, json);
+    } else {
+      *json += '[';
+      for (uoffset_t i = 0; i < value->size(); i++) {
+        if (i) *json += ',';
+        if (types && i < types->size()) {
+          AppendJsonUnion(types->Get(i), value->Get(i), json);
+        } else {
+          *json += "null";
+        }
+      }
+      *json += ']';
+    }
+  } else {
+    AppendJson(value, json);
+  }
+}
+
+template <typename T, size_t... Indexes>
+void AppendJsonObject(const T& object, std::string* json,
+                      std::index_sequence<Indexes...>) {
+  bool first = true;
+  *json += '{';
+  (AppendJsonField<Indexes>(object, &first, json), ...);
+  (void)first;
+  *json += '}';
+}
+
+template <typename T>
+void AppendJson(const T& value, std::string* json) {
+  if constexpr (std::is_pointer_v<T>) {
+    if (!value) {
+      *json += "null";
+    } else {
+      AppendJson(*value, json);
+    }
+  } else if constexpr (HasStaticReflection<T>::value) {
+    AppendJsonObject(value, json, std::make_index_sequence<NumFields<T>()>());
+  } else if constexpr (std::is_same_v<T, String>) {
+    EscapeString(value.c_str(), value.size(), json, true, false);
+  } else if constexpr (IsVectorOrArray<T>::value) {
+    *json += '[';
+    for (uoffset_t i = 0; i < value.size(); i++) {
+      if (i) *json += ',';
+      AppendJson(value.Get(i), json);
+    }
+    *json += ']';
+  } else if constexpr (std::is_enum_v<T>) {
+    if constexpr (HasEnumName<T>::value) {
+      const char* name = EnumName(value);
+      if (*name) {
+        *json += '"';
+        *json += name;
+        *json += '"';
+        return;
+      }
+    }
+    AppendJson(static_cast<std::underlying_type_t<T>>(value), json);
+  } else if constexpr (std::is_same_v<T, bool>) {
+    *json += value ? "true" : "false";
+  } else if constexpr (std::is_integral_v<T>) {
+    // Unlike NumToString(), this doesn't go through a std::stringstream.
+    char digits[24];
+    const auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+    json->append(digits, end);
+  } else {
+    static_assert(std::is_arithmetic_v<T>, "Can't print this type.");
+    *json += NumToString(value);
+  }
+}
+
+// FNV-1a, a 64 bit word instead of a byte at a time, and folding the high
+// bits of the product into the low ones.
+inline uint64_t HashCombine(uint64_t hash, uint64_t value) {
+  hash = (hash ^ value) * FnvTraits<uint64_t>::kFnvPrime;
+  return hash ^ (hash >> 32);
+}
+
+inline uint64_t HashBytes(uint64_t hash, const uint8_t* bytes, size_t size) {
+  hash = HashCombine(hash, size);
+  for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+    hash = HashCombine(hash, word);
+    bytes += sizeof(word);
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, bytes, size);
+  return HashCombine(hash, tail);
+}
+
+template <typename T>
+uint64_t HashValue(uint64_t hash, const T& value);
+
+template <size_t Index, typename T>
+uint64_t HashField(uint64_t hash, const T& object) {
+  const auto value = object.template get_field<Index>();
+  if constexpr (IsUnionValue<Index, T>()) {
+    const auto types = object.template get_field<Index - 1>();
+    if constexpr (std::is_same_v<decltype(value), const void* const>) {
+      hash = HashCombine(hash, value != nullptr);
+      VisitUnion(types, value, [&](const auto* member) {
+        hash = HashValue(hash, member);
+      });
+    } else {
+      if (!value || !types) return HashCombine(hash, 0);
+      hash = HashCombine(hash, value->size());
+      for (uoffset_t i = 0; i < value->size() && i < types->size(); i++) {
+        VisitUnion(types->Get(i), value->Get(i), [&](const auto* member) {
+          hash = HashValue(hash, member);
+        });
+      }
+    }
+    return hash;
+  } else {
+    return HashValue(hash, value);
+  }
+}
+
+template <typename T, size_t... Indexes>
+uint64_t HashObjectImpl(uint64_t hash, const T& object,
+                        std::index_sequence<Indexes...>) {
+  ((hash = HashField<Indexes>(hash, object)), ...);
+  return hash;
+}
+
+template <typename T>
+uint64_t HashValue(uint64_t hash, const T& value) {
+  if constexpr (std::is_pointer_v<T>) {
+    hash = HashCombine(hash, value != nullptr);
+    return value ? HashValue(hash, *value) : hash;
+  } else if constexpr (HasStaticReflection<T>::value) {
+    return HashObjectImpl(hash, value,
+                          std::make_index_sequence<NumFields<T>()>());
+  } else if constexpr (std::is_same_v<T, String>) {
+    return HashBytes(hash, value.Data(), value.size());
+  } else if constexpr (IsVectorOrArray<T>::value) {
+    using Element = std::remove_cv_t<typename T::return_type>;
+    if constexpr (std::is_arithmetic_v<Element>) {
+      // As stored: equal vectors store the same bytes.
+      return HashBytes(hash, value.Data(), value.size() * sizeof(Element));
+    } else {
+      hash = HashCombine(hash, value.size());
+      for (uoffset_t i = 0; i < value.size(); i++) {
+        hash = HashValue(hash, value.Get(i));
+      }
+      return hash;
+    }
+  } else if constexpr (std::is_enum_v<T>) {
+    return HashValue(hash, static_cast<std::underlying_type_t<T>>(value));
+  } else {
+    static_assert(std::is_arithmetic_v<T>, "Can't hash this type.");
+    // Floats by their bits, as ObjectsEqual() compares them.
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(T));
+    return HashCombine(hash, bits);
+  }
+}
+
+template <typename T>
+bool ValuesEqual(const T& a, const T& b);
+
+template <typename T>
+bool UnionsEqual(T type, const void* a, const void* b) {
+  bool equal = a == b;
+  VisitUnion(type, a, [&](const auto* member) {
+    equal = ValuesEqual(member, static_cast<decltype(member)>(b));
+  });
+  return equal;
+}
+
+// Relies on the type of a union being compared (and equal) before its value.
+template <size_t Index, typename T>
+bool FieldsEqual(const T& a, const T& b) {
+  const auto value_a = a.template get_field<Index>();
+  const auto value_b = b.template get_field<Index>();
+  if constexpr (IsUnionValue<Index, T>()) {
+    const auto types = a.template get_field<Index - 1>();
+    if constexpr (std::is_same_v<decltype(value_a), const void* const>) {
+      return UnionsEqual(types, value_a, value_b);
+    } else {
+      if (!value_a || !value_b) return value_a == value_b;
+      if (value_a->size() != value_b->size()) return false;
+      for (uoffset_t i = 0; i < value_a->size(); i++) {
+        if (!types || i >= types->size()) return false;
+        if (!UnionsEqual(types->Get(i), value_a->Get(i), value_b->Get(i))) {
+          return false;
+        }
+      }
+      return true;
+    }
+  } else {
+    return ValuesEqual(value_a, value_b);
+  }
+}
+
+template <typename T, size_t... Indexes>
+bool ObjectsEqualImpl(const T& a, const T& b,
+                      std::index_sequence<Indexes...>) {
+  return (FieldsEqual<Indexes>(a, b) && ...);
+}
+
+template <typename T>
+bool ValuesEqual(const T& a, const T& b) {
+  if constexpr (std::is_pointer_v<T>) {
+    if (!a || !b) return a == b;
+    return a == b || ValuesEqual(*a, *b);
+  } else if constexpr (HasStaticReflection<T>::value) {
+    return ObjectsEqualImpl(a, b, std::make_index_sequence<NumFields<T>()>());
+  } else if constexpr (std::is_same_v<T, String>) {
+    return a.size() == b.size() && !memcmp(a.Data(), b.Data(), a.size());
+  } else if constexpr (IsVectorOrArray<T>::value) {
+    using Element = std::remove_cv_t<typename T::return_type>;
+    if (a.size() != b.size()) return false;
+    if constexpr (std::is_arithmetic_v<Element>) {
+      return !memcmp(a.Data(), b.Data(), a.size() * sizeof(Element));
+    } else {
+      for (uoffset_t i = 0; i < a.size(); i++) {
+        if (!ValuesEqual(a.Get(i), b.Get(i))) return false;
+      }
+      return true;
+    }
+  } else if constexpr (std::is_enum_v<T>) {
+    return a == b;
+  } else {
+    static_assert(std::is_arithmetic_v<T>, "Can't compare this type.");
+    return !memcmp(&a, &b, sizeof(T));
+  }
+}
+
+}  // namespace internal
+/// @endcond
+
+// Appends the table or struct `object` to `json` as JSON, as GenText() prints
+// it with `strict_json` and no indentation: the fields that are present, in
+// the order of the schema, with enum values by name where they have one.
+template <typename T>
+void ToJson(const T& object, std::string* json) {
+  internal::AppendJsonObject(
+      object, json, std::make_index_sequence<internal::NumFields<T>()>());
+}
+
+template <typename T>
+std::string ToJson(const T& object) {
+  std::string json;
+  ToJson(object, &json);
+  return json;
+}
+
+// A hash of the values of the fields of the table or struct `object`,
+// recursively. Like the accessors, it doesn't tell apart a scalar that isn't
+// present from one set to its default, nor depend on where things are stored
+// in the buffer, so objects for which ObjectsEqual() holds have the same hash.
+template <typename T>
+uint64_t HashObject(const T& object) {
+  return internal::HashObjectImpl(
+      FnvTraits<uint64_t>::kOffsetBasis, object,
+      std::make_index_sequence<internal::NumFields<T>()>());
+}
+
+// Whether the fields of the tables or structs `a` and `b` have the same
+// values, recursively. Floats are compared by their bits, so NaNs equal
+// themselves and 0.0 doesn't equal -0.0.
+template <typename T>
+bool ObjectsEqual(const T& a, const T& b) {
+  return internal::ObjectsEqualImpl(
+      a, b, std::make_index_sequence<internal::NumFields<T>()>());
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_STATIC_REFLECTION_H_
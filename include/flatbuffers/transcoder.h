@@ -0,0 +1,229 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_TRANSCODER_H_
+#define FLATBUFFERS_TRANSCODER_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flatbuffers/reflection.h"
+
+// Converts FlatBuffers of one schema (the source) directly into FlatBuffers of
+// another one (the target), e.g. after a schema change that isn't a compatible
+// evolution: fields that were renumbered, moved or renamed, scalars that were
+// widened, or tables and fields that were removed.
+//
+// The target fields are matched with the source fields of the same name,
+// unless a TranscoderMapping says otherwise, and the tables of the target root
+// table with those of the source root table. From this, the Transcoder compiles
+// a plan once, checking that every conversion is lossless, after which
+// transcoding a buffer just copies (or widens) the values field by field:
+//
+//  - Scalars of the same type are copied, and integers and floats converted to
+//    a type that can hold all their values (e.g. short to int, uint to long,
+//    int to double, float to double).
+//  - Fields that are absent in the source, but have a different default in the
+//    target, are filled with the source default.
+//  - Strings, vectors, tables and unions are copied recursively. Structs are
+//    copied as is, so must have the same layout in both schemas.
+//  - Enum values are renumbered by their name, bit by bit if all values are
+//    single bits (like bit_flags enums). Every value of the source enum must be
+//    in the target enum, but values that aren't in it are stored as is.
+//  - Union types are renumbered by the name of their table (or their name).
+//  - Required target fields need a required source field.
+//  - Source fields without a target field are dropped, as are union values of
+//    types the target union doesn't have.
+
+namespace flatbuffers {
+
+// Maps the names of tables and fields in the target schema to those in the
+// source schema, where they differ.
+class TranscoderMapping {
+ public:
+  // Maps the target table or field `target` (a fully qualified table name, or
+  // a table name followed by "." and a field name) to the source table or
+  // field `source` (a fully qualified table name, or just a field name). An
+  // empty `source` makes the target field not take a value from the source.
+  void Add(const std::string& target, const std::string& source) {
+    names_[target] = source;
+  }
+
+  // Adds the mappings in `text`, a `target = source` pair on each line. Blank
+  // lines and lines starting with `#` are ignored. Returns false and sets
+  // `error` if a line can't be parsed.
+  bool Parse(const char* text, std::string* error);
+
+  // Returns the source name of `target`, or nullptr if it isn't mapped.
+  const std::string* Lookup(const std::string& target) const {
+    auto it = names_.find(target);
+    return it == names_.end() ? nullptr : &it->second;
+  }
+
+ private:
+  std::map<std::string, std::string> names_;
+};
+
+class Transcoder {
+ public:
+  // Both schemas must outlive the transcoder.
+  Transcoder(const reflection::Schema& source,
+             const reflection::Schema& target);
+
+  // Compiles the plan for converting the root table of the source schema to
+  // that of the target schema (unless `mapping` maps the target root table to
+  // another source table). Returns false if they can't be converted without
+  // losing data, see error().
+  bool Compile(const TranscoderMapping& mapping = TranscoderMapping());
+
+  const std::string& error() const { return error_; }
+
+  const CompiledSchema& source() const { return source_; }
+  const CompiledSchema& target() const { return target_; }
+
+  // The source table converted to the target root table, which source buffers
+  // are verified against, or nullptr if Compile() hasn't succeeded.
+  const CompiledSchema::Object* source_root() const {
+    return object_plans_.empty() || !error_.empty() ? nullptr
+                                                    : object_plans_[0].source;
+  }
+
+  // Converts `table`, a source root table, into `fbb` as a target root table.
+  // Like CopyTable(), this expects a buffer that has been verified (e.g. with
+  // Verify() and source_root()), and doesn't preserve sharing.
+  Offset<const Table*> TranscodeTable(FlatBufferBuilder& fbb,
+                                      const Table& table) const;
+
+  // Converts the FlatBuffer `buffer` into `fbb`, and finishes it with the file
+  // identifier of the target schema. Both are size prefixed if
+  // `size_prefixed`.
+  void Transcode(const uint8_t* buffer, FlatBufferBuilder& fbb,
+                 bool size_prefixed = false) const;
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(Transcoder(const Transcoder&));
+  FLATBUFFERS_DELETE_FUNC(Transcoder& operator=(const Transcoder&));
+
+  enum FieldOp {
+    kCopyScalar,
+    kConvertScalar,
+    kEnum,
+    kUnionType,
+    kStruct,
+    kString,
+    kTable,
+    kUnion,
+    kVectorOfScalars,
+    kVectorOfConvertedScalars,
+    kVectorOfEnums,
+    kVectorOfStructs,
+    kVectorOfStrings,
+    kVectorOfTables,
+  };
+
+  struct FieldPlan {
+    FieldOp op;
+    voffset_t source_offset;
+    voffset_t target_offset;
+    // The source field holding the type of unions.
+    voffset_t source_type_offset;
+    // The types of scalars, or of the elements of vectors of scalars.
+    reflection::BaseType source_type;
+    reflection::BaseType target_type;
+    // The size and alignment in the target of values stored inline, or of the
+    // elements of vectors.
+    size_t size;
+    size_t align;
+    // The size of the elements of vectors in the source.
+    size_t source_size;
+    // The object plan of tables, the enum plan of enums, or the union plan of
+    // unions and their types.
+    size_t plan;
+    // Whether to store `fill` when the field is absent in the source, because
+    // its default differs.
+    bool has_fill;
+    uint8_t fill[sizeof(largest_scalar_t)];
+  };
+
+  struct ObjectPlan {
+    const CompiledSchema::Object* source;
+    const CompiledSchema::Object* target;
+    // The fields stored as offsets, which are created before the table.
+    std::vector<FieldPlan> offset_fields;
+    // The fields stored inline, largest first, so they pack without padding.
+    std::vector<FieldPlan> inline_fields;
+  };
+
+  struct UnionPlan {
+    // The target type (0 if it has none), and the object plan (kNoPlan for
+    // strings) of each source type.
+    std::vector<uint8_t> types;
+    std::vector<size_t> plans;
+  };
+
+  struct EnumPlan {
+    // The source and target value of each value that differs, sorted by the
+    // source value.
+    std::vector<std::pair<int64_t, int64_t>> values;
+    // Whether all values are single bits, to renumber bit by bit.
+    bool bit_flags;
+  };
+
+  static const size_t kNoPlan = static_cast<size_t>(-1);
+
+  size_t CompileObject(const CompiledSchema::Object& source,
+                       const CompiledSchema::Object& target);
+  size_t CompileUnion(const CompiledSchema::Enum& source,
+                      const CompiledSchema::Enum& target);
+  size_t CompileEnum(const CompiledSchema::Enum& source,
+                     const CompiledSchema::Enum& target,
+                     const std::string& name);
+  const CompiledSchema::Field* SourceField(
+      const CompiledSchema::Object& source, const std::string& name,
+      const CompiledSchema::Field& target);
+  bool CompileField(const CompiledSchema::Field& source,
+                    const CompiledSchema::Field& target,
+                    const std::string& name, FieldPlan* plan);
+  bool CompileScalar(reflection::BaseType source, reflection::BaseType target,
+                     const std::string& name, FieldOp* op);
+
+  int64_t MapEnum(size_t plan, int64_t value) const;
+
+  Offset<const Table*> TranscodeTable(FlatBufferBuilder& fbb, size_t plan,
+                                      const Table& table,
+                                      std::vector<uoffset_t>* offsets) const;
+  uoffset_t TranscodeOffsetField(FlatBufferBuilder& fbb,
+                                 const FieldPlan& field, const Table& table,
+                                 std::vector<uoffset_t>* offsets) const;
+  void TranscodeInlineField(FlatBufferBuilder& fbb, const FieldPlan& field,
+                            const Table& table) const;
+
+  CompiledSchema source_;
+  CompiledSchema target_;
+  const TranscoderMapping* mapping_;
+  std::string error_;
+  // Indexed by the source and target object or enum, for recursion.
+  std::map<std::pair<const void*, const void*>, size_t> compiled_;
+  std::vector<ObjectPlan> object_plans_;
+  std::vector<EnumPlan> enum_plans_;
+  std::vector<UnionPlan> union_plans_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_TRANSCODER_H_
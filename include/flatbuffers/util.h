@@ -624,12 +624,54 @@ inline std::string WordWrap(const std::string in, size_t max_length,
 }
 #endif  // !FLATBUFFERS_PREFER_PRINTF
 
+// Returns the index of the first character of `s` from `i` on that
+// EscapeString() can't copy as is (a quote, a backslash, or anything but
+// printable ASCII), or `length` if there is none. Looks at eight characters
+// at a time.
+inline size_t SkipUnescapedChars(const char* s, size_t i, size_t length) {
+  static const uint64_t kOnes = 0x0101010101010101ULL;
+  static const uint64_t kHighBits = kOnes * 0x80;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t chars;
+    memcpy(&chars, s + i, sizeof(chars));
+    const uint64_t quotes = chars ^ (kOnes * '"');
+    const uint64_t backslashes = chars ^ (kOnes * '\\');
+    // The high bit of some byte is set if any of the characters is below ' ',
+    // above '~', or a quote or backslash (which are 0 in `quotes` and
+    // `backslashes`).
+    const uint64_t special = ((chars - kOnes * ' ') & ~chars) |
+                             ((chars + kOnes) | chars) |
+                             ((quotes - kOnes) & ~quotes) |
+                             ((backslashes - kOnes) & ~backslashes);
+    if (special & kHighBits) break;
+  }
+  for (; i < length; i++) {
+    const char c = s[i];
+    if (c < ' ' || c > '~' || c == '"' || c == '\\') break;
+  }
+  return i;
+}
+
 inline bool EscapeString(const char* s, size_t length, std::string* _text,
                          bool allow_non_utf8, bool natural_utf8) {
   std::string& text = *_text;
   text += "\"";
-  for (uoffset_t i = 0; i < length; i++) {
+  // The characters from `run` on are appended in one go once one that needs
+  // escaping (or the end) is reached.
+  size_t run = 0;
+  for (size_t i = 0;; i++) {
+    i = SkipUnescapedChars(s, i, length);
+    if (i == length) break;
     char c = s[i];
+    if (natural_utf8 && (c & 0x80)) {
+      // Valid UTF-8 is copied as is, as part of the run.
+      const char* utf8 = s + i;
+      if (FromUTF8(&utf8) >= 0) {
+        i = static_cast<size_t>(utf8 - s - 1);
+        continue;
+      }
+    }
+    text.append(s + run, i - run);
     switch (c) {
       case '\n':
         text += "\\n";
@@ -698,12 +740,14 @@ inline bool EscapeString(const char* s, size_t length, std::string* _text,
               text += IntToStringHex(low_surrogate, 4);
             }
             // Skip past characters recognized.
-            i = static_cast<uoffset_t>(utf8 - s - 1);
+            i = static_cast<size_t>(utf8 - s - 1);
           }
         }
         break;
     }
+    run = i + 1;
   }
+  text.append(s + run, length - run);
   text += "\"";
   return true;
 }
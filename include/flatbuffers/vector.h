@@ -410,6 +410,83 @@ FLATBUFFERS_CONSTEXPR_CPP11 flatbuffers::span<const U> make_structs_span(
 
 #endif
 
+/// @cond FLATBUFFERS_INTERNAL
+// Structs are stored the same way on every host.
+template <typename T, typename U, typename SizeT>
+void CopyVectorToImpl(const Vector<const T*, SizeT>& vec, U* dst) {
+  static_assert(sizeof(T) == sizeof(U), "U must be the struct type T");
+  memcpy(dst, vec.Data(), vec.size() * sizeof(U));
+}
+
+template <typename T, typename U, typename SizeT>
+void CopyVectorToImpl(const Vector<T, SizeT>& vec, U* dst) {
+  static_assert(sizeof(T) == sizeof(U), "U must be T or an enum of T");
+  static_assert(!std::is_same<U, bool>::value, "bools need a conversion");
+  if (FLATBUFFERS_LITTLEENDIAN || sizeof(T) == 1) {
+    memcpy(dst, vec.Data(), vec.size() * sizeof(U));
+  } else {
+    for (SizeT i = 0; i < vec.size(); i++) dst[i] = static_cast<U>(vec.Get(i));
+  }
+}
+/// @endcond
+
+// Copy all elements of a vector of scalars, enums or structs to `dst`, which
+// must have room for `vec.size()` elements. `U` is the element type, or the
+// enum type for vectors of enums. Wherever the wire format matches the host's
+// this is a single memcpy, which is much faster than copying element by
+// element for large vectors.
+template <typename T, typename U, typename SizeT>
+void CopyVectorTo(const Vector<T, SizeT>& vec, U* dst) {
+  if (vec.size()) CopyVectorToImpl(vec, dst);
+}
+
+// Stores pointers to the tables or strings [begin, end) of `vec` in `dst`,
+// which must have room for `end - begin` of them. Resolving a batch of offsets
+// in one loop that does nothing else lets the compiler vectorize it, and keeps
+// the loops over `dst` that do the actual work simple.
+template <typename T>
+void ResolveOffsets(const Vector<Offset<T>>& vec, uoffset_t begin,
+                    uoffset_t end, const T** dst) {
+  FLATBUFFERS_ASSERT(begin <= end && end <= vec.size());
+  const uint8_t* data = vec.Data();
+  for (uoffset_t i = begin; i < end; i++) {
+    dst[i - begin] = IndirectHelper<Offset<T>>::Read(data, i);
+  }
+}
+
+/// @cond FLATBUFFERS_INTERNAL
+template <typename T>
+inline void PrefetchVTable(const T* table) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(table);
+  FLATBUFFERS_PREFETCH(p - ReadScalar<soffset_t>(p));
+}
+inline void PrefetchVTable(const String*) {}  // Strings have none.
+/// @endcond
+
+// Calls `f(i, vec.Get(i))` for each element of a vector of tables or strings,
+// in order, while prefetching the table `2 * prefetch_distance` elements ahead
+// and the vtable of the one `prefetch_distance` ahead. Iterating with Get() or
+// an iterator costs two dependent cache misses per table (the table, then its
+// vtable) once the tables are scattered over a buffer larger than the cache;
+// with enough elements ahead in flight, scans no longer wait on each of them.
+template <typename T, typename F>
+void ForEachPrefetched(const Vector<Offset<T>>& vec, F f,
+                       uoffset_t prefetch_distance = 16) {
+  const uint8_t* data = vec.Data();
+  const uoffset_t size = vec.size();
+  for (uoffset_t i = 0; i < size; i++) {
+    if (size - i > 2 * prefetch_distance) {
+      FLATBUFFERS_PREFETCH(
+          IndirectHelper<Offset<T>>::Read(data, i + 2 * prefetch_distance));
+    }
+    if (size - i > prefetch_distance) {
+      PrefetchVTable(
+          IndirectHelper<Offset<T>>::Read(data, i + prefetch_distance));
+    }
+    f(i, IndirectHelper<Offset<T>>::Read(data, i));
+  }
+}
+
 // Represent a vector much like the template above, but in this case we
 // don't know what the element types are (used with reflection.h).
 class VectorOfAny {
@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "flatbuffers/base.h"
+#include "flatbuffers/builder_stats.h"
 #include "flatbuffers/default_allocator.h"
 #include "flatbuffers/detached_buffer.h"
 
@@ -32,6 +33,15 @@ namespace flatbuffers {
 // Since this vector leaves the lower part unused, we support a "scratch-pad"
 // that can be stored there for temporary data, to share the allocated space.
 // Essentially, this supports 2 std::vectors in a single buffer.
+//
+// Optionally (see set_segment_size()) the buffer can grow by adding new
+// fixed-size segments instead of reallocating and copying what has been
+// written so far. Offsets are always counted over the logical buffer, i.e. the
+// concatenation of all segments, so they stay valid across segment
+// boundaries. Only the scratch-pad moves to the newest segment.
+//
+// Alternatively (see set_fixed_buffer()) it can use a fixed, caller-owned
+// buffer that is never grown or deallocated.
 template <typename SizeT = uoffset_t>
 class vector_downward {
  public:
@@ -47,7 +57,12 @@ class vector_downward {
         size_(0),
         buf_(nullptr),
         cur_(nullptr),
-        scratch_(nullptr) {}
+        scratch_(nullptr),
+        fixed_(false),
+        overflowed_(false),
+        segment_size_(0),
+        base_(0),
+        skew_(0) {}
 
   vector_downward(vector_downward&& other) noexcept
       // clang-format on
@@ -60,7 +75,14 @@ class vector_downward {
         size_(other.size_),
         buf_(other.buf_),
         cur_(other.cur_),
-        scratch_(other.scratch_) {
+        scratch_(other.scratch_),
+        fixed_(other.fixed_),
+        overflowed_(other.overflowed_),
+        segment_size_(other.segment_size_),
+        base_(other.base_),
+        skew_(other.skew_),
+        segments_(std::move(other.segments_)) {
+    FLATBUFFERS_BUILDER_STAT(stats_ = other.stats_);
     // No change in other.allocator_
     // No change in other.initial_size_
     // No change in other.buffer_minalign_
@@ -69,6 +91,11 @@ class vector_downward {
     other.buf_ = nullptr;
     other.cur_ = nullptr;
     other.scratch_ = nullptr;
+    other.fixed_ = false;
+    other.overflowed_ = false;
+    other.base_ = 0;
+    other.skew_ = 0;
+    other.segments_.clear();
   }
 
   vector_downward& operator=(vector_downward&& other) noexcept {
@@ -84,11 +111,12 @@ class vector_downward {
   }
 
   void reset() {
-    clear_buffer();
+    if (!fixed_) clear_buffer();
     clear();
   }
 
   void clear() {
+    clear_segments();
     if (buf_) {
       cur_ = buf_ + reserved_;
     } else {
@@ -96,6 +124,7 @@ class vector_downward {
       cur_ = nullptr;
     }
     size_ = 0;
+    overflowed_ = false;
     clear_scratch();
   }
 
@@ -110,12 +139,22 @@ class vector_downward {
   }
 
   void clear_buffer() {
-    if (buf_) Deallocate(allocator_, buf_, reserved_);
+    clear_segments();
+    if (buf_ && !fixed_) Deallocate(allocator_, buf_, reserved_);
     buf_ = nullptr;
+    fixed_ = false;
   }
 
   // Relinquish the pointer to the caller.
   uint8_t* release_raw(size_t& allocated_bytes, size_t& offset) {
+    // A fixed buffer is owned by the caller, it can't be released.
+    FLATBUFFERS_ASSERT(!fixed_);
+    if (fixed_) {
+      allocated_bytes = 0;
+      offset = 0;
+      return nullptr;
+    }
+    flatten();
     auto* buf = buf_;
     allocated_bytes = reserved_;
     offset = vector_downward::offset();
@@ -129,6 +168,9 @@ class vector_downward {
 
   // Relinquish the pointer to the caller.
   DetachedBuffer release() {
+    FLATBUFFERS_ASSERT(!fixed_);
+    if (fixed_) return DetachedBuffer();
+    flatten();
     // allocator ownership (if any) is transferred to DetachedBuffer.
     DetachedBuffer fb(allocator_, own_allocator_, buf_, reserved_, cur_,
                       size());
@@ -152,9 +194,14 @@ class vector_downward {
     return len;
   }
 
+  // Returns nullptr if a fixed buffer has overflowed, in which case nothing
+  // must be written, see overflowed().
   inline uint8_t* make_space(size_t len) {
     if (len) {
-      ensure_space(len);
+      if (len > unused_buffer_size() && !grow(len)) {
+        size_ += static_cast<SizeT>(len);
+        return nullptr;
+      }
       cur_ -= len;
       size_ += static_cast<SizeT>(len);
     }
@@ -180,6 +227,34 @@ class vector_downward {
 
   size_t capacity() const { return reserved_; }
 
+  // Builds into `buf` instead of allocating, which the caller keeps owning and
+  // must keep alive. The buffer is never grown: once a write doesn't fit
+  // overflowed() is set, after which nothing is written anymore while size()
+  // still counts the bytes that would have been, until clear() is called.
+  void set_fixed_buffer(uint8_t* buf, size_t len) {
+    FLATBUFFERS_ASSERT(!segment_size_);
+    clear_buffer();
+    // Data is aligned relative to the end of the buffer, and the scratch-pad
+    // relative to its start, so align both ends.
+    const size_t address = reinterpret_cast<size_t>(buf);
+    const size_t skip = PaddingBytes(address, buffer_minalign_);
+    const size_t trim = (address + len) & (buffer_minalign_ - 1);
+    buf_ = buf;
+    reserved_ = 0;
+    if (len >= skip + trim) {
+      buf_ += skip;
+      reserved_ = len - skip - trim;
+    }
+    fixed_ = true;
+    clear();
+  }
+
+  bool fixed() const { return fixed_; }
+
+  // Whether a write didn't fit in the fixed buffer since the last clear(). The
+  // contents of the buffer are then meaningless, only size() is still right.
+  bool overflowed() const { return overflowed_; }
+
   uint8_t* data() const {
     FLATBUFFERS_ASSERT(cur_);
     return cur_;
@@ -195,47 +270,122 @@ class vector_downward {
     return scratch_;
   }
 
-  uint8_t* data_at(size_t offset) const { return buf_ + reserved_ - offset; }
+#ifdef FLATBUFFERS_BUILDER_STATS
+  BuilderStats& stats() { return stats_; }
+  const BuilderStats& stats() const { return stats_; }
+#endif
+
+  uint8_t* data_at(size_t offset) const {
+    if (offset > base_ || segments_.empty()) {
+      return buf_ + reserved_ - skew_ - (offset - base_);
+    }
+    return segment_data_at(offset);
+  }
+
+  // Makes the buffer grow by appending segments of (at least) `segment_size`
+  // bytes rather than by reallocating, which never copies the data written so
+  // far. Pass 0 to go back to a single contiguous allocation on growth.
+  // Objects created with a single make_space() call are always contiguous,
+  // objects pushed piecewise may straddle two segments.
+  void set_segment_size(size_t segment_size) {
+    FLATBUFFERS_ASSERT(!fixed_);
+    segment_size_ = segment_size;
+  }
+
+  size_t segment_size() const { return segment_size_; }
+
+  // The number of memory regions the buffer is currently stored in.
+  size_t num_segments() const { return segments_.size() + 1; }
+
+  // Returns the `i`-th memory region of the buffer and stores its length in
+  // `len`. Regions are ordered from the front of the buffer (the last bytes
+  // written) to its end, so concatenating them yields the logical buffer.
+  const uint8_t* segment_data(size_t i, size_t* len) const {
+    if (i == 0) {
+      *len = size_ - base_;
+      return cur_;
+    }
+    const segment& s = segments_[segments_.size() - i];
+    *len = s.size;
+    return s.data;
+  }
+
+  // Copies all segments into a single contiguous allocation, after which
+  // data() points to the whole buffer again.
+  void flatten() {
+    if (segments_.empty()) return;
+    const size_t in_use = size_ - base_;
+    const size_t old_scratch_size = scratch_size();
+    size_t reserved = size_ + old_scratch_size;
+    reserved = (reserved + buffer_minalign_ - 1) & ~(buffer_minalign_ - 1);
+    uint8_t* buf = Allocate(allocator_, reserved);
+    uint8_t* dst = buf + reserved;
+    for (auto it = segments_.begin(); it != segments_.end(); ++it) {
+      dst -= it->size;
+      memcpy(dst, it->data, it->size);
+    }
+    dst -= in_use;
+    memcpy(dst, cur_, in_use);
+    memcpy(buf, buf_, old_scratch_size);
+    FLATBUFFERS_BUILDER_STAT(stats_.AddReallocation(size_ + old_scratch_size));
+    clear_segments();
+    Deallocate(allocator_, buf_, reserved_);
+    buf_ = buf;
+    reserved_ = reserved;
+    cur_ = dst;
+    scratch_ = buf_ + old_scratch_size;
+  }
 
   void push(const uint8_t* bytes, size_t num) {
     if (num > 0) {
-      memcpy(make_space(num), bytes, num);
+      uint8_t* dst = make_space(num);
+      if (dst) memcpy(dst, bytes, num);
     }
   }
 
   // Specialized version of push() that avoids memcpy call for small data.
   template <typename T>
   void push_small(const T& little_endian_t) {
-    make_space(sizeof(T));
-    *reinterpret_cast<T*>(cur_) = little_endian_t;
+    uint8_t* dst = make_space(sizeof(T));
+    if (dst) *reinterpret_cast<T*>(dst) = little_endian_t;
   }
 
   template <typename T>
   void scratch_push_small(const T& t) {
-    ensure_space(sizeof(T));
+    if (sizeof(T) > unused_buffer_size() && !grow(sizeof(T))) return;
     *reinterpret_cast<T*>(scratch_) = t;
     scratch_ += sizeof(T);
+    FLATBUFFERS_BUILDER_STAT(stats_.TrackScratchSize(scratch_size()));
   }
 
   // fill() is most frequently called with small byte counts (<= 4),
   // which is why we're using loops rather than calling memset.
   void fill(size_t zero_pad_bytes) {
-    make_space(zero_pad_bytes);
-    for (size_t i = 0; i < zero_pad_bytes; i++) cur_[i] = 0;
+    uint8_t* dst = make_space(zero_pad_bytes);
+    if (!dst) return;
+    for (size_t i = 0; i < zero_pad_bytes; i++) dst[i] = 0;
   }
 
   // Version for when we know the size is larger.
   // Precondition: zero_pad_bytes > 0
   void fill_big(size_t zero_pad_bytes) {
-    memset(make_space(zero_pad_bytes), 0, zero_pad_bytes);
+    uint8_t* dst = make_space(zero_pad_bytes);
+    if (dst) memset(dst, 0, zero_pad_bytes);
   }
 
+  // An overflowed fixed buffer stores nothing, so popping only changes its
+  // size, as pushes may have been dropped.
   void pop(size_t bytes_to_remove) {
-    cur_ += bytes_to_remove;
+    // Popping is only supported within the current segment.
+    FLATBUFFERS_ASSERT(overflowed_ ||
+                       bytes_to_remove <= static_cast<size_t>(size_ - base_));
+    if (!overflowed_) cur_ += bytes_to_remove;
     size_ -= static_cast<SizeT>(bytes_to_remove);
   }
 
-  void scratch_pop(size_t bytes_to_remove) { scratch_ -= bytes_to_remove; }
+  void scratch_pop(size_t bytes_to_remove) {
+    if (!overflowed_) scratch_ -= bytes_to_remove;
+  }
 
   void swap(vector_downward& other) {
     using std::swap;
@@ -249,6 +399,13 @@ class vector_downward {
     swap(buf_, other.buf_);
     swap(cur_, other.cur_);
     swap(scratch_, other.scratch_);
+    swap(fixed_, other.fixed_);
+    swap(overflowed_, other.overflowed_);
+    swap(segment_size_, other.segment_size_);
+    swap(base_, other.base_);
+    swap(skew_, other.skew_);
+    segments_.swap(other.segments_);
+    FLATBUFFERS_BUILDER_STAT(swap(stats_, other.stats_));
   }
 
   void swap_allocator(vector_downward& other) {
@@ -274,8 +431,102 @@ class vector_downward {
   uint8_t* buf_;
   uint8_t* cur_;  // Points at location between empty (below) and used (above).
   uint8_t* scratch_;  // Points to the end of the scratchpad in use.
+  bool fixed_;        // buf_ is owned by the caller, see set_fixed_buffer().
+  bool overflowed_;
+
+  // A segment that is no longer written to, see set_segment_size().
+  struct segment {
+    uint8_t* buf;     // The allocation.
+    size_t reserved;  // Size of the allocation.
+    uint8_t* data;    // Start of the bytes in use, which end at data + size.
+    size_t size;      // Number of bytes in use.
+    size_t base;      // Logical offset of the end of this segment.
+  };
+
+  size_t segment_size_;  // 0 unless growing by segments.
+  SizeT base_;   // Bytes held by the segments before the current allocation.
+  size_t skew_;  // Unused bytes at the end of the current allocation.
+  // Older segments, ordered from the end of the buffer towards the front.
+  std::vector<segment> segments_;
+
+#ifdef FLATBUFFERS_BUILDER_STATS
+  BuilderStats stats_;
+#endif
+
+  void clear_segments() {
+    for (auto it = segments_.begin(); it != segments_.end(); ++it) {
+      Deallocate(allocator_, it->buf, it->reserved);
+    }
+    segments_.clear();
+    base_ = 0;
+    skew_ = 0;
+  }
+
+  uint8_t* segment_data_at(size_t offset) const {
+    // Find the last segment whose end lies before `offset`.
+    size_t lo = 0, hi = segments_.size();
+    while (hi - lo > 1) {
+      const size_t mid = lo + (hi - lo) / 2;
+      if (segments_[mid].base < offset) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    const segment& s = segments_[lo];
+    return s.data + s.size - (offset - s.base);
+  }
+
+  // Starts a new segment that fits `len` bytes, moving only the scratch-pad.
+  void add_segment(size_t len) {
+    const size_t in_use = size_ - base_;
+    const size_t old_scratch_size = scratch_size();
+    size_t reserved =
+        (std::max)(segment_size_, len + old_scratch_size + buffer_minalign_);
+    reserved = (reserved + buffer_minalign_ - 1) & ~(buffer_minalign_ - 1);
+    uint8_t* buf = Allocate(allocator_, reserved);
+    memcpy(buf, buf_, old_scratch_size);
+    FLATBUFFERS_BUILDER_STAT(stats_.AddReallocation(old_scratch_size));
+    if (in_use) {
+      segment s = { buf_, reserved_, cur_, in_use, base_ };
+      segments_.push_back(s);
+      base_ = size_;
+    } else {
+      Deallocate(allocator_, buf_, reserved_);
+    }
+    buf_ = buf;
+    reserved_ = reserved;
+    // Offset the end of the new segment such that data stays aligned exactly
+    // as it would be in a contiguous buffer.
+    skew_ = base_ & (buffer_minalign_ - 1);
+    cur_ = buf_ + reserved_ - skew_;
+    scratch_ = buf_ + old_scratch_size;
+  }
+
+  // Makes room for `len` more bytes. Returns false if there is none, as a fixed
+  // buffer overflowed.
+  bool grow(size_t len) {
+    reallocate(len);
+    return !overflowed_;
+  }
+
+  // Called when a fixed buffer is out of space. Leaves no unused space, so
+  // that every later write ends up here too and is dropped.
+  void overflow() {
+    overflowed_ = true;
+    cur_ = scratch_;
+  }
 
   void reallocate(size_t len) {
+    if (fixed_) {
+      overflow();
+      return;
+    }
+    if (segment_size_ && buf_) {
+      add_segment(len);
+      return;
+    }
+    flatten();
     auto old_reserved = reserved_;
     auto old_size = size();
     auto old_scratch_size = scratch_size();
@@ -285,6 +536,8 @@ class vector_downward {
     if (buf_) {
       buf_ = ReallocateDownward(allocator_, buf_, old_reserved, reserved_,
                                 old_size, old_scratch_size);
+      FLATBUFFERS_BUILDER_STAT(
+          stats_.AddReallocation(old_size + old_scratch_size));
     } else {
       buf_ = Allocate(allocator_, reserved_);
     }
@@ -147,6 +147,7 @@ struct EquipmentUnion {
 
   static void *UnPack(const void *obj, Equipment type, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSizeUpperBound() const;
 
   MyGame::Sample::WeaponT *AsWeapon() {
     return type == Equipment_Weapon ?
@@ -477,6 +478,7 @@ inline ::flatbuffers::Offset<Monster> CreateMonsterDirect(
 }
 
 ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const MonsterT &_o);
 
 struct WeaponT : public ::flatbuffers::NativeTable {
   typedef Weapon TableType;
@@ -562,6 +564,7 @@ inline ::flatbuffers::Offset<Weapon> CreateWeaponDirect(
 }
 
 ::flatbuffers::Offset<Weapon> CreateWeapon(::flatbuffers::FlatBufferBuilder &_fbb, const WeaponT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const WeaponT &_o);
 
 
 inline bool operator==(const MonsterT &lhs, const MonsterT &rhs) {
@@ -626,7 +629,7 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
   { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->weapons[_i]) { _e->Get(_i)->UnPackTo(_o->weapons[_i].get(), _resolver); } else { _o->weapons[_i] = std::unique_ptr<MyGame::Sample::WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->weapons.resize(0); } }
   { auto _e = equipped_type(); _o->equipped.type = _e; }
   { auto _e = equipped(); if (_e) _o->equipped.value = MyGame::Sample::EquipmentUnion::UnPack(_e, equipped_type(), _resolver); }
-  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } else { _o->path.resize(0); } }
+  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->path.data()); } else { _o->path.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -637,6 +640,9 @@ inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBui
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const MonsterT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _pos = _o->pos ? _o->pos.get() : nullptr;
   auto _mana = _o->mana;
   auto _hp = _o->hp;
@@ -661,6 +667,17 @@ inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBui
       _path);
 }
 
+inline size_t PackedSizeUpperBound(const MonsterT &_o) {
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(10, 58);
+  _size += ::flatbuffers::PackedStringSizeUpperBound(_o.name.length());
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.inventory.size(), 1, 1);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.weapons.size(), 4, 4);
+  for (const auto &_e : _o.weapons) _size += ::MyGame::Sample::PackedSizeUpperBound(*_e);
+  _size += _o.equipped.PackedSizeUpperBound();
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.path.size(), 12, 4);
+  return _size;
+}
+
 
 inline bool operator==(const WeaponT &lhs, const WeaponT &rhs) {
   return
@@ -694,6 +711,9 @@ inline ::flatbuffers::Offset<Weapon> Weapon::Pack(::flatbuffers::FlatBufferBuild
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const WeaponT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
   auto _damage = _o->damage;
   return MyGame::Sample::CreateWeapon(
@@ -702,6 +722,12 @@ inline ::flatbuffers::Offset<Weapon> Weapon::Pack(::flatbuffers::FlatBufferBuild
       _damage);
 }
 
+inline size_t PackedSizeUpperBound(const WeaponT &_o) {
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(2, 10);
+  _size += ::flatbuffers::PackedStringSizeUpperBound(_o.name.length());
+  return _size;
+}
+
 template <bool B>
 inline bool VerifyEquipment(::flatbuffers::VerifierTemplate<B> &verifier, const void *obj, Equipment type) {
   switch (type) {
@@ -751,6 +777,16 @@ inline ::flatbuffers::Offset<void> EquipmentUnion::Pack(::flatbuffers::FlatBuffe
   }
 }
 
+inline size_t EquipmentUnion::PackedSizeUpperBound() const {
+  switch (type) {
+    case Equipment_Weapon: {
+      auto ptr = reinterpret_cast<const MyGame::Sample::WeaponT *>(value);
+      return ::MyGame::Sample::PackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline EquipmentUnion::EquipmentUnion(const EquipmentUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Equipment_Weapon: {
@@ -70,6 +70,7 @@ CPP_OPTS = [
     "--cpp",
     "--gen-compare",
     "--gen-absl-hash",
+    "--gen-packed-size",
 ] + (["--cpp-std", "c++0x"] if args.cpp_0x else [])
 
 CPP_17_OPTS = NO_INCL_OPTS + [
@@ -590,6 +591,11 @@ flatc(
     schema="union_vector/union_vector.fbs",
     prefix=cpp_17_prefix,
 )
+flatc(
+    CPP_17_OPTS + ["--cpp-pmr", "--gen-compare"],
+    schema="pmr_test.fbs",
+    prefix=cpp_17_prefix,
+)
 
 # Private annotations
 annotations_test_schema = "private_annotation_test.fbs"
@@ -0,0 +1,259 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_stats.h"
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "binary_annotator.h"
+
+namespace flatbuffers {
+
+namespace {
+
+static std::string ToString(const BinarySectionType type) {
+  switch (type) {
+    case BinarySectionType::Header:
+      return "header";
+    case BinarySectionType::Table:
+      return "table";
+    case BinarySectionType::RootTable:
+      return "root_table";
+    case BinarySectionType::VTable:
+      return "vtable";
+    case BinarySectionType::Struct:
+      return "struct";
+    case BinarySectionType::String:
+      return "string";
+    case BinarySectionType::Vector:
+      return "vector";
+    case BinarySectionType::Vector64:
+      return "vector64";
+    case BinarySectionType::Union:
+      return "union";
+    case BinarySectionType::Padding:
+      return "padding";
+    default:
+      return "unknown";
+  }
+}
+
+static bool IsTable(const BinarySection& section) {
+  return section.type == BinarySectionType::Table ||
+         section.type == BinarySectionType::RootTable;
+}
+
+// Sections that hold the out-of-line value of a single field, named
+// `Table.field` by the annotator.
+static bool IsFieldValue(const BinarySection& section) {
+  return section.type == BinarySectionType::String ||
+         section.type == BinarySectionType::Vector ||
+         section.type == BinarySectionType::Vector64 ||
+         section.type == BinarySectionType::Union;
+}
+
+static bool IsInlineField(const BinaryRegionComment& comment) {
+  return comment.type == BinaryRegionCommentType::TableField ||
+         comment.type == BinaryRegionCommentType::TableOffsetField ||
+         comment.type == BinaryRegionCommentType::StructField ||
+         comment.type == BinaryRegionCommentType::ArrayField;
+}
+
+// The annotator decorates the field names of its comments, e.g. "a` (Double)"
+// for scalars or "pos.x" for struct members. Get back the plain field name.
+static std::string FieldName(const std::string& comment_name) {
+  return comment_name.substr(0, comment_name.find_first_of("`."));
+}
+
+static uint64_t SectionLength(const BinarySection& section) {
+  uint64_t length = 0;
+  for (const BinaryRegion& region : section.regions) {
+    length += region.length;
+  }
+  return length;
+}
+
+static void AppendJson(std::stringstream& ss, const BinaryStats::Entry& entry) {
+  ss << "{ \"count\": " << entry.count << ", \"bytes\": " << entry.bytes
+     << " }";
+}
+
+static void AppendJson(std::stringstream& ss, const std::string& key,
+                       const std::map<std::string, BinaryStats::Entry>& map) {
+  ss << "  \"" << key << "\": {";
+  const char* separator = "\n";
+  for (const auto& it : map) {
+    ss << separator << "    \"" << it.first << "\": ";
+    AppendJson(ss, it.second);
+    separator = ",\n";
+  }
+  ss << (map.empty() ? "}" : "\n  }");
+}
+
+static void AppendCsv(std::stringstream& ss, const std::string& category,
+                      const std::string& name,
+                      const BinaryStats::Entry& entry) {
+  ss << category << "," << name << "," << entry.count << "," << entry.bytes
+     << "\n";
+}
+
+}  // namespace
+
+void BinaryStats::Add(const std::map<uint64_t, BinarySection>& sections,
+                      const uint8_t* binary, uint64_t binary_length) {
+  files_.Add(1, binary_length);
+
+  // Strings are only deduplicated within a binary, so only look for duplicates
+  // there.
+  std::set<std::string> strings;
+  uint64_t referenced_vtable_bytes = 0;
+  uint64_t vtable_bytes = 0;
+
+  for (const auto& it : sections) {
+    const BinarySection& section = it.second;
+    const uint64_t length = SectionLength(section);
+
+    sections_[ToString(section.type)].Add(1, length);
+
+    for (const BinaryRegion& region : section.regions) {
+      if (region.comment.status >= BinaryRegionStatus::ERROR) { errors_++; }
+      if (region.comment.type == BinaryRegionCommentType::Padding) {
+        padding_.Add(1, region.length);
+      }
+    }
+
+    if (section.type == BinarySectionType::VTable) {
+      tables_[section.name].vtables.Add(1, length);
+      vtable_bytes += length;
+    } else if (IsTable(section)) {
+      tables_[section.name].instances.Add(1, length);
+
+      // Sum up the bytes of each field first, as a struct field is made up of
+      // a region per member.
+      std::map<std::string, uint64_t> field_bytes;
+      for (const BinaryRegion& region : section.regions) {
+        if (region.comment.type == BinaryRegionCommentType::TableVTableOffset) {
+          const auto vtable = sections.find(region.points_to_offset);
+          if (vtable != sections.end() &&
+              vtable->second.type == BinarySectionType::VTable) {
+            referenced_vtable_bytes += SectionLength(vtable->second);
+          }
+        } else if (IsInlineField(region.comment)) {
+          field_bytes[FieldName(region.comment.name)] += region.length;
+        }
+      }
+      for (const auto& field : field_bytes) {
+        fields_[section.name + "." + field.first].Add(1, field.second);
+      }
+    } else if (IsFieldValue(section)) {
+      // Already counted with the offset to it in its table, so only add the
+      // bytes it points to.
+      fields_[section.name].Add(0, length);
+
+      if (section.type != BinarySectionType::String) { continue; }
+      for (const BinaryRegion& region : section.regions) {
+        if (region.comment.type != BinaryRegionCommentType::StringValue ||
+            region.offset + region.length > binary_length) {
+          continue;
+        }
+        const char* value =
+            reinterpret_cast<const char*>(binary) + region.offset;
+        if (!strings.insert(std::string(value, region.length)).second) {
+          duplicate_strings_.Add(1, length);
+        }
+      }
+    }
+  }
+
+  if (referenced_vtable_bytes > vtable_bytes) {
+    vtable_bytes_saved_ += referenced_vtable_bytes - vtable_bytes;
+  }
+}
+
+double BinaryStats::VTableDedupRatio() const {
+  const auto tables = sections_.find("table");
+  const auto root_tables = sections_.find("root_table");
+  const auto vtables = sections_.find("vtable");
+  if (vtables == sections_.end() || !vtables->second.count) { return 0.0; }
+
+  uint64_t instances = 0;
+  if (tables != sections_.end()) { instances += tables->second.count; }
+  if (root_tables != sections_.end()) {
+    instances += root_tables->second.count;
+  }
+  return static_cast<double>(instances) /
+         static_cast<double>(vtables->second.count);
+}
+
+std::string BinaryStats::ToJson() const {
+  std::stringstream ss;
+  ss << "{\n";
+  ss << "  \"files\": ";
+  AppendJson(ss, files_);
+  ss << ",\n  \"errors\": " << errors_ << ",\n";
+  ss << "  \"padding\": ";
+  AppendJson(ss, padding_);
+  ss << ",\n  \"duplicate_strings\": ";
+  AppendJson(ss, duplicate_strings_);
+  ss << ",\n  \"vtable_dedup_ratio\": " << VTableDedupRatio() << ",\n";
+  ss << "  \"vtable_bytes_saved\": " << vtable_bytes_saved_ << ",\n";
+  AppendJson(ss, "sections", sections_);
+  ss << ",\n  \"tables\": {";
+  const char* separator = "\n";
+  for (const auto& it : tables_) {
+    ss << separator << "    \"" << it.first << "\": { \"instances\": ";
+    AppendJson(ss, it.second.instances);
+    ss << ", \"vtables\": ";
+    AppendJson(ss, it.second.vtables);
+    ss << " }";
+    separator = ",\n";
+  }
+  ss << (tables_.empty() ? "},\n" : "\n  },\n");
+  AppendJson(ss, "fields", fields_);
+  ss << "\n}\n";
+  return ss.str();
+}
+
+std::string BinaryStats::ToCsv() const {
+  std::stringstream ss;
+  ss << "category,name,count,bytes\n";
+  AppendCsv(ss, "files", "", files_);
+  Entry errors;
+  errors.count = errors_;
+  AppendCsv(ss, "errors", "", errors);
+  AppendCsv(ss, "padding", "", padding_);
+  AppendCsv(ss, "duplicate_strings", "", duplicate_strings_);
+  Entry vtable_bytes_saved;
+  vtable_bytes_saved.bytes = vtable_bytes_saved_;
+  AppendCsv(ss, "vtable_bytes_saved", "", vtable_bytes_saved);
+  for (const auto& it : sections_) {
+    AppendCsv(ss, "section", it.first, it.second);
+  }
+  for (const auto& it : tables_) {
+    AppendCsv(ss, "table", it.first, it.second.instances);
+    AppendCsv(ss, "vtable", it.first, it.second.vtables);
+  }
+  for (const auto& it : fields_) {
+    AppendCsv(ss, "field", it.first, it.second);
+  }
+  return ss.str();
+}
+
+}  // namespace flatbuffers
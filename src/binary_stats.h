@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_BINARY_STATS_H_
+#define FLATBUFFERS_BINARY_STATS_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "binary_annotator.h"
+
+namespace flatbuffers {
+
+// Aggregates the sections produced by the BinaryAnnotator into wire-size
+// statistics: where the bytes of one or more binaries go by section type,
+// table type and field, how well vtables are shared, and how many bytes are
+// spent on padding and on strings that appear more than once in a binary.
+//
+// Binaries are added one at a time and only the running totals are kept, so
+// any number of files can be profiled in constant memory.
+class BinaryStats {
+ public:
+  struct Entry {
+    // The number of occurrences (sections, tables, field values, etc..).
+    uint64_t count = 0;
+
+    // The number of bytes they take up in the binaries.
+    uint64_t bytes = 0;
+
+    void Add(uint64_t n, uint64_t b) {
+      count += n;
+      bytes += b;
+    }
+  };
+
+  struct TableEntry {
+    // All instances of the table, without their vtables.
+    Entry instances;
+
+    // The distinct vtables referenced by those instances.
+    Entry vtables;
+  };
+
+  // Adds the annotations of a single binary to the totals.
+  void Add(const std::map<uint64_t, BinarySection>& sections,
+           const uint8_t* binary, uint64_t binary_length);
+
+  // Outputs the totals as a JSON object.
+  std::string ToJson() const;
+
+  // Outputs the totals as CSV rows of `category,name,count,bytes`.
+  std::string ToCsv() const;
+
+  const Entry& files() const { return files_; }
+  const Entry& padding() const { return padding_; }
+  const Entry& duplicate_strings() const { return duplicate_strings_; }
+  const std::map<std::string, Entry>& sections() const { return sections_; }
+  const std::map<std::string, TableEntry>& tables() const { return tables_; }
+  const std::map<std::string, Entry>& fields() const { return fields_; }
+
+  // The number of table instances per vtable, over all binaries. 1.0 means no
+  // vtable was shared.
+  double VTableDedupRatio() const;
+
+  // The number of bytes vtable deduplication saved, i.e. the bytes that would
+  // have been spent if every table instance had its own vtable.
+  uint64_t vtable_bytes_saved() const { return vtable_bytes_saved_; }
+
+ private:
+  Entry files_;
+  Entry padding_;
+  Entry duplicate_strings_;
+  uint64_t vtable_bytes_saved_ = 0;
+  uint64_t errors_ = 0;
+
+  // Section type -> totals.
+  std::map<std::string, Entry> sections_;
+
+  // Table name -> totals.
+  std::map<std::string, TableEntry> tables_;
+
+  // `Table.field` -> totals, counted once per table that has the field, and
+  // covering both the inline part of the field and the string/vector/struct
+  // section it may point to.
+  std::map<std::string, Entry> fields_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_BINARY_STATS_H_
@@ -0,0 +1,611 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flatbuffers/delta.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flatbuffers {
+
+// A delta starts with kDeltaTable followed by the delta of the root table, or
+// kDeltaNewBuffer followed by the new buffer. The delta of a table is a list
+// of ops on its fields, each a varint header `(gap << 3) | op` followed by the
+// op's data, and ends with a 0. `gap` is the index of the field (in the
+// schema's fields of the table) minus that of the previous op, plus 1.
+//
+// The delta of a vector is its new size (a varint), the new elements if it
+// grew (their data as below, without a header), and a list of ops on its
+// elements like those of a table.
+//
+// Sizes are varints, and strings and new tables are stored with their size.
+
+namespace {
+
+enum DeltaOp {
+  // The bytes of a scalar or struct (or of scalars or structs in vectors).
+  kDeltaValue,
+  // The new contents of a string.
+  kDeltaString,
+  // The delta of a table.
+  kDeltaTable,
+  // The delta of a vector.
+  kDeltaVector,
+  // A copy of the new table, as a FlatBuffer.
+  kDeltaNewTable,
+  // The new buffer as a whole.
+  kDeltaNewBuffer,
+};
+
+static const int kDeltaOpBits = 3;
+
+template <typename T>
+static const T* Deref(const uint8_t* offset) {
+  return reinterpret_cast<const T*>(offset + ReadScalar<uoffset_t>(offset));
+}
+
+// Returns the table of the union `field` with `type`, or nullptr if there is
+// none (or it isn't a table).
+static const reflection::Object* UnionTable(const reflection::Schema& schema,
+                                            const reflection::Field& field,
+                                            uint8_t type) {
+  if (!type) return nullptr;
+  auto value =
+      schema.enums()->Get(field.type()->index())->values()->LookupByKey(type);
+  if (!value || !value->union_type() ||
+      value->union_type()->base_type() != reflection::Obj) {
+    return nullptr;
+  }
+  auto object = schema.objects()->Get(value->union_type()->index());
+  return object->is_struct() ? nullptr : object;
+}
+
+// The type of the union `field` in `table`, stored in the field before it.
+static uint8_t UnionType(const Table& table, const reflection::Field& field) {
+  return table.GetField<uint8_t>(
+      static_cast<voffset_t>(field.offset() - sizeof(voffset_t)), 0);
+}
+
+class DeltaWriter {
+ public:
+  DeltaWriter(const reflection::Schema& schema, std::vector<uint8_t>* delta)
+      : schema_(schema), delta_(*delta) {}
+
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+      delta_.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    delta_.push_back(static_cast<uint8_t>(value));
+  }
+
+  void WriteBytes(const uint8_t* data, size_t size) {
+    delta_.insert(delta_.end(), data, data + size);
+  }
+
+  // Writes the delta of the fields of `old_table` to those of `new_table`.
+  // Returns false, writing nothing, if they don't have the same fields.
+  bool DiffTable(const reflection::Object& object, const Table& old_table,
+                 const Table& new_table);
+
+ private:
+  void WriteOp(uoffset_t index, DeltaOp op, uoffset_t* next) {
+    WriteVarint((static_cast<uint64_t>(index + 1 - *next) << kDeltaOpBits) |
+                op);
+    *next = index + 1;
+  }
+
+  void WriteString(const String& str) {
+    WriteVarint(str.size());
+    WriteBytes(str.Data(), str.size());
+  }
+
+  void WriteTable(const reflection::Object& object, const Table& table) {
+    fbb_.Clear();
+    fbb_.Finish(CopyTable(fbb_, schema_, object, table));
+    WriteVarint(fbb_.GetSize());
+    WriteBytes(fbb_.GetBufferPointer(), fbb_.GetSize());
+  }
+
+  bool DiffField(const reflection::Field& field, uoffset_t index,
+                 const Table& old_table, const Table& new_table,
+                 uoffset_t* next);
+  void DiffChild(const reflection::Object& object, const Table& old_table,
+                 const Table& new_table, uoffset_t index, uoffset_t* next);
+  void DiffValue(const uint8_t* old_data, const uint8_t* new_data,
+                 size_t size, uoffset_t index, uoffset_t* next);
+  void DiffString(const String& old_str, const String& new_str,
+                  uoffset_t index, uoffset_t* next);
+  bool DiffVector(const reflection::Field& field, const uint8_t* old_offset,
+                  const uint8_t* new_offset, uoffset_t index,
+                  uoffset_t* next);
+  bool SameUnions(const reflection::Field& field, const Table& old_table,
+                  const Table& new_table);
+
+  const reflection::Schema& schema_;
+  std::vector<uint8_t>& delta_;
+  // Builds the copies of new tables.
+  FlatBufferBuilder fbb_;
+};
+
+bool DeltaWriter::DiffTable(const reflection::Object& object,
+                            const Table& old_table, const Table& new_table) {
+  const size_t start = delta_.size();
+  uoffset_t next = 0;
+  auto fields = object.fields();
+  for (uoffset_t i = 0; i < fields->size(); i++) {
+    auto& field = *fields->Get(i);
+    const bool present = old_table.CheckField(field.offset());
+    if (present != new_table.CheckField(field.offset()) ||
+        (present && !DiffField(field, i, old_table, new_table, &next))) {
+      delta_.resize(start);
+      return false;
+    }
+  }
+  WriteVarint(0);
+  return true;
+}
+
+bool DeltaWriter::DiffField(const reflection::Field& field, uoffset_t index,
+                            const Table& old_table, const Table& new_table,
+                            uoffset_t* next) {
+  auto old_data = old_table.GetAddressOf(field.offset());
+  auto new_data = new_table.GetAddressOf(field.offset());
+  auto base_type = field.type()->base_type();
+  switch (base_type) {
+    case reflection::String:
+      DiffString(*Deref<String>(old_data), *Deref<String>(new_data), index,
+                 next);
+      return true;
+    case reflection::Obj: {
+      auto& object = *schema_.objects()->Get(field.type()->index());
+      if (object.is_struct()) {
+        DiffValue(old_data, new_data, object.bytesize(), index, next);
+      } else {
+        DiffChild(object, *Deref<Table>(old_data), *Deref<Table>(new_data),
+                  index, next);
+      }
+      return true;
+    }
+    case reflection::Union: {
+      auto old_type = UnionTable(schema_, field, UnionType(old_table, field));
+      auto new_type = UnionTable(schema_, field, UnionType(new_table, field));
+      if (!old_type || !new_type) return false;
+      if (old_type == new_type) {
+        DiffChild(*new_type, *Deref<Table>(old_data), *Deref<Table>(new_data),
+                  index, next);
+      } else {
+        WriteOp(index, kDeltaNewTable, next);
+        WriteTable(*new_type, *Deref<Table>(new_data));
+      }
+      return true;
+    }
+    case reflection::Vector:
+      if (field.type()->element() == reflection::Union) {
+        return SameUnions(field, old_table, new_table);
+      }
+      return DiffVector(field, old_data, new_data, index, next);
+    default:
+      if (!IsScalar(base_type)) return false;
+      DiffValue(old_data, new_data, GetTypeSize(base_type), index, next);
+      return true;
+  }
+}
+
+void DeltaWriter::DiffChild(const reflection::Object& object,
+                            const Table& old_table, const Table& new_table,
+                            uoffset_t index, uoffset_t* next) {
+  const size_t start = delta_.size();
+  const uoffset_t start_next = *next;
+  WriteOp(index, kDeltaTable, next);
+  const size_t body = delta_.size();
+  if (!DiffTable(object, old_table, new_table)) {
+    delta_.resize(start);
+    *next = start_next;
+    WriteOp(index, kDeltaNewTable, next);
+    WriteTable(object, new_table);
+  } else if (delta_.size() == body + 1) {
+    // Just the end of the table: nothing changed.
+    delta_.resize(start);
+    *next = start_next;
+  }
+}
+
+void DeltaWriter::DiffValue(const uint8_t* old_data, const uint8_t* new_data,
+                            size_t size, uoffset_t index, uoffset_t* next) {
+  if (memcmp(old_data, new_data, size) == 0) return;
+  WriteOp(index, kDeltaValue, next);
+  WriteBytes(new_data, size);
+}
+
+void DeltaWriter::DiffString(const String& old_str, const String& new_str,
+                             uoffset_t index, uoffset_t* next) {
+  if (old_str.size() == new_str.size() &&
+      memcmp(old_str.Data(), new_str.Data(), new_str.size()) == 0) {
+    return;
+  }
+  WriteOp(index, kDeltaString, next);
+  WriteString(new_str);
+}
+
+bool DeltaWriter::DiffVector(const reflection::Field& field,
+                             const uint8_t* old_offset,
+                             const uint8_t* new_offset, uoffset_t index,
+                             uoffset_t* next) {
+  auto old_vec = Deref<VectorOfAny>(old_offset);
+  auto new_vec = Deref<VectorOfAny>(new_offset);
+  auto element = field.type()->element();
+  auto object = element == reflection::Obj
+                    ? schema_.objects()->Get(field.type()->index())
+                    : nullptr;
+  const bool is_table = object && !object->is_struct();
+  const bool is_inline = IsScalar(element) || (object && object->is_struct());
+  if (!is_inline && !is_table && element != reflection::String) return false;
+  const size_t element_size =
+      GetTypeSizeInline(element, field.type()->index(), schema_);
+  const uoffset_t old_size = old_vec->size();
+  const uoffset_t new_size = new_vec->size();
+  const uoffset_t kept = (std::min)(old_size, new_size);
+  // Vectors of scalars and structs are compared in one go first, as most of
+  // them won't have changed.
+  if (is_inline && old_size == new_size &&
+      memcmp(old_vec->Data(), new_vec->Data(), new_size * element_size) ==
+          0) {
+    return true;
+  }
+
+  const size_t start = delta_.size();
+  const uoffset_t start_next = *next;
+  WriteOp(index, kDeltaVector, next);
+  WriteVarint(new_size);
+  const size_t body = delta_.size();
+  // The new elements come first, so that the offsets to them are set before
+  // the elements before them change.
+  if (is_inline) {
+    WriteBytes(new_vec->Data() + kept * element_size,
+               (new_size - kept) * element_size);
+  } else {
+    for (uoffset_t i = kept; i < new_size; i++) {
+      auto element_offset = new_vec->Data() + i * element_size;
+      if (is_table) {
+        WriteTable(*object, *Deref<Table>(element_offset));
+      } else {
+        WriteString(*Deref<String>(element_offset));
+      }
+    }
+  }
+  uoffset_t element_next = 0;
+  for (uoffset_t i = 0; i < kept; i++) {
+    auto old_element = old_vec->Data() + i * element_size;
+    auto new_element = new_vec->Data() + i * element_size;
+    if (is_table) {
+      DiffChild(*object, *Deref<Table>(old_element),
+                *Deref<Table>(new_element), i, &element_next);
+    } else if (element == reflection::String) {
+      DiffString(*Deref<String>(old_element), *Deref<String>(new_element), i,
+                 &element_next);
+    } else {
+      DiffValue(old_element, new_element, element_size, i, &element_next);
+    }
+  }
+  WriteVarint(0);
+  if (old_size == new_size && delta_.size() == body + 1) {
+    delta_.resize(start);
+    *next = start_next;
+  }
+  return true;
+}
+
+// Vectors of unions aren't patched: this returns whether they are the same,
+// otherwise the table holding them is copied.
+bool DeltaWriter::SameUnions(const reflection::Field& field,
+                             const Table& old_table, const Table& new_table) {
+  auto type_offset =
+      static_cast<voffset_t>(field.offset() - sizeof(voffset_t));
+  auto old_types = old_table.GetPointer<const Vector<uint8_t>*>(type_offset);
+  auto new_types = new_table.GetPointer<const Vector<uint8_t>*>(type_offset);
+  auto old_vec =
+      old_table.GetPointer<const Vector<Offset<Table>>*>(field.offset());
+  auto new_vec =
+      new_table.GetPointer<const Vector<Offset<Table>>*>(field.offset());
+  if (!old_types || !new_types || old_types->size() != new_types->size() ||
+      old_vec->size() != new_vec->size() ||
+      old_vec->size() != old_types->size()) {
+    return false;
+  }
+  const size_t start = delta_.size();
+  for (uoffset_t i = 0; i < old_vec->size(); i++) {
+    if (old_types->Get(i) != new_types->Get(i)) return false;
+    auto object = UnionTable(schema_, field, old_types->Get(i));
+    if (!object) return false;
+    const bool same = DiffTable(*object, *old_vec->Get(i), *new_vec->Get(i)) &&
+                      delta_.size() == start + 1;
+    delta_.resize(start);
+    if (!same) return false;
+  }
+  return true;
+}
+
+class DeltaPatcher {
+ public:
+  DeltaPatcher(const reflection::Schema& schema, const uint8_t* delta,
+               size_t delta_size, std::vector<uint8_t>* flatbuf,
+               const reflection::Object* root_table)
+      : schema_(schema),
+        root_table_(root_table),
+        cur_(delta),
+        end_(delta + delta_size),
+        buf_(*flatbuf) {}
+
+  bool Patch();
+
+ private:
+  bool ReadVarint(uint64_t* value) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64 && cur_ != end_; shift += 7) {
+      const uint8_t byte = *cur_++;
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) {
+        *value = result;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadBytes(uint64_t size, const uint8_t** data) {
+    if (size > static_cast<uint64_t>(end_ - cur_)) return false;
+    *data = cur_;
+    cur_ += size;
+    return true;
+  }
+
+  // Reads the header of the next op into `index` and `op`, or returns true
+  // with `index` set to `limit` at the end of the list.
+  bool ReadOp(uoffset_t limit, uoffset_t* next, uoffset_t* index,
+              DeltaOp* op) {
+    uint64_t header;
+    if (!ReadVarint(&header)) return false;
+    if (!header) {
+      *index = limit;
+      return true;
+    }
+    const uint64_t gap = header >> kDeltaOpBits;
+    if (!gap || gap > limit - *next) return false;
+    *index = static_cast<uoffset_t>(*next + gap - 1);
+    *op = static_cast<DeltaOp>(header & ((1 << kDeltaOpBits) - 1));
+    *next = *index + 1;
+    return true;
+  }
+
+  Table* TableAt(uoffset_t position) {
+    return reinterpret_cast<Table*>(buf_.data() + position);
+  }
+
+  uoffset_t Deref(uoffset_t offset) const {
+    return offset + ReadScalar<uoffset_t>(buf_.data() + offset);
+  }
+
+  // Sets the offset at `offset` to `target`, which is appended after it.
+  void SetOffset(uoffset_t offset, uoffset_t target) {
+    WriteScalar<uoffset_t>(buf_.data() + offset, target - offset);
+  }
+
+  bool PatchValue(uoffset_t position, size_t size) {
+    const uint8_t* data;
+    if (!ReadBytes(size, &data)) return false;
+    memcpy(buf_.data() + position, data, size);
+    return true;
+  }
+
+  // Appends the string or table of the next op, and sets `offset` to it.
+  bool AppendString(uoffset_t offset);
+  bool AppendTable(uoffset_t offset);
+
+  bool PatchTable(const reflection::Object& object, uoffset_t table);
+  bool PatchVector(const reflection::Field& field, uoffset_t vec);
+
+  const reflection::Schema& schema_;
+  const reflection::Object* root_table_;
+  const uint8_t* cur_;
+  const uint8_t* end_;
+  // Only positions are kept, as patching moves the buffer.
+  std::vector<uint8_t>& buf_;
+};
+
+bool DeltaPatcher::Patch() {
+  uint64_t op;
+  if (!ReadVarint(&op)) return false;
+  if (op == kDeltaNewBuffer) {
+    buf_.assign(cur_, end_);
+    return true;
+  }
+  if (op != kDeltaTable || buf_.size() < sizeof(uoffset_t)) return false;
+  auto& root = root_table_ ? *root_table_ : *schema_.root_table();
+  return PatchTable(root, Deref(0)) && cur_ == end_;
+}
+
+bool DeltaPatcher::AppendString(uoffset_t offset) {
+  uint64_t size;
+  const uint8_t* data;
+  if (!ReadVarint(&size) || !ReadBytes(size, &data)) return false;
+  while (buf_.size() & (sizeof(uoffset_t) - 1)) buf_.push_back(0);
+  const uoffset_t str = static_cast<uoffset_t>(buf_.size());
+  // The length, the characters and the terminating 0.
+  buf_.resize(buf_.size() + sizeof(uoffset_t) + static_cast<size_t>(size) + 1);
+  WriteScalar<uoffset_t>(buf_.data() + str, static_cast<uoffset_t>(size));
+  if (size) memcpy(buf_.data() + str + sizeof(uoffset_t), data, size);
+  SetOffset(offset, str);
+  return true;
+}
+
+bool DeltaPatcher::AppendTable(uoffset_t offset) {
+  uint64_t size;
+  const uint8_t* data;
+  if (!ReadVarint(&size) || !ReadBytes(size, &data)) return false;
+  auto table = AddFlatBuffer(buf_, data, static_cast<size_t>(size));
+  if (!table) return false;
+  SetOffset(offset, static_cast<uoffset_t>(table - buf_.data()));
+  return true;
+}
+
+bool DeltaPatcher::PatchTable(const reflection::Object& object,
+                              uoffset_t table) {
+  auto fields = object.fields();
+  uoffset_t next = 0;
+  for (;;) {
+    uoffset_t index;
+    DeltaOp op;
+    if (!ReadOp(fields->size(), &next, &index, &op)) return false;
+    if (index == fields->size()) return true;
+    auto& field = *fields->Get(index);
+    const voffset_t field_offset =
+        TableAt(table)->GetOptionalFieldOffset(field.offset());
+    if (!field_offset) return false;
+    const uoffset_t position = table + field_offset;
+    auto base_type = field.type()->base_type();
+    const reflection::Object* child = nullptr;
+    if (base_type == reflection::Obj) {
+      child = schema_.objects()->Get(field.type()->index());
+    } else if (base_type == reflection::Union) {
+      child = UnionTable(schema_, field, UnionType(*TableAt(table), field));
+    }
+    const bool is_table = child && !child->is_struct();
+    bool ok = false;
+    switch (op) {
+      case kDeltaValue:
+        if (IsScalar(base_type)) {
+          ok = PatchValue(position, GetTypeSize(base_type));
+        } else if (child && child->is_struct()) {
+          ok = PatchValue(position, child->bytesize());
+        }
+        break;
+      case kDeltaString:
+        ok = base_type == reflection::String && AppendString(position);
+        break;
+      case kDeltaTable:
+        ok = is_table && PatchTable(*child, Deref(position));
+        break;
+      case kDeltaNewTable:
+        ok = (is_table || base_type == reflection::Union) &&
+             AppendTable(position);
+        break;
+      case kDeltaVector:
+        ok = base_type == reflection::Vector &&
+             PatchVector(field, Deref(position));
+        break;
+      default:
+        break;
+    }
+    if (!ok) return false;
+  }
+}
+
+bool DeltaPatcher::PatchVector(const reflection::Field& field,
+                               uoffset_t vec) {
+  auto element = field.type()->element();
+  auto object = element == reflection::Obj
+                    ? schema_.objects()->Get(field.type()->index())
+                    : nullptr;
+  const bool is_table = object && !object->is_struct();
+  const bool is_string = element == reflection::String;
+  if (!IsScalar(element) && !object && !is_string) return false;
+  const uoffset_t element_size = static_cast<uoffset_t>(
+      GetTypeSizeInline(element, field.type()->index(), schema_));
+  uint64_t size;
+  if (!ReadVarint(&size) ||
+      size > FLATBUFFERS_MAX_BUFFER_SIZE / element_size) {
+    return false;
+  }
+  const uoffset_t old_size = ReadScalar<uoffset_t>(buf_.data() + vec);
+  const uoffset_t new_size = static_cast<uoffset_t>(size);
+  if (new_size != old_size) {
+    if (new_size < old_size && (is_table || is_string)) {
+      // ResizeAnyVector() clears the elements it removes before it adjusts
+      // the offsets in the buffer, which would then follow theirs.
+      WriteScalar(buf_.data() + vec, new_size);
+    }
+    ResizeAnyVector(schema_, new_size,
+                    reinterpret_cast<const VectorOfAny*>(buf_.data() + vec),
+                    old_size, element_size, &buf_, root_table_);
+  }
+  const uoffset_t elements = vec + static_cast<uoffset_t>(sizeof(uoffset_t));
+  if (new_size > old_size && !is_table && !is_string) {
+    if (!PatchValue(elements + old_size * element_size,
+                    (new_size - old_size) * element_size)) {
+      return false;
+    }
+  }
+  for (uoffset_t i = old_size; i < new_size && (is_table || is_string); i++) {
+    const uoffset_t position = elements + i * element_size;
+    if (!(is_table ? AppendTable(position) : AppendString(position))) {
+      return false;
+    }
+  }
+  const uoffset_t kept = (std::min)(old_size, new_size);
+  uoffset_t next = 0;
+  for (;;) {
+    uoffset_t index;
+    DeltaOp op;
+    if (!ReadOp(kept, &next, &index, &op)) return false;
+    if (index == kept) return true;
+    const uoffset_t position = elements + index * element_size;
+    bool ok = false;
+    switch (op) {
+      case kDeltaValue:
+        ok = !is_table && !is_string && PatchValue(position, element_size);
+        break;
+      case kDeltaString:
+        ok = is_string && AppendString(position);
+        break;
+      case kDeltaTable:
+        ok = is_table && PatchTable(*object, Deref(position));
+        break;
+      case kDeltaNewTable:
+        ok = is_table && AppendTable(position);
+        break;
+      default:
+        break;
+    }
+    if (!ok) return false;
+  }
+}
+
+}  // namespace
+
+void DiffFlatBuffers(const reflection::Schema& schema, const uint8_t* old_buf,
+                     const uint8_t* new_buf, size_t new_size,
+                     std::vector<uint8_t>* delta,
+                     const reflection::Object* root_table) {
+  delta->clear();
+  DeltaWriter writer(schema, delta);
+  writer.WriteVarint(kDeltaTable);
+  if (!writer.DiffTable(root_table ? *root_table : *schema.root_table(),
+                        *GetAnyRoot(old_buf), *GetAnyRoot(new_buf))) {
+    delta->clear();
+    writer.WriteVarint(kDeltaNewBuffer);
+    writer.WriteBytes(new_buf, new_size);
+  }
+}
+
+bool PatchFlatBuffer(const reflection::Schema& schema, const uint8_t* delta,
+                     size_t delta_size, std::vector<uint8_t>* flatbuf,
+                     const reflection::Object* root_table) {
+  DeltaPatcher patcher(schema, delta, delta_size, flatbuf, root_table);
+  return patcher.Patch();
+}
+
+}  // namespace flatbuffers
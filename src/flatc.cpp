@@ -25,8 +25,11 @@
 
 #include "annotated_binary_text_gen.h"
 #include "binary_annotator.h"
+#include "binary_stats.h"
 #include "flatbuffers/code_generator.h"
 #include "flatbuffers/idl.h"
+#include "flatbuffers/record_stream.h"
+#include "flatbuffers/transcoder.h"
 #include "flatbuffers/util.h"
 
 namespace flatbuffers {
@@ -116,6 +119,9 @@ const static FlatCOption flatc_options[] = {
      "Generate type name functions for C++ and Rust."},
     {"", "gen-object-api", "", "Generate an additional object-based API."},
     {"", "gen-compare", "", "Generate operator== for object-based API types."},
+    {"", "gen-packed-size", "",
+     "Generate PackedSizeUpperBound() for object-based API types, used by "
+     "Pack() to size the builder once (C++ only)."},
     {"", "gen-nullable", "",
      "Add Clang _Nullable for C++ pointer. or @Nullable for Java"},
     {"", "java-package-prefix", "",
@@ -158,6 +164,14 @@ const static FlatCOption flatc_options[] = {
      "When using C++17, generate extra code to provide compile-time (static) "
      "reflection of Flatbuffers types. Requires --cpp-std to be \"c++17\" or "
      "higher."},
+    {"", "cpp-static-vtables", "",
+     "Also generate CreateXWithStaticVTable() functions, which store all the "
+     "fields of a table using a vtable computed at compile time, for tables "
+     "without optional scalars, unions or 64-bit offsets."},
+    {"", "cpp-pmr", "",
+     "Generate an object-based API backed by std::pmr: strings and vectors "
+     "are std::pmr types and UnPack() can allocate everything from a "
+     "memory_resource. Requires --cpp-std to be \"c++17\" or higher."},
     {"", "object-prefix", "PREFIX",
      "Customize class prefix for C++ object-based API."},
     {"", "object-suffix", "SUFFIX",
@@ -173,6 +187,17 @@ const static FlatCOption flatc_options[] = {
      "Allow binaries without file_identifier to be read. This may crash flatc "
      "given a mismatched schema."},
     {"", "size-prefixed", "", "Input binaries are size prefixed buffers."},
+    {"", "record-stream", "",
+     "Input binaries are record streams, or size prefixed buffers one after "
+     "the other. --json outputs the records one after the other, --binary "
+     "converts them to a record stream (.fbrs) with an index and checksums."},
+    {"", "transcode-from", "FILE",
+     "Convert the binaries given after -- from the schema FILE (.fbs or .bfbs) "
+     "to the schema given, field by field, into PATH/BINARY_FILE.EXT (.fbrs "
+     "with --record-stream). Fields are matched by name."},
+    {"", "transcode-mapping", "FILE",
+     "Lines of `target = source` names, for the tables and fields "
+     "--transcode-from can't match by name, e.g. `NS.Monster.hp = health`."},
     {"", "proto-namespace-suffix", "SUFFIX",
      "Add this namespace to any flatbuffers generated from protobufs."},
     {"", "oneof-union", "", "Translate .proto oneofs to flatbuffer unions."},
@@ -253,6 +278,11 @@ const static FlatCOption flatc_options[] = {
     {"", "annotate-sparse-vectors", "", "Don't annotate every vector element."},
     {"", "annotate", "SCHEMA",
      "Annotate the provided BINARY_FILE with the specified SCHEMA file."},
+    {"", "stats", "SCHEMA",
+     "Print a JSON wire-size profile of all the provided BINARY_FILEs, "
+     "annotated with the specified SCHEMA file: bytes per section type, "
+     "table and field, vtable sharing, padding and duplicate strings."},
+    {"", "stats-csv", "", "Print the --stats profile as CSV instead."},
     {"", "no-leak-private-annotation", "",
      "Prevents multiple type of annotations within a Fbs SCHEMA file. "
      "Currently this is required to generate private types in Rust"},
@@ -447,6 +477,36 @@ void FlatCompiler::AnnotateBinaries(const uint8_t* binary_schema,
   }
 }
 
+void FlatCompiler::ProfileBinaries(const uint8_t* binary_schema,
+                                   const uint64_t binary_schema_size,
+                                   const FlatCOptions& options) {
+  flatbuffers::BinaryStats stats;
+
+  // Only the running totals are kept, so each binary and its annotations can
+  // be dropped as soon as it has been added.
+  for (const std::string& filename : options.filenames) {
+    std::string binary_contents;
+    if (!flatbuffers::LoadFile(filename.c_str(), true, &binary_contents)) {
+      Warn("unable to load binary file: " + filename);
+      continue;
+    }
+
+    const uint8_t* binary =
+        reinterpret_cast<const uint8_t*>(binary_contents.c_str());
+    const size_t binary_size = binary_contents.size();
+
+    flatbuffers::BinaryAnnotator binary_annotator(
+        binary_schema, binary_schema_size, binary, binary_size,
+        options.opts.size_prefixed);
+
+    stats.Add(binary_annotator.Annotate(), binary, binary_size);
+  }
+
+  const std::string output =
+      options.annotate_stats_csv ? stats.ToCsv() : stats.ToJson();
+  printf("%s", output.c_str());
+}
+
 FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
                                                          const char** argv) {
   if (argc <= 1) {
@@ -532,6 +592,8 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         opts.generate_object_based_api = true;
       } else if (arg == "--gen-compare") {
         opts.gen_compare = true;
+      } else if (arg == "--gen-packed-size") {
+        opts.gen_packed_size = true;
       } else if (arg == "--gen-absl-hash") {
         opts.gen_absl_hash = true;
       } else if (arg == "--cpp-include") {
@@ -592,6 +654,14 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         options.raw_binary = true;
       } else if (arg == "--size-prefixed") {
         opts.size_prefixed = true;
+      } else if (arg == "--record-stream") {
+        options.record_stream = true;
+      } else if (arg == "--transcode-from") {
+        if (++argi >= argc) Error("missing path following: " + arg, true);
+        options.transcode_from = flatbuffers::PosixPath(argv[argi]);
+      } else if (arg == "--transcode-mapping") {
+        if (++argi >= argc) Error("missing path following: " + arg, true);
+        options.transcode_mapping = flatbuffers::PosixPath(argv[argi]);
       } else if (arg == "--") {  // Separator between text and binary inputs.
         options.binary_files_from = options.filenames.size();
       } else if (arg == "--proto-namespace-suffix") {
@@ -677,6 +747,11 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         opts.cpp_std = arg.substr(std::string("--cpp-std=").size());
       } else if (arg == "--cpp-static-reflection") {
         opts.cpp_static_reflection = true;
+      } else if (arg == "--cpp-static-vtables") {
+        opts.cpp_static_vtables = true;
+      } else if (arg == "--cpp-pmr") {
+        opts.cpp_pmr = true;
+        opts.generate_object_based_api = true;
       } else if (arg == "--cs-global-alias") {
         opts.cs_global_alias = true;
       } else if (arg == "--json-nested-bytes") {
@@ -720,6 +795,12 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
       } else if (arg == "--annotate") {
         if (++argi >= argc) Error("missing path following: " + arg, true);
         options.annotate_schema = flatbuffers::PosixPath(argv[argi]);
+      } else if (arg == "--stats") {
+        if (++argi >= argc) Error("missing path following: " + arg, true);
+        options.annotate_schema = flatbuffers::PosixPath(argv[argi]);
+        options.annotate_stats = true;
+      } else if (arg == "--stats-csv") {
+        options.annotate_stats_csv = true;
       } else if (arg == "--file-names-only") {
         options.file_names_only = true;
       } else if (arg == "--grpc-filename-suffix") {
@@ -800,10 +881,23 @@ void FlatCompiler::ValidateOptions(const FlatCOptions& options) {
   if (opts.proto_mode && options.any_generator) {
     Warn("cannot generate code directly from .proto files", true);
   } else if (!options.any_generator && options.conform_to_schema.empty() &&
-             options.annotate_schema.empty()) {
+             options.annotate_schema.empty() &&
+             options.transcode_from.empty()) {
     Error("no options: specify at least one generator.", true);
   }
 
+  if (!options.transcode_from.empty() && options.any_generator) {
+    Error("--transcode-from can't be used with generators.");
+  }
+  if (!options.transcode_mapping.empty() && options.transcode_from.empty()) {
+    Error("--transcode-mapping requires --transcode-from.");
+  }
+
+  if (options.record_stream &&
+      (opts.lang_to_generate & ~(IDLOptions::kJson | IDLOptions::kBinary))) {
+    Error("--record-stream can only be used with --json and --binary.");
+  }
+
   if (opts.cs_gen_json_serializer && !opts.generate_object_based_api) {
     Error(
         "--cs-gen-json-serializer requires --gen-object-api to be set as "
@@ -837,8 +931,220 @@ flatbuffers::Parser FlatCompiler::GetConformParser(
   return conform_parser;
 }
 
-std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions& options,
-                                                   Parser& conform_parser) {
+void FlatCompiler::ConvertRecordStream(const FlatCOptions& options,
+                                       const Parser& parser,
+                                       const std::string& filename) {
+  RecordStreamReader reader;
+  if (!reader.Open(filename)) {
+    Error("unable to load record stream: " + filename, false);
+  }
+  if (!options.raw_binary && !parser.file_identifier_.length()) {
+    Error("current schema has no file_identifier: cannot test if \"" +
+          filename +
+          "\" matches the schema, use --raw-binary to read this file anyway.");
+  }
+  const std::string filebase =
+      flatbuffers::StripPath(flatbuffers::StripExtension(filename));
+  const bool json = options.opts.lang_to_generate & IDLOptions::kJson;
+  const bool binary = options.opts.lang_to_generate & IDLOptions::kBinary;
+  const std::string stream_filename =
+      options.output_path + filebase + ".fbrs";
+  if (binary && flatbuffers::AbsolutePath(stream_filename) ==
+                    flatbuffers::AbsolutePath(filename)) {
+    Error("converting \"" + filename + "\" would overwrite it.", false);
+  }
+  flatbuffers::EnsureDirExists(options.output_path);
+  RecordStreamWriter writer;
+  if (binary && !writer.Open(stream_filename)) {
+    Error("unable to write record stream: " + stream_filename, false);
+  }
+  std::string text;
+  for (auto it = reader.begin(); it != reader.end(); ++it) {
+    const RecordStreamReader::Record record = *it;
+    const std::string record_name =
+        "record " + NumToString(it.index()) + " of \"" + filename + "\"";
+    if (!reader.CheckRecord(record)) Error(record_name + " is damaged", false);
+    if (!options.raw_binary &&
+        !flatbuffers::BufferHasIdentifier(record.data,
+                                          parser.file_identifier_.c_str())) {
+      Error(record_name + " does not have expected file_identifier \"" +
+                parser.file_identifier_ +
+                "\", use --raw-binary to read this file anyway.",
+            false);
+    }
+    const uint8_t* size_prefixed = record.data - sizeof(uoffset_t);
+    if (json) {
+      std::string record_text;
+      const char* err = GenText(
+          parser, parser.opts.size_prefixed ? size_prefixed : record.data,
+          &record_text);
+      if (err) Error("unable to generate text for " + record_name + ": " + err);
+      text += record_text;
+    }
+    if (binary && !writer.Append(size_prefixed)) {
+      Error("unable to write record stream: " + stream_filename, false);
+    }
+  }
+  if (binary && !writer.Close()) {
+    Error("unable to write record stream: " + stream_filename, false);
+  }
+  if (json && !flatbuffers::SaveFile(
+                  (options.output_path + filebase + ".json").c_str(), text,
+                  false)) {
+    Error("unable to write text for " + filename, false);
+  }
+}
+
+std::string FlatCompiler::GetTranscodeSchema(const FlatCOptions& options) {
+  if (options.transcode_from.empty()) return "";
+  std::string contents;
+  if (!flatbuffers::LoadFile(options.transcode_from.c_str(), true,
+                             &contents)) {
+    Error("unable to load schema: " + options.transcode_from);
+  }
+  if (flatbuffers::GetExtension(options.transcode_from) ==
+      reflection::SchemaExtension()) {
+    flatbuffers::Verifier verifier(
+        reinterpret_cast<const uint8_t*>(contents.c_str()), contents.size());
+    if (!reflection::VerifySchemaBuffer(verifier)) {
+      Error("failed to load binary schema: " + options.transcode_from, false);
+    }
+    return contents;
+  }
+  flatbuffers::Parser parser(options.opts);
+  ParseFile(parser, options.transcode_from, contents,
+            options.include_directories);
+  parser.Serialize();
+  return std::string(
+      reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
+      parser.builder_.GetSize());
+}
+
+void FlatCompiler::TranscodeBinary(const FlatCOptions& options,
+                                   Parser& parser,
+                                   const std::string& source_schema,
+                                   const std::string& filename) {
+  parser.Serialize();
+  const std::string target_schema(
+      reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
+      parser.builder_.GetSize());
+  Transcoder transcoder(*reflection::GetSchema(source_schema.c_str()),
+                        *reflection::GetSchema(target_schema.c_str()));
+  TranscoderMapping mapping;
+  if (!options.transcode_mapping.empty()) {
+    std::string text;
+    std::string error;
+    if (!flatbuffers::LoadFile(options.transcode_mapping.c_str(), false,
+                               &text)) {
+      Error("unable to load mapping: " + options.transcode_mapping, false);
+    }
+    if (!mapping.Parse(text.c_str(), &error)) {
+      Error(options.transcode_mapping + ": " + error, false);
+    }
+  }
+  if (!transcoder.Compile(mapping)) {
+    Error("cannot transcode from " + options.transcode_from + ": " +
+              transcoder.error(),
+          false);
+  }
+  auto source_root = transcoder.source_root();
+  if (!source_root) {
+    Error("cannot transcode from " + options.transcode_from +
+              ": no source root table",
+          false);
+    return;
+  }
+  auto file_ident = transcoder.source().schema().file_ident();
+  const std::string source_identifier = file_ident ? file_ident->str() : "";
+  if (!options.raw_binary && source_identifier.empty()) {
+    Error("schema " + options.transcode_from +
+          " has no file_identifier: cannot test if \"" + filename +
+          "\" matches the schema, use --raw-binary to read this file anyway.");
+  }
+  const std::string filebase =
+      flatbuffers::StripPath(flatbuffers::StripExtension(filename));
+  std::string extension = parser.file_extension_;
+  if (options.record_stream) {
+    extension = "fbrs";
+  } else if (extension.empty()) {
+    extension = "bin";
+  }
+  const std::string output_filename =
+      options.output_path + filebase + "." + extension;
+  if (flatbuffers::AbsolutePath(output_filename) ==
+      flatbuffers::AbsolutePath(filename)) {
+    Error("transcoding \"" + filename + "\" would overwrite it.", false);
+  }
+  flatbuffers::EnsureDirExists(options.output_path);
+
+  // Checks a buffer (without size prefix) before it is transcoded.
+  auto check = [&](const uint8_t* data, size_t size, const std::string& name) {
+    if (!options.raw_binary &&
+        !flatbuffers::BufferHasIdentifier(data, source_identifier.c_str())) {
+      Error(name + " does not have expected file_identifier \"" +
+                source_identifier +
+                "\", use --raw-binary to read this file anyway.",
+            false);
+    }
+    if (!Verify(*source_root, data, size)) {
+      Error(name + " does not match the schema " + options.transcode_from,
+            false);
+    }
+  };
+
+  FlatBufferBuilder builder;
+  if (options.record_stream) {
+    RecordStreamReader reader;
+    if (!reader.Open(filename)) {
+      Error("unable to load record stream: " + filename, false);
+    }
+    RecordStreamWriter writer;
+    if (!writer.Open(output_filename)) {
+      Error("unable to write record stream: " + output_filename, false);
+    }
+    for (auto it = reader.begin(); it != reader.end(); ++it) {
+      const RecordStreamReader::Record record = *it;
+      const std::string record_name =
+          "record " + NumToString(it.index()) + " of \"" + filename + "\"";
+      if (!reader.CheckRecord(record)) {
+        Error(record_name + " is damaged", false);
+      }
+      check(record.data, record.size, record_name);
+      builder.Clear();
+      transcoder.Transcode(record.data - sizeof(uoffset_t), builder, true);
+      if (!writer.Append(builder)) {
+        Error("unable to write record stream: " + output_filename, false);
+      }
+    }
+    if (!writer.Close()) {
+      Error("unable to write record stream: " + output_filename, false);
+    }
+    return;
+  }
+
+  std::string contents;
+  if (!flatbuffers::LoadFile(filename.c_str(), true, &contents)) {
+    Error("unable to load file: " + filename);
+  }
+  auto data = reinterpret_cast<const uint8_t*>(contents.c_str());
+  size_t size = contents.size();
+  const size_t prefix_size = options.opts.size_prefixed ? sizeof(uoffset_t) : 0;
+  if (size < prefix_size + sizeof(uoffset_t)) {
+    Error("binary \"" + filename + "\" is too small", false);
+  }
+  check(data + prefix_size, size - prefix_size, "binary \"" + filename + "\"");
+  transcoder.Transcode(data, builder, options.opts.size_prefixed);
+  if (!flatbuffers::SaveFile(
+          output_filename.c_str(),
+          reinterpret_cast<const char*>(builder.GetBufferPointer()),
+          builder.GetSize(), true)) {
+    Error("unable to write binary: " + output_filename, false);
+  }
+}
+
+std::unique_ptr<Parser> FlatCompiler::GenerateCode(
+    const FlatCOptions& options, Parser& conform_parser,
+    const std::string& transcode_schema) {
   std::unique_ptr<Parser> parser =
       std::unique_ptr<Parser>(new Parser(options.opts));
 
@@ -847,12 +1153,21 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions& options,
     IDLOptions opts = options.opts;
 
     auto& filename = *file_it;
+    bool is_binary = static_cast<size_t>(file_it - options.filenames.begin()) >=
+                     options.binary_files_from;
+    if (is_binary && !options.transcode_from.empty()) {
+      TranscodeBinary(options, *parser, transcode_schema, filename);
+      continue;
+    }
+    if (is_binary && options.record_stream) {
+      ConvertRecordStream(options, *parser, filename);
+      continue;
+    }
+
     std::string contents;
     if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
       Error("unable to load file: " + filename);
 
-    bool is_binary = static_cast<size_t>(file_it - options.filenames.begin()) >=
-                     options.binary_files_from;
     auto ext = flatbuffers::GetExtension(filename);
     const bool is_schema = ext == "fbs" || ext == "proto";
     if (is_schema && opts.project_root.empty()) {
@@ -1066,19 +1381,27 @@ int FlatCompiler::Compile(const FlatCOptions& options) {
             options.annotate_schema);
     }
 
-    // Annotate the provided files with the binary_schema.
-    AnnotateBinaries(binary_schema, binary_schema_size, options);
+    if (options.annotate_stats) {
+      // Profile the provided files with the binary_schema.
+      ProfileBinaries(binary_schema, binary_schema_size, options);
+    } else {
+      // Annotate the provided files with the binary_schema.
+      AnnotateBinaries(binary_schema, binary_schema_size, options);
+    }
 
     // We don't support doing anything else after annotating a binary.
     return 0;
   }
 
-  if (options.generators.empty() && options.conform_to_schema.empty()) {
+  if (options.generators.empty() && options.conform_to_schema.empty() &&
+      options.transcode_from.empty()) {
     Error("No generator registered");
     return -1;
   }
 
-  std::unique_ptr<Parser> parser = GenerateCode(options, conform_parser);
+  const std::string transcode_schema = GetTranscodeSchema(options);
+  std::unique_ptr<Parser> parser =
+      GenerateCode(options, conform_parser, transcode_schema);
 
   for (const auto& code_generator : options.generators) {
     if (code_generator->SupportsRootFileGeneration()) {
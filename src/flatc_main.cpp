@@ -32,6 +32,7 @@
 #include "idl_gen_java.h"
 #include "idl_gen_json_schema.h"
 #include "idl_gen_kotlin.h"
+#include "idl_gen_layout.h"
 #include "idl_gen_lobster.h"
 #include "idl_gen_php.h"
 #include "idl_gen_python.h"
@@ -135,6 +136,13 @@ int main(int argc, const char* argv[]) {
           "Generate Kotlin multiplatform classes for tables/structs"},
       flatbuffers::NewKotlinKMPCodeGenerator());
 
+  flatc.RegisterCodeGenerator(
+      flatbuffers::FlatCOption{
+          "", "layout-report", "",
+          "Generate a report on the padding and vtable sizes of the "
+          "structs/tables, with wire compatible ways to reduce them"},
+      flatbuffers::NewLayoutReportCodeGenerator());
+
   flatc.RegisterCodeGenerator(
       flatbuffers::FlatCOption{"", "lobster", "",
                                "Generate Lobster files for tables/structs"},
@@ -0,0 +1,516 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flatbuffers/flex_json.h"
+
+#include <cstring>
+#include <limits>
+
+#include "flatbuffers/util.h"
+
+#if !defined(FLATBUFFERS_MAX_PARSING_DEPTH)
+#  define FLATBUFFERS_MAX_PARSING_DEPTH 64
+#endif
+
+namespace flexbuffers {
+
+namespace {
+
+// The first pass works on blocks of 64 bytes, in eight 64 bit words, turning
+// each into a bitmap with a bit per byte of the block for each class of
+// characters. This is what simdjson does with SIMD instructions, but with
+// plain integer arithmetic.
+static const size_t kBlockSize = 64;
+static const uint64_t kOnes = 0x0101010101010101ULL;
+static const uint64_t kHighBits = 0x8080808080808080ULL;
+
+// Sets the high bit of each byte of `word` that is `c`.
+inline uint64_t Equal(uint64_t word, uint8_t c) {
+  const uint64_t x = word ^ (kOnes * c);
+  return ~(((x & ~kHighBits) + ~kHighBits) | x) & kHighBits;
+}
+
+// Sets the high bit of each byte of `word` that is less than `c` (<= 0x80).
+inline uint64_t Less(uint64_t word, uint8_t c) {
+  return ~(((word & ~kHighBits) + kOnes * (0x80 - c)) | word) & kHighBits;
+}
+
+// Gathers the high bits of the bytes of `bytes` into the low 8 bits.
+inline uint64_t Gather(uint64_t bytes) {
+  return ((bytes >> 7) * 0x0102040810204080ULL) >> 56;
+}
+
+// Bit `i` is the xor of bits [0, i] of `bits`: set inside a pair of quotes.
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+inline uint32_t TrailingZeros(uint64_t bits) {
+  // clang-format off
+  #if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(bits));
+  #else
+    static const uint8_t kDeBruijn[64] = {
+      0,  1,  2,  53, 3,  7,  54, 27, 4,  38, 41, 8,  34, 55, 48, 28,
+      62, 5,  39, 46, 44, 42, 22, 9,  24, 35, 59, 56, 49, 18, 29, 11,
+      63, 52, 6,  26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+      51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12,
+    };
+    return kDeBruijn[((bits & (0 - bits)) * 0x022FDD63CC95386DULL) >> 58];
+  #endif
+  // clang-format on
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Doubles that are exact, for numbers with few enough digits to convert
+// exactly by multiplying or dividing by one of these.
+static const double kPowersOf10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+}  // namespace
+
+bool JsonParser::Parse(const char* json, size_t length, Builder* builder) {
+  builder_ = builder;
+  json_ = json;
+  length_ = length;
+  next_ = 0;
+  error_.clear();
+  bool ok = IndexStructurals() && ParseValue(0);
+  if (ok) {
+    const size_t rest = NextPosition();
+    if (rest != length_) ok = Error(rest, "expected the end of the JSON");
+  }
+  if (ok) {
+    builder->Finish();
+  } else {
+    builder->Clear();
+  }
+  return ok;
+}
+
+bool JsonParser::IndexStructurals() {
+  if (length_ >= 0xFFFFFFFFu) return Error(0, "JSON too large");
+  // At most every byte is structural, plus the end.
+  if (structurals_.size() < length_ + 1) structurals_.resize(length_ + 1);
+  uint32_t* out = structurals_.data();
+  uint64_t non_ascii = 0;
+  // Whether the last byte of the block before is an escaped character, is
+  // inside a string or is part of a number or literal.
+  uint64_t prev_escaped = 0;
+  uint64_t prev_in_string = 0;
+  uint64_t prev_scalar = 0;
+  for (size_t block = 0; block < length_; block += kBlockSize) {
+    const char* data = json_ + block;
+    char padded[kBlockSize];
+    if (length_ - block < kBlockSize) {
+      memset(padded, ' ', kBlockSize);
+      memcpy(padded, data, length_ - block);
+      data = padded;
+    }
+    uint64_t quotes = 0;
+    uint64_t backslashes = 0;
+    uint64_t operators = 0;
+    uint64_t spaces = 0;
+    uint64_t controls = 0;
+    for (size_t i = 0; i < kBlockSize / 8; i++) {
+      uint64_t word;
+      memcpy(&word, data + i * 8, 8);
+      word = flatbuffers::EndianScalar(word);
+      non_ascii |= word;
+      // '{' and '[', and '}' and ']', differ only in the 0x20 bit.
+      const uint64_t brackets = word | (kOnes * 0x20);
+      const size_t shift = i * 8;
+      quotes |= Gather(Equal(word, '"')) << shift;
+      backslashes |= Gather(Equal(word, '\\')) << shift;
+      operators |= Gather(Equal(brackets, '{') | Equal(brackets, '}') |
+                          Equal(word, ':') | Equal(word, ','))
+                   << shift;
+      spaces |= Gather(Equal(word, ' ') | Equal(word, '\n') |
+                       Equal(word, '\r') | Equal(word, '\t'))
+                << shift;
+      controls |= Gather(Less(word, 0x20)) << shift;
+    }
+
+    // A backslash escapes the next character, unless it is escaped itself.
+    // Escapes are rare enough to find one at a time.
+    uint64_t escaped = prev_escaped;
+    prev_escaped = 0;
+    for (uint64_t escapes = backslashes & ~escaped; escapes;) {
+      const uint32_t i = TrailingZeros(escapes);
+      if (i == 63) {
+        prev_escaped = 1;
+        break;
+      }
+      escaped |= uint64_t(1) << (i + 1);
+      escapes &= ~(uint64_t(3) << i);
+    }
+    quotes &= ~escaped;
+
+    // Opening quotes are inside the strings, closing quotes outside.
+    const uint64_t in_string = PrefixXor(quotes) ^ prev_in_string;
+    prev_in_string = 0 - (in_string >> 63);
+    if (controls & in_string) {
+      return Error(block + TrailingZeros(controls & in_string),
+                   "control character in string");
+    }
+    operators &= ~in_string;
+    const uint64_t scalars = ~(in_string | operators | spaces | quotes);
+    const uint64_t scalar_starts = scalars & ~((scalars << 1) | prev_scalar);
+    prev_scalar = scalars >> 63;
+
+    for (uint64_t bits = operators | quotes | scalar_starts; bits;
+         bits &= bits - 1) {
+      *out++ = static_cast<uint32_t>(block + TrailingZeros(bits));
+    }
+  }
+  if (prev_in_string) return Error(length_, "unterminated string");
+  has_non_ascii_ = (non_ascii & kHighBits) != 0;
+  *out++ = static_cast<uint32_t>(length_);
+  num_structurals_ = static_cast<size_t>(out - structurals_.data());
+  return true;
+}
+
+size_t JsonParser::NextPosition() {
+  const size_t position = structurals_[next_];
+  // Stay on the end.
+  if (next_ + 1 < num_structurals_) next_++;
+  return position;
+}
+
+char JsonParser::PeekChar() const { return CharAt(structurals_[next_]); }
+
+bool JsonParser::ParseValue(int depth) {
+  const size_t position = NextPosition();
+  if (depth >= FLATBUFFERS_MAX_PARSING_DEPTH) {
+    return Error(position, "JSON nested too deeply");
+  }
+  switch (CharAt(position)) {
+    case '{': {
+      const size_t start = builder_->StartMap();
+      if (PeekChar() == '}') {
+        NextPosition();
+      } else {
+        for (;;) {
+          const size_t key = NextPosition();
+          if (CharAt(key) != '"') return Error(key, "expected a key");
+          if (!ParseString(key)) return false;
+          builder_->Key(scratch_);
+          const size_t colon = NextPosition();
+          if (CharAt(colon) != ':') return Error(colon, "expected ':'");
+          if (!ParseValue(depth + 1)) return false;
+          const size_t separator = NextPosition();
+          if (CharAt(separator) == '}') break;
+          if (CharAt(separator) != ',') {
+            return Error(separator, "expected ',' or '}'");
+          }
+        }
+      }
+      builder_->EndMap(start);
+      if (builder_->HasDuplicateKeys()) {
+        return Error(position, "map has duplicate keys");
+      }
+      return true;
+    }
+    case '[': {
+      const size_t start = builder_->StartVector();
+      if (PeekChar() == ']') {
+        NextPosition();
+      } else {
+        for (;;) {
+          if (!ParseValue(depth + 1)) return false;
+          const size_t separator = NextPosition();
+          if (CharAt(separator) == ']') break;
+          if (CharAt(separator) != ',') {
+            return Error(separator, "expected ',' or ']'");
+          }
+        }
+      }
+      builder_->EndVector(start, false, false);
+      return true;
+    }
+    case '"':
+      if (!ParseString(position)) return false;
+      builder_->String(scratch_);
+      return true;
+    case 't':
+    case 'f':
+    case 'n': return ParseLiteral(position);
+    case '\0':
+      if (position == length_) return Error(position, "expected a value");
+      return Error(position, "unexpected character");
+    default:
+      if (CharAt(position) == '-' || IsDigit(CharAt(position))) {
+        return ParseNumber(position);
+      }
+      return Error(position, "unexpected character");
+  }
+}
+
+bool JsonParser::ParseString(size_t position) {
+  // The closing quote is the next structural.
+  const size_t begin = position + 1;
+  const size_t end = NextPosition();
+  const char* str = json_ + begin;
+  const size_t size = end - begin;
+  if (has_non_ascii_) {
+    // The closing quote stops FromUTF8() at the end.
+    for (const char* p = str; p < str + size;) {
+      if (static_cast<unsigned char>(*p) < 0x80) {
+        p++;
+      } else if (flatbuffers::FromUTF8(&p) < 0) {
+        return Error(static_cast<size_t>(p - json_), "invalid UTF-8");
+      }
+    }
+  }
+  // The builder copies the strings along with the null that ends them.
+  if (!memchr(str, '\\', size)) {
+    scratch_.assign(str, size);
+    return true;
+  }
+  return Unescape(begin, end);
+}
+
+bool JsonParser::Unescape(size_t begin, size_t end) {
+  scratch_.clear();
+  const char* p = json_ + begin;
+  const char* const str_end = json_ + end;
+  while (p < str_end) {
+    const char* backslash = static_cast<const char*>(
+        memchr(p, '\\', static_cast<size_t>(str_end - p)));
+    if (!backslash) backslash = str_end;
+    scratch_.append(p, backslash);
+    if (backslash == str_end) break;
+    // The first pass made sure something follows the backslash.
+    p = backslash + 2;
+    switch (backslash[1]) {
+      case '"': scratch_ += '"'; break;
+      case '\\': scratch_ += '\\'; break;
+      case '/': scratch_ += '/'; break;
+      case 'b': scratch_ += '\b'; break;
+      case 'f': scratch_ += '\f'; break;
+      case 'n': scratch_ += '\n'; break;
+      case 'r': scratch_ += '\r'; break;
+      case 't': scratch_ += '\t'; break;
+      case 'u': {
+        uint32_t ucc;
+        if (!ParseHex4(p, str_end, &ucc)) {
+          return Error(static_cast<size_t>(backslash - json_),
+                       "invalid \\u escape");
+        }
+        p += 4;
+        if (ucc >= 0xD800 && ucc <= 0xDBFF) {
+          // A surrogate pair.
+          uint32_t low;
+          if (str_end - p < 6 || p[0] != '\\' || p[1] != 'u' ||
+              !ParseHex4(p + 2, str_end, &low) || low < 0xDC00 ||
+              low > 0xDFFF) {
+            return Error(static_cast<size_t>(backslash - json_),
+                         "unpaired surrogate in \\u escape");
+          }
+          p += 6;
+          ucc = 0x10000 + ((ucc - 0xD800) << 10) + (low - 0xDC00);
+        } else if (ucc >= 0xDC00 && ucc <= 0xDFFF) {
+          return Error(static_cast<size_t>(backslash - json_),
+                       "unpaired surrogate in \\u escape");
+        }
+        flatbuffers::ToUTF8(ucc, &scratch_);
+        break;
+      }
+      default:
+        return Error(static_cast<size_t>(backslash - json_),
+                     "invalid escape");
+    }
+  }
+  return true;
+}
+
+bool JsonParser::ParseHex4(const char* p, const char* end, uint32_t* value) {
+  if (end - p < 4) return false;
+  *value = 0;
+  for (int i = 0; i < 4; i++) {
+    const char c = p[i];
+    uint32_t digit;
+    if (IsDigit(c)) {
+      digit = static_cast<uint32_t>(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      digit = static_cast<uint32_t>(c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      digit = static_cast<uint32_t>(c - 'A' + 10);
+    } else {
+      return false;
+    }
+    *value = *value * 16 + digit;
+  }
+  return true;
+}
+
+bool JsonParser::ParseNumber(size_t position) {
+  const char* const start = json_ + position;
+  const char* const end = json_ + length_;
+  const char* p = start;
+  const bool negative = *p == '-';
+  if (negative) p++;
+  // The digits, as long as they fit, and the power of 10 to multiply those
+  // with.
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  bool truncated = false;
+  bool is_integer = true;
+  if (p == end || !IsDigit(*p)) return Error(position, "invalid number");
+  if (*p == '0') {
+    p++;
+  } else {
+    for (; p != end && IsDigit(*p); p++) {
+      const uint64_t digit = static_cast<uint64_t>(*p - '0');
+      if (mantissa <= (~uint64_t(0) - digit) / 10) {
+        mantissa = mantissa * 10 + digit;
+      } else {
+        truncated = true;
+        exponent++;
+      }
+    }
+  }
+  if (p != end && *p == '.') {
+    is_integer = false;
+    if (++p == end || !IsDigit(*p)) return Error(position, "invalid number");
+    for (; p != end && IsDigit(*p); p++) {
+      const uint64_t digit = static_cast<uint64_t>(*p - '0');
+      if (!truncated && mantissa <= (~uint64_t(0) - digit) / 10) {
+        mantissa = mantissa * 10 + digit;
+        exponent--;
+      } else {
+        truncated = true;
+      }
+    }
+  }
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    is_integer = false;
+    p++;
+    bool negative_exponent = false;
+    if (p != end && (*p == '-' || *p == '+')) negative_exponent = *p++ == '-';
+    if (p == end || !IsDigit(*p)) return Error(position, "invalid number");
+    int exponent_digits = 0;
+    for (; p != end && IsDigit(*p); p++) {
+      // Way beyond the range of a double.
+      if (exponent_digits < 100000) {
+        exponent_digits = exponent_digits * 10 + (*p - '0');
+      }
+    }
+    exponent += negative_exponent ? -exponent_digits : exponent_digits;
+  }
+  if (!EndsToken(static_cast<size_t>(p - json_))) {
+    return Error(position, "invalid number");
+  }
+
+  if (is_integer && !truncated) {
+    const uint64_t int64_max = static_cast<uint64_t>(
+        (std::numeric_limits<int64_t>::max)());
+    if (!negative && mantissa <= int64_max) {
+      builder_->Int(static_cast<int64_t>(mantissa));
+      return true;
+    }
+    if (!negative) {
+      builder_->UInt(mantissa);
+      return true;
+    }
+    if (mantissa <= int64_max) {
+      builder_->Int(-static_cast<int64_t>(mantissa));
+      return true;
+    }
+    if (mantissa == int64_max + 1) {
+      builder_->Int((std::numeric_limits<int64_t>::min)());
+      return true;
+    }
+  }
+  // A mantissa of up to 53 bits and a power of 10 of up to 22 are both exact
+  // doubles, so a single multiplication or division rounds correctly.
+  if (!truncated && mantissa <= (uint64_t(1) << 53) && exponent >= -22 &&
+      exponent <= 22) {
+    double d = static_cast<double>(mantissa);
+    d = exponent < 0 ? d / kPowersOf10[-exponent] : d * kPowersOf10[exponent];
+    builder_->Double(negative ? -d : d);
+    return true;
+  }
+  scratch_.assign(start, p);
+  double d;
+  if (!flatbuffers::StringToNumber(scratch_.c_str(), &d)) {
+    return Error(position, "invalid number");
+  }
+  builder_->Double(d);
+  return true;
+}
+
+bool JsonParser::ParseLiteral(size_t position) {
+  static const char* const kLiterals[] = { "true", "false", "null" };
+  for (size_t i = 0; i < 3; i++) {
+    const size_t size = strlen(kLiterals[i]);
+    if (length_ - position >= size &&
+        !memcmp(json_ + position, kLiterals[i], size) &&
+        EndsToken(position + size)) {
+      if (i == 2) {
+        builder_->Null();
+      } else {
+        builder_->Bool(i == 0);
+      }
+      return true;
+    }
+  }
+  return Error(position, "unexpected character");
+}
+
+bool JsonParser::EndsToken(size_t position) const {
+  switch (CharAt(position)) {
+    case '\0': return position == length_;
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+    case ',':
+    case ':':
+    case '[':
+    case ']':
+    case '{':
+    case '}':
+    case '"': return true;
+    default: return false;
+  }
+}
+
+bool JsonParser::Error(size_t position, const char* message) {
+  size_t line = 1;
+  size_t line_start = 0;
+  for (size_t i = 0; i < position && i < length_; i++) {
+    if (json_[i] == '\n') {
+      line++;
+      line_start = i + 1;
+    }
+  }
+  error_ = flatbuffers::NumToString(line) + ":" +
+           flatbuffers::NumToString(position - line_start + 1) + ": " +
+           message;
+  return false;
+}
+
+}  // namespace flexbuffers
@@ -457,6 +457,9 @@ class CppGenerator : public BaseGenerator {
     }
 
     code_ += "#include \"flatbuffers/flatbuffers.h\"";
+    if (opts_.cpp_pmr) {
+      code_ += "#include \"flatbuffers/pmr.h\"";
+    }
     if (parser_.uses_flexbuffers_) {
       code_ += "#include \"flatbuffers/flexbuffers.h\"";
       code_ += "#include \"flatbuffers/flex_flat_util.h\"";
@@ -753,6 +756,31 @@ class CppGenerator : public BaseGenerator {
         code_ += "(GetSizePrefixed{{STRUCT_NAME}}(buf)->UnPack(res));";
         code_ += "}";
         code_ += "";
+
+        if (HasPmrUnPack(struct_def)) {
+          code_.SetValue("NATIVE_NAME", native_name);
+          code_ +=
+              "inline ::flatbuffers::pmr_unique_ptr<{{NATIVE_NAME}}> "
+              "UnPack{{STRUCT_NAME}}(";
+          code_ += "    const void *buf, std::pmr::memory_resource *resource,";
+          code_ +=
+              "    const ::flatbuffers::resolver_function_t *res = nullptr) {";
+          code_ += "  return Get{{STRUCT_NAME}}(buf)->UnPack(resource, res);";
+          code_ += "}";
+          code_ += "";
+
+          code_ +=
+              "inline ::flatbuffers::pmr_unique_ptr<{{NATIVE_NAME}}> "
+              "UnPackSizePrefixed{{STRUCT_NAME}}(";
+          code_ += "    const void *buf, std::pmr::memory_resource *resource,";
+          code_ +=
+              "    const ::flatbuffers::resolver_function_t *res = nullptr) {";
+          code_ +=
+              "  return GetSizePrefixed{{STRUCT_NAME}}(buf)->UnPack(resource, "
+              "res);";
+          code_ += "}";
+          code_ += "";
+        }
       }
     }
 
@@ -781,6 +809,9 @@ class CppGenerator : public BaseGenerator {
   const IDLOptionsCpp opts_;
   const TypedFloatConstantGenerator float_const_gen_;
   bool needs_64_bit_builder_ = false;
+  // The tables PackedSizeUpperBound() isn't generated for.
+  std::unordered_set<const StructDef*> unbounded_packed_sizes_;
+  bool packed_size_bounds_found_ = false;
 
   const Namespace* CurrentNameSpace() const { return cur_name_space_; }
 
@@ -959,6 +990,27 @@ class CppGenerator : public BaseGenerator {
     return ptr_type == "naked" ? "" : ".get()";
   }
 
+  // Whether a field is owned through the memory_resource aware pointer type
+  // used by --cpp-pmr.
+  bool IsPmrPtr(const FieldDef& field) {
+    const auto& ptr_type = PtrType(&field);
+    return (ptr_type == "default_ptr_type" ? opts_.cpp_object_api_pointer_type
+                                           : ptr_type) ==
+           "::flatbuffers::pmr_unique_ptr";
+  }
+
+  // Whether a native table member is a std::pmr string or vector, which has
+  // to be constructed with the table's allocator.
+  bool IsPmrMember(const FieldDef& field) {
+    if (!opts_.cpp_pmr || field.deprecated) return false;
+    const auto& type = field.value.type;
+    if (IsString(type)) return NativeString(&field) == "std::pmr::string";
+    if (!IsVector(type) || type.element == BASE_TYPE_UTYPE) return false;
+    return !field.attributes.Lookup("cpp_type") &&
+           !(type.struct_def &&
+             type.struct_def->attributes.Lookup("native_custom_alloc"));
+  }
+
   std::string GenOptionalNull() { return "::flatbuffers::nullopt"; }
 
   std::string GenOptionalDecl(const Type& type) {
@@ -980,6 +1032,8 @@ class CppGenerator : public BaseGenerator {
               type.struct_def->attributes.Lookup("native_custom_alloc");
           return "std::vector<" + type_name + "," +
                  native_custom_alloc->constant + "<" + type_name + ">>";
+        } else if (opts_.cpp_pmr) {
+          return "std::pmr::vector<" + type_name + ">";
         } else {
           return "std::vector<" + type_name + ">";
         }
@@ -1171,6 +1225,70 @@ class CppGenerator : public BaseGenerator {
            (inclass ? " = nullptr" : "") + ")";
   }
 
+  std::string PackedSizeUpperBoundSignature(const StructDef& struct_def) {
+    return "size_t PackedSizeUpperBound(const " +
+           NativeName(Name(struct_def), &struct_def, opts_) + " &_o)";
+  }
+
+  // Tables mapped to a user provided native_type are packed by user code, so
+  // the size of those, and of any table or union that may contain one, can't
+  // be bounded.
+  bool HasPackedSizeUpperBound(const StructDef& struct_def) {
+    if (!packed_size_bounds_found_) FindPackedSizeUpperBounds();
+    return !struct_def.fixed && !unbounded_packed_sizes_.count(&struct_def);
+  }
+
+  bool HasPackedSizeUpperBound(const EnumDef& union_def) {
+    for (const auto& ev : union_def.Vals()) {
+      const auto& type = ev->union_type;
+      if (IsTable(type) && !HasPackedSizeUpperBound(*type.struct_def)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool HasPackedSizeUpperBound(const Type& type) {
+    const Type elem_type = IsVector(type) ? type.VectorType() : type;
+    if (elem_type.base_type == BASE_TYPE_UNION) {
+      return HasPackedSizeUpperBound(*elem_type.enum_def);
+    }
+    return !IsTable(elem_type) ||
+           HasPackedSizeUpperBound(*elem_type.struct_def);
+  }
+
+  // Marks the tables with a native_type, then those that contain a marked
+  // table, until there are no more of those, as tables may contain each other.
+  void FindPackedSizeUpperBounds() {
+    packed_size_bounds_found_ = true;
+    for (const auto* struct_def : parser_.structs_.vec) {
+      if (!struct_def->fixed && struct_def->attributes.Lookup("native_type")) {
+        unbounded_packed_sizes_.insert(struct_def);
+      }
+    }
+    for (bool changed = true; changed;) {
+      changed = false;
+      for (const auto* struct_def : parser_.structs_.vec) {
+        if (!HasPackedSizeUpperBound(*struct_def)) continue;
+        for (const auto* field : struct_def->fields.vec) {
+          if (!field->deprecated &&
+              !HasPackedSizeUpperBound(field->value.type)) {
+            unbounded_packed_sizes_.insert(struct_def);
+            changed = true;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // Fully qualified, as unions have a member function of the same name.
+  std::string PackedSizeUpperBoundName(const StructDef& struct_def) {
+    return "::" + TranslateNameSpace(
+                      struct_def.defined_namespace->GetFullyQualifiedName(
+                          "PackedSizeUpperBound"));
+  }
+
   std::string TableUnPackSignature(const StructDef& struct_def, bool inclass,
                                    const IDLOptions& opts) {
     return NativeName(Name(struct_def), &struct_def, opts) + " *" +
@@ -1179,6 +1297,22 @@ class CppGenerator : public BaseGenerator {
            (inclass ? " = nullptr" : "") + ") const";
   }
 
+  // Tables generated with --cpp-pmr can also be unpacked into a
+  // memory_resource, unless they are replaced by a user provided native_type.
+  bool HasPmrUnPack(const StructDef& struct_def) const {
+    return opts_.cpp_pmr && !struct_def.attributes.Lookup("native_type");
+  }
+
+  std::string TablePmrUnPackSignature(const StructDef& struct_def,
+                                      bool inclass, const IDLOptions& opts) {
+    return "::flatbuffers::pmr_unique_ptr<" +
+           NativeName(Name(struct_def), &struct_def, opts) + "> " +
+           (inclass ? "" : Name(struct_def) + "::") +
+           "UnPack(std::pmr::memory_resource *_resource, "
+           "const ::flatbuffers::resolver_function_t *_resolver" +
+           (inclass ? " = nullptr" : "") + ") const";
+  }
+
   std::string TableUnPackToSignature(const StructDef& struct_def, bool inclass,
                                      const IDLOptions& opts) {
     return "void " + (inclass ? "" : Name(struct_def) + "::") + "UnPackTo(" +
@@ -1402,6 +1536,9 @@ class CppGenerator : public BaseGenerator {
     code_ += "";
     GenEnumArray(enum_def);
     GenEnumStringTable(enum_def);
+    if (opts_.cpp_static_reflection) {
+      GenEnumStaticReflection(enum_def);
+    }
 
     // Generate type traits for unions to map from a type to union enum value.
     if (enum_def.is_union && !enum_def.uses_multiple_type_instances) {
@@ -1434,6 +1571,45 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // Sample for Any:
+  //
+  //   inline const char *EnumName(Any e) { return EnumNameAny(e); }
+  //
+  //   template<typename F>
+  //   void VisitUnion(Any type, const void *obj, F &&f) {
+  //     switch (type) {
+  //       case Any::Monster: f(static_cast<const Monster *>(obj)); break;
+  //       ...
+  //       default: break;
+  //     }
+  //   }
+  //
+  // Found by argument dependent lookup, so generic code (see
+  // flatbuffers/static_reflection.h) can name enum values and reach the value
+  // of a union from its type.
+  void GenEnumStaticReflection(const EnumDef& enum_def) {
+    code_ +=
+        "inline const char *EnumName({{ENUM_NAME}} e) { "
+        "return EnumName{{ENUM_NAME}}(e); }";
+    code_ += "";
+    if (!enum_def.is_union) return;
+    code_ += "template<typename F>";
+    code_ +=
+        "void VisitUnion({{ENUM_NAME}} type, const void *obj, F &&f) {";
+    code_ += "  switch (type) {";
+    for (const auto& ev : enum_def.Vals()) {
+      if (!ev->IsNonZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, *ev));
+      code_.SetValue("TYPE", GetUnionElement(*ev, false, opts_));
+      code_ +=
+          "    case {{LABEL}}: f(static_cast<const {{TYPE}} *>(obj)); break;";
+    }
+    code_ += "    default: break;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
   // Generate a union type and a trait type for it.
   void GenEnumObjectBasedAPI(const EnumDef& enum_def) {
     if (!(opts_.generate_object_based_api && enum_def.is_union)) {
@@ -1498,6 +1674,9 @@ class CppGenerator : public BaseGenerator {
     }
     code_ += "  " + UnionUnPackSignature(enum_def, true) + ";";
     code_ += "  " + UnionPackSignature(enum_def, true) + ";";
+    if (opts_.gen_packed_size && HasPackedSizeUpperBound(enum_def)) {
+      code_ += "  size_t PackedSizeUpperBound() const;";
+    }
     code_ += "";
 
     for (const auto ev : enum_def.Vals()) {
@@ -1783,6 +1962,10 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      if (opts_.gen_packed_size && HasPackedSizeUpperBound(enum_def)) {
+        GenUnionPackedSizeUpperBound(enum_def);
+      }
+
       // Union copy constructor
       code_ +=
           "inline {{ENUM_NAME}}Union::{{ENUM_NAME}}Union(const "
@@ -2047,6 +2230,28 @@ class CppGenerator : public BaseGenerator {
     // aggregate initialization, do not emit a default constructor at all, with
     // the exception of types that need a copy/move ctors and assignment
     // operators.
+    if (opts_.cpp_pmr) {
+      // Allocator aware, so std::pmr containers of tables and
+      // ::flatbuffers::pmr_make_unique() pass their allocator on.
+      std::string initializer_list = "::flatbuffers::PmrNativeTable(_alloc)";
+      for (const auto& field : struct_def.fields.vec) {
+        if (IsPmrMember(*field)) {
+          initializer_list += ",\n        " + Name(*field) + "(_alloc)";
+        }
+      }
+      code_.SetValue("INIT_LIST", initializer_list);
+      code_ += "  {{NATIVE_NAME}}() = default;";
+      code_ += "  explicit {{NATIVE_NAME}}(const allocator_type &_alloc)";
+      code_ += "      : {{INIT_LIST}} {";
+      code_ += "  }";
+      code_ +=
+          "  {{NATIVE_NAME}}(const {{NATIVE_NAME}} &o, "
+          "const allocator_type &_alloc);";
+      code_ +=
+          "  {{NATIVE_NAME}}({{NATIVE_NAME}} &&o, "
+          "const allocator_type &_alloc);";
+      return;
+    }
     if (opts_.g_cpp_std >= cpp::CPP_STD_11) {
       if (NeedsCopyCtorAssignOp(struct_def)) {
         code_ += "  {{NATIVE_NAME}}() = default;";
@@ -2113,6 +2318,13 @@ class CppGenerator : public BaseGenerator {
     code_ +=
         "  {{NATIVE_NAME}}({{NATIVE_NAME}}&&) FLATBUFFERS_NOEXCEPT = "
         "default;";
+    if (opts_.cpp_pmr) {
+      // Swapping std::pmr containers with different allocators is undefined,
+      // so assign member by member instead.
+      code_ += "  {{NATIVE_NAME}} &operator=(const {{NATIVE_NAME}} &o);";
+      code_ += "  {{NATIVE_NAME}} &operator=({{NATIVE_NAME}}&&) = default;";
+      return;
+    }
     code_ +=
         "  {{NATIVE_NAME}} &operator=({{NATIVE_NAME}} o) FLATBUFFERS_NOEXCEPT;";
   }
@@ -2121,12 +2333,18 @@ class CppGenerator : public BaseGenerator {
   void GenCopyCtorAssignOpDefs(const StructDef& struct_def) {
     if (opts_.g_cpp_std < cpp::CPP_STD_11) return;
     if (!NeedsCopyCtorAssignOp(struct_def)) return;
-    std::string initializer_list;
+    // Like the std::pmr containers, a copy uses the default resource.
+    std::string initializer_list =
+        opts_.cpp_pmr ? "::flatbuffers::PmrNativeTable(o)" : "";
     std::string vector_copies;
     std::string swaps;
+    std::string assigns;
     for (const auto& field : struct_def.fields.vec) {
       const auto& type = field->value.type;
       if (field->deprecated || type.base_type == BASE_TYPE_UTYPE) continue;
+      CodeWriter assign("  ");
+      assign.IncrementIdentLevel();
+      assign.SetValue("FIELD", Name(*field));
       if (type.base_type == BASE_TYPE_STRUCT) {
         if (!initializer_list.empty()) {
           initializer_list += ",\n        ";
@@ -2142,14 +2360,19 @@ class CppGenerator : public BaseGenerator {
         CodeWriter cw;
         cw.SetValue("FIELD", Name(*field));
         cw.SetValue("TYPE", type_name);
+        assign.SetValue("TYPE", type_name);
         if (is_ptr) {
           cw +=
               "{{FIELD}}((o.{{FIELD}}) ? new {{TYPE}}(*o.{{FIELD}}) : "
               "nullptr)\\";
           initializer_list += cw.ToString();
+          assign +=
+              "{{FIELD}} = decltype({{FIELD}})((o.{{FIELD}}) ? "
+              "new {{TYPE}}(*o.{{FIELD}}) : nullptr);";
         } else {
           cw += "{{FIELD}}(o.{{FIELD}})\\";
           initializer_list += cw.ToString();
+          assign += "{{FIELD}} = o.{{FIELD}};";
         }
       } else if (IsVector(type)) {
         const auto vec_type = type.VectorType();
@@ -2175,7 +2398,15 @@ class CppGenerator : public BaseGenerator {
               "{{FIELD}}.emplace_back(({{FIELD}}_) ? new {{TYPE}}(*{{FIELD}}_) "
               ": nullptr); }";
           vector_copies += cw.ToString();
+          assign.SetValue("TYPE", type_name);
+          assign += "{{FIELD}}.clear();";
+          assign += "{{FIELD}}.reserve(o.{{FIELD}}.size());";
+          assign +=
+              "for (const auto &{{FIELD}}_ : o.{{FIELD}}) { "
+              "{{FIELD}}.emplace_back(({{FIELD}}_) ? new {{TYPE}}(*{{FIELD}}_) "
+              ": nullptr); }";
         } else {
+          assign += "{{FIELD}} = o.{{FIELD}};";
           // For non-pointer elements, use std::vector's copy constructor in the
           // initializer list. This will yield better performance than an insert
           // range loop for trivially-copyable element types.
@@ -2193,7 +2424,9 @@ class CppGenerator : public BaseGenerator {
         cw.SetValue("FIELD", Name(*field));
         cw += "{{FIELD}}(o.{{FIELD}})\\";
         initializer_list += cw.ToString();
+        assign += "{{FIELD}} = o.{{FIELD}};";
       }
+      assigns += assign.ToString();
       {
         if (!swaps.empty()) {
           swaps += "\n  ";
@@ -2221,6 +2454,15 @@ class CppGenerator : public BaseGenerator {
         "inline {{NATIVE_NAME}}::{{NATIVE_NAME}}(const {{NATIVE_NAME}} &o)"
         "{{INIT_LIST}} {";
     code_ += "{{VEC_COPY}}}\n";
+    if (opts_.cpp_pmr) {
+      code_.SetValue("ASSIGNS", assigns);
+      code_ +=
+          "inline {{NATIVE_NAME}} &{{NATIVE_NAME}}::operator="
+          "(const {{NATIVE_NAME}} &o) {";
+      code_ += "  if (this == &o) return *this;";
+      code_ += "{{ASSIGNS}}  return *this;\n}\n";
+      return;
+    }
     code_ +=
         "inline {{NATIVE_NAME}} &{{NATIVE_NAME}}::operator="
         "({{NATIVE_NAME}} o) FLATBUFFERS_NOEXCEPT {";
@@ -2228,6 +2470,106 @@ class CppGenerator : public BaseGenerator {
     code_ += "  return *this;\n}\n";
   }
 
+  // Generate the allocator-extended copy and move constructors of a table
+  // generated with --cpp-pmr, with which std::pmr containers construct the
+  // tables they hold (e.g. those of a native_inline vector) from their own
+  // memory_resource. Sub-tables are copied into that resource as well.
+  void GenPmrAllocatorCtorDefs(const StructDef& struct_def) {
+    std::string copy_list = "::flatbuffers::PmrNativeTable(_alloc)";
+    std::string move_list = copy_list;
+    std::string vector_copies;
+    std::string move_body;
+    std::string move_same;
+    std::string move_other;
+    bool has_fields = false;
+    for (const auto& field : struct_def.fields.vec) {
+      const auto& type = field->value.type;
+      if (field->deprecated || type.base_type == BASE_TYPE_UTYPE) continue;
+      if (IsVector(type) && type.element == BASE_TYPE_UTYPE) continue;
+      const auto cpp_type = field->attributes.Lookup("cpp_type");
+      const auto cpp_ptr_type = field->attributes.Lookup("cpp_ptr_type");
+      const bool custom_ptr = cpp_type && cpp_ptr_type->constant != "naked";
+      bool is_ptr = false;
+      std::string type_name;
+      if (type.base_type == BASE_TYPE_STRUCT) {
+        is_ptr = !(IsStruct(type) && field->native_inline) || custom_ptr;
+        type_name = cpp_type ? cpp_type->constant
+                             : GenTypeNative(type, /*invector*/ false, *field,
+                                             /*forcopy*/ true);
+      } else if (IsVector(type)) {
+        is_ptr = IsVectorOfPointers(*field) || custom_ptr;
+        type_name = cpp_type ? cpp_type->constant
+                             : GenTypeNative(type.VectorType(),
+                                             /*invector*/ true, *field,
+                                             /*forcopy*/ true);
+      }
+      // A copy of a pointed to table or struct.
+      const auto copy_of = [&](const std::string& ptr) {
+        return "(" + ptr + ") ? " +
+               (IsPmrPtr(*field) && !cpp_type
+                    ? "::flatbuffers::pmr_make_unique<" + type_name +
+                          ">(_alloc.resource(), *" + ptr + ")"
+                    : "new " + type_name + "(*" + ptr + ")") +
+               " : nullptr";
+      };
+      const std::string name = Name(*field);
+      const std::string alloc_arg = IsPmrMember(*field) ? ", _alloc" : "";
+      has_fields = true;
+      const std::string empty = IsPmrMember(*field) ? "(_alloc)" : "()";
+      // Statements copying the pointed to tables of `o` into this table.
+      const auto deep_copy = [&](const std::string& indent) {
+        if (!IsVector(type)) {
+          return indent + name + " = " + copy_of("o." + name) + ";\n";
+        }
+        return indent + name + ".reserve(o." + name + ".size());\n" +
+               indent + "for (const auto &" + name + "_ : o." + name + ") { " +
+               name + ".emplace_back(" + copy_of(name + "_") + "); }\n";
+      };
+      copy_list += ",\n        ";
+      move_list += ",\n        ";
+      if (IsVector(type) && is_ptr) {
+        copy_list += name + empty;
+        vector_copies += deep_copy("  ");
+      } else if (is_ptr) {
+        copy_list += name + "(" + copy_of("o." + name) + ")";
+      } else {
+        copy_list += name + "(o." + name + alloc_arg + ")";
+      }
+      if (is_ptr && IsPmrPtr(*field) && !cpp_type) {
+        // Tables owned by another resource can't be moved into this one, the
+        // move falls back to a copy, as it does for the std::pmr containers.
+        move_list += name + empty;
+        move_same += "    " + name + " = std::move(o." + name + ");\n";
+        move_other += deep_copy("    ");
+      } else {
+        move_list += name + "(std::move(o." + name + ")" + alloc_arg + ")";
+      }
+    }
+    if (!move_same.empty()) {
+      move_body = "  if (o.get_allocator() == _alloc) {\n" + move_same +
+                  "  } else {\n" + move_other + "  }\n";
+    }
+    if (!has_fields) {
+      // A table without fields doesn't use `o`.
+      vector_copies = move_body = "  (void)o;\n";
+    }
+    code_.SetValue("NATIVE_NAME",
+                   NativeName(Name(struct_def), &struct_def, opts_));
+    code_.SetValue("INIT_LIST", copy_list);
+    code_.SetValue("VEC_COPY", vector_copies);
+    code_ +=
+        "inline {{NATIVE_NAME}}::{{NATIVE_NAME}}(const {{NATIVE_NAME}} &o, "
+        "const allocator_type &_alloc)";
+    code_ += "      : {{INIT_LIST}} {";
+    code_ += "{{VEC_COPY}}}\n";
+    code_.SetValue("INIT_LIST", move_list);
+    code_ +=
+        "inline {{NATIVE_NAME}}::{{NATIVE_NAME}}({{NATIVE_NAME}} &&o, "
+        "const allocator_type &_alloc)";
+    code_ += "      : {{INIT_LIST}} {";
+    code_ += move_body + "}\n";
+  }
+
   void GenCompareOperator(const StructDef& struct_def,
                           const std::string& accessSuffix = "") {
     // Do not generate compare operators for native types.
@@ -2364,7 +2706,10 @@ class CppGenerator : public BaseGenerator {
     code_.SetValue("NATIVE_NAME", native_name);
 
     // Generate a C++ object that can hold an unpacked version of this table.
-    code_ += "struct {{NATIVE_NAME}} : public ::flatbuffers::NativeTable {";
+    code_.SetValue("NATIVE_BASE",
+                   opts_.cpp_pmr ? "PmrNativeTable" : "NativeTable");
+    code_ +=
+        "struct {{NATIVE_NAME}} : public ::flatbuffers::{{NATIVE_BASE}} {";
     code_ += "  typedef {{STRUCT_NAME}} TableType;";
     GenFullyQualifiedNameGetter(struct_def, native_name);
     for (const auto field : struct_def.fields.vec) {
@@ -2909,6 +3254,29 @@ class CppGenerator : public BaseGenerator {
     code_ += "\n  };";
   }
 
+  // Sample for Monster, of the vtable offsets of the fields in field_names:
+  //
+  //   static constexpr std::array<::flatbuffers::voffset_t, fields_number>
+  //       field_offsets = {
+  //     type::VT_POS,
+  //     type::VT_MANA,
+  //     ...
+  //   };
+  //
+  void GenFieldOffsets(const StructDef& struct_def) {
+    code_ += "  static constexpr std::array<\\";
+    code_ += "::flatbuffers::voffset_t, fields_number> field_offsets = {\\";
+    bool first = true;
+    for (const auto& field : struct_def.fields.vec) {
+      if (field->deprecated) continue;
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(*field));
+      code_ += first ? "" : ",";
+      code_ += "    type::{{OFFSET_NAME}}\\";
+      first = false;
+    }
+    code_ += first ? "};" : "\n  };";
+  }
+
   void GenFieldsNumber(const StructDef& struct_def) {
     const auto non_deprecated_field_count = std::count_if(
         struct_def.fields.vec.begin(), struct_def.fields.vec.end(),
@@ -2936,6 +3304,7 @@ class CppGenerator : public BaseGenerator {
           "\"{{FULLY_QUALIFIED_NAME}}\";";
       GenFieldsNumber(struct_def);
       GenFieldNames(struct_def);
+      if (!struct_def.fixed) GenFieldOffsets(struct_def);
       GenFieldTypeHelper(struct_def);
     }
     code_ += "};";
@@ -3166,6 +3535,10 @@ class CppGenerator : public BaseGenerator {
     if (opts_.generate_object_based_api) {
       // Generate the UnPack() pre declaration.
       code_ += "  " + TableUnPackSignature(struct_def, true, opts_) + ";";
+      if (HasPmrUnPack(struct_def)) {
+        code_ +=
+            "  " + TablePmrUnPackSignature(struct_def, true, opts_) + ";";
+      }
       code_ += "  " + TableUnPackToSignature(struct_def, true, opts_) + ";";
       code_ += "  " + TablePackSignature(struct_def, true, opts_) + ";";
     }
@@ -3231,6 +3604,9 @@ class CppGenerator : public BaseGenerator {
       // Generate a pre-declaration for a CreateX method that works with an
       // unpacked C++ object.
       code_ += TableCreateSignature(struct_def, true, opts_) + ";";
+      if (opts_.gen_packed_size && HasPackedSizeUpperBound(struct_def)) {
+        code_ += PackedSizeUpperBoundSignature(struct_def) + ";";
+      }
       code_ += "";
     }
   }
@@ -3257,6 +3633,135 @@ class CppGenerator : public BaseGenerator {
     return "";
   }
 
+  // The layout of a table built by Create...WithStaticVTable(), which stores
+  // all of its fields.
+  struct StaticVTableLayout {
+    std::vector<const FieldDef*> fields;  // In the order they are pushed.
+    size_t alignment;
+    std::vector<voffset_t> vtable;
+  };
+
+  // Computes the layout of a table that stores all of its fields, which is
+  // only known at compile time if none of them can be left out: optional
+  // scalars, unions (whose value is absent for NONE) and strings, vectors and
+  // tables that aren't required can't be used. Neither can 64-bit offsets,
+  // which have to be created in a particular order.
+  static bool GetStaticVTableLayout(const StructDef& struct_def,
+                                    StaticVTableLayout* layout) {
+    std::vector<std::pair<size_t, size_t>> sizes;  // Size and alignment.
+    layout->fields.clear();
+    for (auto it = struct_def.fields.vec.rbegin();
+         it != struct_def.fields.vec.rend(); ++it) {
+      const FieldDef& field = **it;
+      if (field.deprecated) continue;
+      const Type& type = field.value.type;
+      if (field.IsScalarOptional() || field.offset64 || IsUnion(type) ||
+          (IsVector(type) && IsUnion(type.VectorType()))) {
+        return false;
+      }
+      if (!IsScalar(type.base_type) && !IsStruct(type) &&
+          !field.IsRequired()) {
+        return false;
+      }
+      layout->fields.push_back(&field);
+    }
+    // Pushing the fields with the largest alignment first avoids padding.
+    const auto field_size = [](const FieldDef* field) {
+      const Type& type = field->value.type;
+      if (IsStruct(type)) {
+        return std::make_pair(type.struct_def->bytesize,
+                              type.struct_def->minalign);
+      }
+      const size_t size = IsScalar(type.base_type) ? SizeOf(type.base_type)
+                                                   : sizeof(uoffset_t);
+      return std::make_pair(size, size);
+    };
+    std::stable_sort(layout->fields.begin(), layout->fields.end(),
+                     [&](const FieldDef* a, const FieldDef* b) {
+                       return field_size(a).second > field_size(b).second;
+                     });
+
+    // Lay the fields out the way FlatBufferBuilder does, back to front from
+    // a start aligned to the largest alignment, followed by the soffset to
+    // the vtable.
+    layout->alignment = sizeof(soffset_t);
+    voffset_t vtable_size = FieldIndexToOffset(0);
+    for (const FieldDef* field : layout->fields) {
+      layout->alignment =
+          (std::max)(layout->alignment, field_size(field).second);
+      vtable_size = (std::max)(
+          vtable_size, static_cast<voffset_t>(field->value.offset +
+                                              sizeof(voffset_t)));
+    }
+    std::vector<size_t> field_ends;
+    size_t size = 0;
+    for (const FieldDef* field : layout->fields) {
+      const auto field_layout = field_size(field);
+      size += PaddingBytes(size, field_layout.second) + field_layout.first;
+      field_ends.push_back(size);
+    }
+    size += PaddingBytes(size, sizeof(soffset_t)) + sizeof(soffset_t);
+    if (size >= 0x10000) return false;
+
+    layout->vtable.assign(vtable_size / sizeof(voffset_t), 0);
+    layout->vtable[0] = vtable_size;
+    layout->vtable[1] = static_cast<voffset_t>(size);
+    for (size_t i = 0; i < layout->fields.size(); i++) {
+      layout->vtable[layout->fields[i]->value.offset / sizeof(voffset_t)] =
+          static_cast<voffset_t>(size - field_ends[i]);
+    }
+    return true;
+  }
+
+  // Generates a CreateX function that stores all the fields of a table, with
+  // a vtable computed here rather than while building.
+  void GenCreateWithStaticVTable(const StructDef& struct_def) {
+    StaticVTableLayout layout;
+    if (!GetStaticVTableLayout(struct_def, &layout)) return;
+
+    code_ +=
+        "inline ::flatbuffers::Offset<{{STRUCT_NAME}}> "
+        "Create{{STRUCT_NAME}}WithStaticVTable(";
+    code_ += "    " + GetBuilder() + " &_fbb\\";
+    for (const auto& field : struct_def.fields.vec) {
+      if (field->deprecated) continue;
+      const Type& type = field->value.type;
+      const std::string param_type =
+          IsStruct(type) ? "const " + WrapInNameSpace(*type.struct_def) + " &"
+                         : GenTypeWire(type, " ", true, false);
+      code_ += ",\n    " + param_type + Name(*field) + "\\";
+    }
+    code_ += ") {";
+
+    std::string vtable;
+    for (const voffset_t entry : layout.vtable) {
+      vtable += (vtable.empty() ? "" : ", ") + NumToString(entry);
+    }
+    code_ +=
+        "  static FLATBUFFERS_CONSTEXPR_CPP11 ::flatbuffers::voffset_t "
+        "vtable[] = {";
+    code_ += "      " + vtable + "};";
+    code_ += "  const auto start = _fbb.StartTableWithStaticVTable(" +
+             NumToString(layout.alignment) + ");";
+    for (const FieldDef* field : layout.fields) {
+      const Type& type = field->value.type;
+      if (IsStruct(type)) {
+        code_ += "  _fbb.PushStruct(" + Name(*field) + ");";
+      } else if (IsScalar(type.base_type)) {
+        code_ += "  _fbb.PushElement<" + GenTypeWire(type, "", false, false) +
+                 ">(" + GenUnderlyingCast(*field, false, Name(*field)) + ");";
+      } else {
+        // Required, so it can't be null.
+        code_ += "  FLATBUFFERS_ASSERT(!" + Name(*field) + ".IsNull());";
+        code_ += "  _fbb.PushElement(" + Name(*field) + ");";
+      }
+    }
+    code_ += "  return ::flatbuffers::Offset<{{STRUCT_NAME}}>(";
+    code_ += "      _fbb.EndTableWithStaticVTable(start, vtable));";
+    code_ += "}";
+    code_ += "";
+  }
+
   void GenBuilders(const StructDef& struct_def) {
     code_.SetValue("STRUCT_NAME", Name(struct_def));
 
@@ -3374,6 +3879,8 @@ class CppGenerator : public BaseGenerator {
     code_ += "}";
     code_ += "";
 
+    if (opts_.cpp_static_vtables) GenCreateWithStaticVTable(struct_def);
+
     // Definition for type traits for this table type. This allows querying var-
     // ious compile-time traits of the table.
     if (opts_.g_cpp_std >= cpp::CPP_STD_17) {
@@ -3512,7 +4019,10 @@ class CppGenerator : public BaseGenerator {
                            bool invector, const FieldDef& afield) {
     switch (type.base_type) {
       case BASE_TYPE_STRING: {
-        if (FlexibleStringConstructor(&afield)) {
+        if (opts_.cpp_pmr && NativeString(&afield) == "std::pmr::string") {
+          // Assigned into a string that already uses the table's allocator.
+          return "std::string_view(" + val + "->c_str(), " + val + "->size())";
+        } else if (FlexibleStringConstructor(&afield)) {
           return NativeString(&afield) + "(" + val + "->c_str(), " + val +
                  "->size())";
         } else {
@@ -3539,11 +4049,18 @@ class CppGenerator : public BaseGenerator {
             }
           } else if (invector || afield.native_inline) {
             return "*" + val;
+          } else if (IsPmrPtr(afield)) {
+            return "::flatbuffers::pmr_make_unique<" +
+                   WrapInNameSpace(*type.struct_def) +
+                   ">(_o->get_allocator().resource(), *" + val + ")";
           } else {
             const auto name = WrapInNameSpace(*type.struct_def);
             const auto ptype = GenTypeNativePtr(name, &afield, true);
             return ptype + "(new " + name + "(*" + val + "))";
           }
+        } else if (!afield.native_inline && IsPmrPtr(afield) &&
+                   HasPmrUnPack(*type.struct_def)) {
+          return val + "->UnPack(_o->get_allocator().resource(), _resolver)";
         } else {
           std::string ptype = afield.native_inline ? "*" : "";
           ptype += GenTypeNativePtr(
@@ -3565,6 +4082,18 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // Whether the elements of a vector field can be memcpy'd into the native
+  // std::vector, which holds them with the same representation.
+  static bool IsBulkCopyableVector(const FieldDef& field) {
+    const auto type = field.value.type.VectorType();
+    if (field.attributes.Lookup("cpp_type")) return false;
+    if (IsStruct(type)) {
+      return !type.struct_def->attributes.Lookup("native_type");
+    }
+    return IsScalar(type.base_type) && !IsBool(type.base_type) &&
+           type.base_type != BASE_TYPE_UTYPE;
+  }
+
   std::string GenUnpackFieldStatement(const FieldDef& field,
                                       const FieldDef* union_field) {
     std::string code;
@@ -3586,6 +4115,11 @@ class CppGenerator : public BaseGenerator {
           //  - multiple-byte types due to endianness.
           code +=
               "std::copy(_e->begin(), _e->end(), _o->" + name + ".begin()); }";
+        } else if (IsBulkCopyableVector(field)) {
+          // Scalars, enums and structs that are stored in the native vector
+          // just as they are on the wire are copied all at once.
+          code += "::flatbuffers::CopyVectorTo(*_e, " + vector_field +
+                  ".data()); } else { " + vector_field + ".resize(0); }";
         } else {
           std::string indexing;
           if (field.value.type.enum_def) {
@@ -3637,6 +4171,11 @@ class CppGenerator : public BaseGenerator {
               // GenTypeNativePtr(cpp_type->constant, &field, true) + "();";
               code += "/* else do nothing */";
             }
+          } else if (opts_.cpp_pmr && field.native_inline &&
+                     IsTable(field.value.type.VectorType())) {
+            // Unpacked in place, so the table's members come from the
+            // vector's memory_resource too.
+            code += indexing + "->UnPackTo(&_o->" + name + "[_i], _resolver); ";
           } else {
             const bool is_pointer = IsVectorOfPointers(field);
             if (is_pointer) {
@@ -3980,6 +4519,7 @@ class CppGenerator : public BaseGenerator {
       // Generate the >= C++11 copy ctor and assignment operator definitions.
       if (!native_type) {
         GenCopyCtorAssignOpDefs(struct_def);
+        if (opts_.cpp_pmr) GenPmrAllocatorCtorDefs(struct_def);
       }
 
       // Generate the X::UnPack() method.
@@ -4002,6 +4542,18 @@ class CppGenerator : public BaseGenerator {
       code_ += "  UnPackTo(_o.get(), _resolver);";
       code_ += "  return _o.release();";
       code_ += "}";
+
+      if (HasPmrUnPack(struct_def)) {
+        code_ += "";
+        code_ += "inline " + TablePmrUnPackSignature(struct_def, false, opts_) +
+                 " {";
+        code_ +=
+            "  auto _o = "
+            "::flatbuffers::pmr_make_unique<{{NATIVE_NAME}}>(_resource);";
+        code_ += "  UnPackTo(_o.get(), _resolver);";
+        code_ += "  return _o;";
+        code_ += "}";
+      }
       code_ += "";
 
       // Generate an Unpack method for the C++ object if that table does not
@@ -4062,6 +4614,13 @@ class CppGenerator : public BaseGenerator {
             "* __o; "
             "const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { "
             "&_fbb, _o, _rehasher}; (void)_va;";
+        if (opts_.gen_packed_size && HasPackedSizeUpperBound(struct_def)) {
+          // Only the outermost Pack() on a builder that hasn't allocated yet
+          // does this, nested ones find the space already there.
+          code_ += "  if (_fbb.GetBufferCapacity() == 0) {";
+          code_ += "    _fbb.Reserve(PackedSizeUpperBound(*_o));";
+          code_ += "  }";
+        }
 
         for (auto it = struct_def.fields.vec.begin();
              it != struct_def.fields.vec.end(); ++it) {
@@ -4122,8 +4681,140 @@ class CppGenerator : public BaseGenerator {
         code_ += ");";
         code_ += "}";
         code_ += "";
+
+        if (opts_.gen_packed_size && HasPackedSizeUpperBound(struct_def)) {
+          GenPackedSizeUpperBound(struct_def);
+        }
+      }
+    }
+  }
+
+  // Generate a function that returns an upper bound of the number of bytes
+  // Pack() serializes for a native table object, so the builder can be
+  // allocated once up front.
+  void GenPackedSizeUpperBound(const StructDef& struct_def) {
+    // The inline part of the table is known now, the rest depends on the
+    // contents of the object.
+    size_t num_fields = 0;
+    size_t fields_size = 0;
+    std::vector<std::string> terms;
+    for (const auto& field : struct_def.fields.vec) {
+      if (field->deprecated) {
+        continue;
+      }
+      const auto& type = field->value.type;
+      const bool offset64 = field->offset64 && !IsScalar(type.base_type);
+      const size_t size = offset64 ? sizeof(uoffset64_t) : InlineSize(type);
+      const size_t align =
+          offset64 ? sizeof(uoffset64_t) : InlineAlignment(type);
+      num_fields++;
+      fields_size += size + align - 1;
+
+      const std::string value = "_o." + Name(*field);
+      switch (type.base_type) {
+        case BASE_TYPE_STRING:
+          terms.push_back(
+              "_size += ::flatbuffers::PackedStringSizeUpperBound(" + value +
+              ".length());");
+          break;
+        case BASE_TYPE_VECTOR:
+        case BASE_TYPE_VECTOR64: {
+          const auto elem_type = type.VectorType();
+          size_t elem_size = InlineSize(elem_type);
+          size_t elem_align = InlineAlignment(elem_type);
+          const auto* force_align = field->attributes.Lookup("force_align");
+          if (force_align) {
+            const auto forced =
+                static_cast<size_t>(atoi(force_align->constant.c_str()));
+            elem_align = (std::max)(elem_align, forced);
+          }
+          // Strings are first collected on the builder's scratch space.
+          if (IsString(elem_type)) elem_size += sizeof(uoffset_t);
+          const std::string vec = elem_type.base_type == BASE_TYPE_UTYPE
+                                      ? "_o." + StripUnionType(Name(*field))
+                                      : value;
+          terms.push_back(
+              "_size += ::flatbuffers::PackedVectorSizeUpperBound(" + vec +
+              ".size(), " + NumToString(elem_size) + ", " +
+              NumToString(elem_align) + ");");
+          if (IsString(elem_type)) {
+            terms.push_back(
+                "for (const auto &_e : " + value +
+                ") _size += ::flatbuffers::PackedStringSizeUpperBound("
+                "_e.length());");
+          } else if (elem_type.base_type == BASE_TYPE_UNION) {
+            terms.push_back("for (const auto &_e : " + value +
+                            ") _size += _e.PackedSizeUpperBound();");
+          } else if (IsTable(elem_type)) {
+            terms.push_back("for (const auto &_e : " + value + ") _size += " +
+                            PackedSizeUpperBoundName(*elem_type.struct_def) +
+                            (field->native_inline ? "(_e);" : "(*_e);"));
+          }
+          break;
+        }
+        case BASE_TYPE_UNION:
+          terms.push_back("_size += " + value + ".PackedSizeUpperBound();");
+          break;
+        case BASE_TYPE_STRUCT:
+          if (IsTable(type)) {
+            const auto name = PackedSizeUpperBoundName(*type.struct_def);
+            if (field->native_inline) {
+              terms.push_back("_size += " + name + "(" + value + ");");
+            } else {
+              terms.push_back("if (" + value + ") _size += " + name + "(*" +
+                              value + ");");
+            }
+          }
+          break;
+        default: break;
+      }
+    }
+
+    code_ += "inline " + PackedSizeUpperBoundSignature(struct_def) + " {";
+    if (terms.empty()) code_ += "  (void)_o;";
+    code_ += "  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(" +
+             NumToString(num_fields) + ", " + NumToString(fields_size) + ");";
+    for (const auto& term : terms) {
+      code_ += "  " + term;
+    }
+    code_ += "  return _size;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  void GenUnionPackedSizeUpperBound(const EnumDef& enum_def) {
+    code_ += "inline size_t {{ENUM_NAME}}Union::PackedSizeUpperBound() const {";
+    code_ += "  switch (type) {";
+    for (const auto& ev : enum_def.Vals()) {
+      if (ev->IsZero()) {
+        continue;
+      }
+      const auto& type = ev->union_type;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, *ev));
+      code_.SetValue("TYPE", GetUnionElement(*ev, true, opts_));
+      if (IsStruct(type)) {
+        code_.SetValue("SIZE", NumToString(type.struct_def->bytesize +
+                                           type.struct_def->minalign - 1));
+        code_ += "    case {{LABEL}}: return {{SIZE}};";
+      } else if (IsString(type)) {
+        code_ += "    case {{LABEL}}: {";
+        code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(value);";
+        code_ +=
+            "      return ::flatbuffers::PackedStringSizeUpperBound("
+            "ptr->length());";
+        code_ += "    }";
+      } else {
+        code_.SetValue("FUNC", PackedSizeUpperBoundName(*type.struct_def));
+        code_ += "    case {{LABEL}}: {";
+        code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(value);";
+        code_ += "      return {{FUNC}}(*ptr);";
+        code_ += "    }";
       }
     }
+    code_ += "    default: return 0;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
   }
 
   static void GenPadding(
@@ -4536,6 +5227,22 @@ static bool GenerateCPP(const Parser& parser, const std::string& path,
     return false;
   }
 
+  if (opts.cpp_pmr) {
+    if (opts.g_cpp_std < cpp::CPP_STD_17) {
+      LogCompilerError(
+          "--cpp-pmr requires using --cpp-std at \"C++17\" or higher.");
+      return false;
+    }
+    // Unless asked for something else, own sub-objects with a pointer that
+    // can free them from a memory_resource, and use allocator aware strings.
+    if (opts.cpp_object_api_pointer_type == "std::unique_ptr") {
+      opts.cpp_object_api_pointer_type = "::flatbuffers::pmr_unique_ptr";
+    }
+    if (opts.cpp_object_api_string_type.empty()) {
+      opts.cpp_object_api_string_type = "std::pmr::string";
+    }
+  }
+
   cpp::CppGenerator generator(parser, path, file_name, opts);
   return generator.generate();
 }
@@ -0,0 +1,306 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "idl_gen_layout.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/code_generators.h"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/util.h"
+
+namespace flatbuffers {
+
+namespace layout {
+
+namespace {
+
+static std::string Bytes(size_t n) {
+  return NumToString(n) + (n == 1 ? " byte" : " bytes");
+}
+
+static std::string Bytes(size_t min, size_t max) {
+  return min == max ? Bytes(max) : NumToString(min) + " to " + Bytes(max);
+}
+
+// The size and alignment a field takes up inline in its table or struct.
+struct FieldLayout {
+  size_t size;
+  size_t alignment;
+};
+
+static FieldLayout GetFieldLayout(const FieldDef& field) {
+  const Type& type = field.value.type;
+  FieldLayout layout;
+  if (IsStruct(type) || IsArray(type) || IsScalar(type.base_type)) {
+    layout.size = InlineSize(type);
+    layout.alignment = InlineAlignment(type);
+  } else {
+    // Strings, vectors, tables and unions are stored as an offset.
+    layout.size = field.offset64 ? sizeof(uoffset64_t) : sizeof(uoffset_t);
+    layout.alignment = layout.size;
+  }
+  return layout;
+}
+
+// Returns the bytes of padding needed to lay out `fields` in order, starting
+// from an offset aligned to `alignment` and padding the end to it again.
+// A FlatBufferBuilder lays out the inline fields of a table the same way, back
+// to front, followed by the soffset to its vtable.
+static size_t Padding(const std::vector<FieldLayout>& fields,
+                      size_t alignment) {
+  size_t size = 0;
+  size_t padding = 0;
+  for (const FieldLayout& layout : fields) {
+    const size_t pad = PaddingBytes(size, layout.alignment);
+    padding += pad;
+    size += pad + layout.size;
+  }
+  return padding + PaddingBytes(size, alignment);
+}
+
+static void SortByAlignment(std::vector<FieldLayout>& fields) {
+  std::stable_sort(fields.begin(), fields.end(),
+                   [](const FieldLayout& a, const FieldLayout& b) {
+                     return a.alignment > b.alignment;
+                   });
+}
+
+// Generates a textual report on the padding and vtable costs of the structs
+// and tables of a schema.
+class LayoutReportGenerator : public BaseGenerator {
+ public:
+  LayoutReportGenerator(const Parser& parser, const std::string& path,
+                        const std::string& file_name)
+      : BaseGenerator(parser, path, file_name, "", "", "") {}
+
+  bool generate() override {
+    code_ = "// " + std::string(FlatBuffersGeneratedWarning()) + "\n";
+    code_ += "// Layout report for " + file_name_ + ".fbs\n";
+    for (const StructDef* struct_def : parser_.structs_.vec) {
+      if (struct_def->generated && !parser_.opts.generate_all) continue;
+      code_ += "\n";
+      if (struct_def->fixed) {
+        GenStruct(*struct_def);
+      } else {
+        GenTable(*struct_def);
+      }
+    }
+    const std::string file_path = GeneratedFileName(path_, file_name_);
+    return parser_.opts.file_saver->SaveFile(file_path.c_str(), code_, false);
+  }
+
+  static std::string GeneratedFileName(const std::string& path,
+                                       const std::string& file_name) {
+    return path + file_name + ".layout.txt";
+  }
+
+ private:
+  std::string code_;
+
+  std::string FullName(const StructDef& struct_def) const {
+    return struct_def.defined_namespace->GetFullyQualifiedName(
+        struct_def.name);
+  }
+
+  void GenStruct(const StructDef& struct_def) {
+    code_ += "struct " + FullName(struct_def) + "\n";
+    code_ += "  size: " + Bytes(struct_def.bytesize) +
+             ", alignment: " + NumToString(struct_def.minalign) + "\n";
+
+    size_t padding = 0;
+    std::vector<FieldLayout> fields;
+    for (const FieldDef* field : struct_def.fields.vec) {
+      padding += field->padding;
+      fields.push_back(GetFieldLayout(*field));
+    }
+    if (!padding) return;
+
+    code_ += "  padding: " + Bytes(padding) + " (" +
+             NumToString(padding * 100 / struct_def.bytesize) + "%)\n";
+    for (const FieldDef* field : struct_def.fields.vec) {
+      if (!field->padding) continue;
+      code_ += "    " + Bytes(field->padding) + " after `" + field->name +
+               "`\n";
+    }
+
+    // A struct is laid out exactly as declared, and its layout is part of the
+    // wire format. So a better order only helps new struct types.
+    SortByAlignment(fields);
+    const size_t sorted_padding = Padding(fields, struct_def.minalign);
+    if (sorted_padding < padding) {
+      code_ += "  note: ordering the fields by decreasing alignment would "
+               "make it " +
+               Bytes(struct_def.bytesize - padding + sorted_padding) +
+               ", but that changes the wire format.\n";
+    }
+  }
+
+  void GenTable(const StructDef& struct_def) {
+    code_ += "table " + FullName(struct_def) + "\n";
+
+    // Every field, deprecated or not, has a slot in the vtable. A vtable only
+    // has the slots up to the last field that is present though.
+    const size_t slots = struct_def.fields.vec.size();
+    size_t fields_size = 0;
+    std::vector<std::string> deprecated;
+    size_t trailing_deprecated = 0;
+    for (const FieldDef* field : struct_def.fields.vec) {
+      if (field->deprecated) {
+        deprecated.push_back("`" + field->name + "`");
+        trailing_deprecated++;
+      } else {
+        trailing_deprecated = 0;
+        fields_size += GetFieldLayout(*field).size;
+      }
+    }
+    const std::vector<std::string> costly_deprecated(
+        deprecated.begin(), deprecated.end() - trailing_deprecated);
+
+    code_ += "  fields: " + NumToString(slots);
+    if (!deprecated.empty()) {
+      code_ += " (" + NumToString(deprecated.size()) + " deprecated)";
+    }
+    code_ += "\n";
+    code_ += "  vtable: " +
+             Bytes(2 * sizeof(voffset_t), (2 + slots) * sizeof(voffset_t)) +
+             "\n";
+
+    // This is the order the generated Create functions add the fields in.
+    std::vector<FieldLayout> fields;
+    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
+         size; size /= 2) {
+      for (auto it = struct_def.fields.vec.rbegin();
+           it != struct_def.fields.vec.rend(); ++it) {
+        const FieldDef& field = **it;
+        if (!field.deprecated &&
+            (!struct_def.sortbysize ||
+             size == SizeOf(field.value.type.base_type))) {
+          fields.push_back(GetFieldLayout(field));
+        }
+      }
+    }
+    const size_t padding = Padding(fields, sizeof(soffset_t));
+    const size_t inline_size = sizeof(soffset_t) + fields_size + padding;
+    code_ += "  inline size: " + Bytes(sizeof(soffset_t), inline_size);
+    if (padding) {
+      code_ += ", " + Bytes(padding) + " of padding when all fields are set";
+    }
+    code_ += "\n";
+
+    if (!costly_deprecated.empty()) {
+      code_ += "  deprecated fields still take up 2 bytes in every vtable "
+               "that has a later field: " +
+               JoinNames(costly_deprecated) + "\n";
+    }
+
+    // Unlike a struct, the order of the inline fields of a table isn't part
+    // of the wire format, only the ids are.
+    SortByAlignment(fields);
+    const size_t sorted_padding = Padding(fields, sizeof(soffset_t));
+    if (sorted_padding < padding) {
+      code_ += "  note: ";
+      code_ += struct_def.sortbysize ? "adding the fields to the builder by "
+                                       "decreasing alignment"
+                                     : "removing (original_order)";
+      code_ += " would save up to " + Bytes(padding - sorted_padding) +
+               " of padding per table, without changing the wire format.\n";
+    }
+  }
+
+  static std::string JoinNames(const std::vector<std::string>& names) {
+    std::string joined;
+    for (const std::string& name : names) {
+      if (!joined.empty()) joined += ", ";
+      joined += name;
+    }
+    return joined;
+  }
+};
+
+}  // namespace
+
+}  // namespace layout
+
+static bool GenerateLayoutReport(const Parser& parser, const std::string& path,
+                                 const std::string& file_name) {
+  layout::LayoutReportGenerator generator(parser, path, file_name);
+  return generator.generate();
+}
+
+namespace {
+
+class LayoutReportCodeGenerator : public CodeGenerator {
+ public:
+  Status GenerateCode(const Parser& parser, const std::string& path,
+                      const std::string& filename) override {
+    if (!GenerateLayoutReport(parser, path, filename)) {
+      return Status::ERROR;
+    }
+    return Status::OK;
+  }
+
+  Status GenerateCode(const uint8_t*, int64_t, const CodeGenOptions&) override {
+    return Status::NOT_IMPLEMENTED;
+  }
+
+  Status GenerateMakeRule(const Parser& parser, const std::string& path,
+                          const std::string& filename,
+                          std::string& output) override {
+    (void)parser;
+    (void)path;
+    (void)filename;
+    (void)output;
+    return Status::NOT_IMPLEMENTED;
+  }
+
+  Status GenerateGrpcCode(const Parser& parser, const std::string& path,
+                          const std::string& filename) override {
+    (void)parser;
+    (void)path;
+    (void)filename;
+    return Status::NOT_IMPLEMENTED;
+  }
+
+  Status GenerateRootFile(const Parser& parser,
+                          const std::string& path) override {
+    (void)parser;
+    (void)path;
+    return Status::NOT_IMPLEMENTED;
+  }
+
+  bool IsSchemaOnly() const override { return true; }
+
+  bool SupportsBfbsGeneration() const override { return false; }
+
+  bool SupportsRootFileGeneration() const override { return false; }
+
+  IDLOptions::Language Language() const override {
+    return IDLOptions::kLayoutReport;
+  }
+
+  std::string LanguageName() const override { return "LayoutReport"; }
+};
+}  // namespace
+
+std::unique_ptr<CodeGenerator> NewLayoutReportCodeGenerator() {
+  return std::unique_ptr<LayoutReportCodeGenerator>(
+      new LayoutReportCodeGenerator());
+}
+
+}  // namespace flatbuffers
@@ -18,6 +18,9 @@
 #include "idl_gen_text.h"
 
 #include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "flatbuffers/base.h"
 #include "flatbuffers/code_generator.h"
@@ -50,11 +53,28 @@ struct JsonPrinter {
 
   int Indent() const { return std::max(opts.indent_step, 0); }
 
-  // Output an identifier with or without quotes depending on strictness.
-  void OutputIdentifier(const std::string& name) {
-    if (opts.strict_json) text += '\"';
-    text += name;
-    if (opts.strict_json) text += '\"';
+  // The name of field `index` of `struct_def`, as output before its value:
+  // with or without quotes depending on strictness, and followed by the ':'
+  // and ' '. Computed once per field by a printer, when first output.
+  const std::string& FieldKey(const StructDef& struct_def, size_t index) {
+    if (&struct_def != last_struct_def) {
+      last_struct_def = &struct_def;
+      last_field_keys = &field_keys[&struct_def];
+      last_field_keys->resize(struct_def.fields.vec.size());
+    }
+    std::string& key = (*last_field_keys)[index];
+    if (key.empty()) {
+      const FieldDef& fd = *struct_def.fields.vec[index];
+      if (opts.strict_json) key += '\"';
+      key += fd.name;
+      if (opts.strict_json) key += '\"';
+      if (!opts.protobuf_ascii_alike ||
+          (fd.value.type.base_type != BASE_TYPE_STRUCT &&
+           fd.value.type.base_type != BASE_TYPE_VECTOR))
+        key += ':';
+      key += ' ';
+    }
+    return key;
   }
 
   // Print (and its template specialization below for pointers) generate text
@@ -330,12 +350,8 @@ struct JsonPrinter {
         }
         AddNewLine();
         AddIndent(elem_indent);
-        OutputIdentifier(fd.name);
-        if (!opts.protobuf_ascii_alike ||
-            (fd.value.type.base_type != BASE_TYPE_STRUCT &&
-             fd.value.type.base_type != BASE_TYPE_VECTOR))
-          text += ':';
-        text += ' ';
+        const auto index = it - struct_def.fields.vec.begin();
+        text += FieldKey(struct_def, static_cast<size_t>(index));
         // clang-format off
         switch (fd.value.type.base_type) {
         #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, ...) \
@@ -372,12 +388,19 @@ struct JsonPrinter {
   }
 
   JsonPrinter(const Parser& parser, std::string& dest)
-      : opts(parser.opts), text(dest) {
+      : opts(parser.opts),
+        text(dest),
+        last_struct_def(nullptr),
+        last_field_keys(nullptr) {
     text.reserve(1024);  // Reduce amount of inevitable reallocs.
   }
 
   const IDLOptions& opts;
   std::string& text;
+  std::map<const StructDef*, std::vector<std::string>> field_keys;
+  // Those of the struct printed last, which is usually the next one too.
+  const StructDef* last_struct_def;
+  std::vector<std::string>* last_field_keys;
 };
 
 static const char* GenerateTextImpl(const Parser& parser, const Table* table,
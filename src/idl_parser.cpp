@@ -2797,7 +2797,7 @@ bool Parser::SupportsOptionalScalars(const flatbuffers::IDLOptions& opts) {
       IDLOptions::kKotlin | IDLOptions::kKotlinKmp | IDLOptions::kCpp |
       IDLOptions::kJava | IDLOptions::kCSharp | IDLOptions::kTs |
       IDLOptions::kBinary | IDLOptions::kGo | IDLOptions::kPython |
-      IDLOptions::kJson | IDLOptions::kNim;
+      IDLOptions::kJson | IDLOptions::kNim | IDLOptions::kLayoutReport;
   unsigned long langs = opts.lang_to_generate;
   return (langs > 0 && langs < IDLOptions::kMAX) && !(langs & ~supported_langs);
 }
@@ -2810,7 +2810,7 @@ bool Parser::SupportsDefaultVectorsAndStrings() const {
   static FLATBUFFERS_CONSTEXPR unsigned long supported_langs =
       IDLOptions::kRust | IDLOptions::kSwift | IDLOptions::kNim |
       IDLOptions::kCpp | IDLOptions::kBinary | IDLOptions::kJson |
-      IDLOptions::kTs;
+      IDLOptions::kTs | IDLOptions::kLayoutReport;
   return !(opts.lang_to_generate & ~supported_langs);
 }
 
@@ -2819,7 +2819,8 @@ bool Parser::SupportsAdvancedUnionFeatures() const {
           ~(IDLOptions::kCpp | IDLOptions::kTs | IDLOptions::kPhp |
             IDLOptions::kJava | IDLOptions::kCSharp | IDLOptions::kKotlin |
             IDLOptions::kBinary | IDLOptions::kSwift | IDLOptions::kNim |
-            IDLOptions::kJson | IDLOptions::kKotlinKmp)) == 0;
+            IDLOptions::kJson | IDLOptions::kKotlinKmp |
+            IDLOptions::kLayoutReport)) == 0;
 }
 
 bool Parser::SupportsAdvancedArrayFeatures() const {
@@ -2827,17 +2828,19 @@ bool Parser::SupportsAdvancedArrayFeatures() const {
           ~(IDLOptions::kCpp | IDLOptions::kPython | IDLOptions::kJava |
             IDLOptions::kCSharp | IDLOptions::kJsonSchema | IDLOptions::kJson |
             IDLOptions::kBinary | IDLOptions::kRust | IDLOptions::kTs |
-            IDLOptions::kSwift)) == 0;
+            IDLOptions::kSwift | IDLOptions::kLayoutReport)) == 0;
 }
 
 bool Parser::Supports64BitOffsets() const {
   return (opts.lang_to_generate &
-          ~(IDLOptions::kCpp | IDLOptions::kJson | IDLOptions::kBinary)) == 0;
+          ~(IDLOptions::kCpp | IDLOptions::kJson | IDLOptions::kBinary |
+            IDLOptions::kLayoutReport)) == 0;
 }
 
 bool Parser::SupportsUnionUnderlyingType() const {
   return (opts.lang_to_generate &
-          ~(IDLOptions::kCpp | IDLOptions::kTs | IDLOptions::kBinary)) == 0;
+          ~(IDLOptions::kCpp | IDLOptions::kTs | IDLOptions::kBinary |
+            IDLOptions::kLayoutReport)) == 0;
 }
 
 Namespace* Parser::UniqueNamespace(Namespace* ns) {
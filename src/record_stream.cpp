@@ -0,0 +1,384 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// clang-format off
+// Dont't remove `format off`, it prevent reordering of win-includes.
+
+#if defined(_WIN32) || defined(__MINGW32__) || defined(__MINGW64__) || defined(__CYGWIN__)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#  define FLATBUFFERS_RECORD_STREAM_WIN32_MMAP
+#elif defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define FLATBUFFERS_RECORD_STREAM_POSIX_MMAP
+#endif
+// clang-format on
+
+#include "flatbuffers/record_stream.h"
+
+#include <cstring>
+
+#include "flatbuffers/util.h"
+
+namespace flatbuffers {
+
+namespace {
+
+static const char kStreamMagic[] = "FBRS";
+static const char kIndexMagic[] = "FBRI";
+static const uint32_t kStreamVersion = 1;
+static const size_t kHeaderSize = 16;
+// Record count, index offset, index interval and magic.
+static const size_t kTrailerSize = 24;
+// The index interval used for streams scanned for their records.
+static const size_t kScanIndexInterval = 64;
+
+template <typename T>
+T ReadUnaligned(const uint8_t* p) {
+  T value;
+  memcpy(&value, p, sizeof(T));
+  return EndianScalar(value);
+}
+
+size_t AlignUp(size_t position, size_t alignment) {
+  return (position + alignment - 1) & ~(alignment - 1);
+}
+
+bool IsValidAlignment(uint64_t alignment) {
+  return alignment >= sizeof(uint32_t) && alignment <= (1 << 16) &&
+         !(alignment & (alignment - 1));
+}
+
+}  // namespace
+
+uint32_t Crc32c(const uint8_t* data, size_t size) {
+  struct Table {
+    uint32_t entries[256];
+    Table() {
+      for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+          crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+        }
+        entries[i] = crc;
+      }
+    }
+  };
+  static const Table table;
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < size; i++) {
+    crc = (crc >> 8) ^ table.entries[(crc ^ data[i]) & 0xFF];
+  }
+  return ~crc;
+}
+
+RecordStreamWriter::RecordStreamWriter(const RecordStreamOptions& options)
+    : options_(options),
+      file_(nullptr),
+      ok_(false),
+      written_(0),
+      num_records_(0) {
+  FLATBUFFERS_ASSERT(IsValidAlignment(options_.alignment));
+  FLATBUFFERS_ASSERT(options_.index_interval > 0);
+}
+
+bool RecordStreamWriter::Open(const std::string& filename) {
+  Close();
+  file_ = fopen(filename.c_str(), "wb");
+  ok_ = file_ != nullptr;
+  pending_.clear();
+  written_ = 0;
+  num_records_ = 0;
+  index_.clear();
+  pending_.insert(pending_.end(), kStreamMagic, kStreamMagic + 4);
+  Write<uint32_t>(kStreamVersion);
+  Write<uint32_t>(options_.checksums ? kRecordStreamChecksums : 0);
+  Write<uint32_t>(static_cast<uint32_t>(options_.alignment));
+  return ok_;
+}
+
+void RecordStreamWriter::Pad(size_t alignment) {
+  const size_t padding =
+      PaddingBytes(static_cast<size_t>(position() % alignment), alignment);
+  pending_.insert(pending_.end(), padding, 0);
+}
+
+bool RecordStreamWriter::Append(const uint8_t* buffer) {
+  if (!ok_) return false;
+  const size_t size = GetPrefixedSize(buffer) + sizeof(uoffset_t);
+  Pad(options_.alignment);
+  if (num_records_ % options_.index_interval == 0) index_.push_back(position());
+  pending_.insert(pending_.end(), buffer, buffer + size);
+  if (options_.checksums) {
+    const uint32_t crc = Crc32c(buffer, size);
+    Pad(sizeof(uint32_t));
+    Write<uint32_t>(crc);
+  }
+  num_records_++;
+  return pending_.size() < options_.batch_size || Flush();
+}
+
+bool RecordStreamWriter::Flush() {
+  if (!ok_) return false;
+  if (!pending_.empty()) {
+    ok_ = fwrite(pending_.data(), 1, pending_.size(), file_) == pending_.size();
+    written_ += pending_.size();
+    pending_.clear();
+  }
+  return ok_;
+}
+
+bool RecordStreamWriter::Close() {
+  if (!file_) return ok_;
+  if (ok_) {
+    Pad(sizeof(uint64_t));
+    const uint64_t index_offset = position();
+    for (size_t i = 0; i < index_.size(); i++) Write<uint64_t>(index_[i]);
+    Write<uint64_t>(num_records_);
+    Write<uint64_t>(index_offset);
+    Write<uint32_t>(options_.index_interval);
+    pending_.insert(pending_.end(), kIndexMagic, kIndexMagic + 4);
+    Flush();
+  }
+  if (fclose(file_)) ok_ = false;
+  file_ = nullptr;
+  return ok_;
+}
+
+RecordStreamReader::RecordStreamReader()
+    : data_(nullptr),
+      size_(0),
+      mapping_(nullptr),
+      flags_(0),
+      alignment_(1),
+      has_index_(false),
+      records_begin_(0),
+      records_end_(0),
+      num_records_(0),
+      index_interval_(kScanIndexInterval) {}
+
+bool RecordStreamReader::Open(const std::string& filename) {
+  Close();
+  // clang-format off
+  #if defined(FLATBUFFERS_RECORD_STREAM_POSIX_MMAP)
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat file_info;
+    if (fstat(fd, &file_info) != 0) {
+      close(fd);
+      return false;
+    }
+    const size_t size = static_cast<size_t>(file_info.st_size);
+    void* mapping = nullptr;
+    if (size) {
+      mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      if (mapping == MAP_FAILED) mapping = nullptr;
+    }
+    close(fd);
+    if (size && !mapping) return false;
+    mapping_ = mapping;
+    return Parse(static_cast<const uint8_t*>(mapping), size);
+  #elif defined(FLATBUFFERS_RECORD_STREAM_WIN32_MMAP)
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+      CloseHandle(file);
+      return false;
+    }
+    const size_t size = static_cast<size_t>(file_size.QuadPart);
+    void* mapping = nullptr;
+    if (size) {
+      HANDLE file_mapping =
+          CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (file_mapping) {
+        // The view keeps the mapping alive.
+        mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(file_mapping);
+      }
+    }
+    CloseHandle(file);
+    if (size && !mapping) return false;
+    mapping_ = mapping;
+    return Parse(static_cast<const uint8_t*>(mapping), size);
+  #else
+    if (!LoadFile(filename.c_str(), true, &contents_)) return false;
+    return Parse(reinterpret_cast<const uint8_t*>(contents_.data()),
+                 contents_.size());
+  #endif
+  // clang-format on
+}
+
+bool RecordStreamReader::Open(const uint8_t* data, size_t size) {
+  Close();
+  return Parse(data, size);
+}
+
+bool RecordStreamReader::Parse(const uint8_t* data, size_t size) {
+  data_ = data;
+  size_ = size;
+  flags_ = 0;
+  alignment_ = 1;
+  has_index_ = false;
+  records_begin_ = 0;
+  records_end_ = size;
+  num_records_ = 0;
+  index_interval_ = kScanIndexInterval;
+  index_.clear();
+  if (size >= kHeaderSize && !memcmp(data, kStreamMagic, 4)) {
+    const uint64_t alignment = ReadUnaligned<uint32_t>(data + 12);
+    if (ReadUnaligned<uint32_t>(data + 4) != kStreamVersion ||
+        !IsValidAlignment(alignment)) {
+      Close();
+      return false;
+    }
+    flags_ = ReadUnaligned<uint32_t>(data + 8);
+    alignment_ = static_cast<size_t>(alignment);
+    records_begin_ = AlignUp(kHeaderSize, alignment_);
+    if (records_begin_ > size) records_begin_ = size;
+    if (ReadIndex()) return true;
+  }
+  // Files without a (valid) index are scanned for their records instead.
+  ScanRecords();
+  return true;
+}
+
+bool RecordStreamReader::ReadIndex() {
+  if (size_ < records_begin_ + kTrailerSize ||
+      memcmp(data_ + size_ - 4, kIndexMagic, 4)) {
+    return false;
+  }
+  const uint8_t* trailer = data_ + size_ - kTrailerSize;
+  const uint64_t num_records = ReadUnaligned<uint64_t>(trailer);
+  const uint64_t index_offset = ReadUnaligned<uint64_t>(trailer + 8);
+  const uint64_t interval = ReadUnaligned<uint32_t>(trailer + 16);
+  if (!interval || index_offset < records_begin_ ||
+      index_offset > size_ - kTrailerSize) {
+    return false;
+  }
+  const uint64_t num_entries = (num_records + interval - 1) / interval;
+  if ((size_ - kTrailerSize - index_offset) / sizeof(uint64_t) !=
+      num_entries) {
+    return false;
+  }
+  const uint8_t* entries = data_ + index_offset;
+  std::vector<size_t> index;
+  index.reserve(static_cast<size_t>(num_entries));
+  for (uint64_t i = 0; i < num_entries; i++) {
+    const uint64_t entry = ReadUnaligned<uint64_t>(entries + i * 8);
+    if (entry < records_begin_ || entry >= index_offset ||
+        (!index.empty() && entry <= index.back())) {
+      return false;
+    }
+    index.push_back(static_cast<size_t>(entry));
+  }
+  index_.swap(index);
+  has_index_ = true;
+  records_end_ = static_cast<size_t>(index_offset);
+  num_records_ = static_cast<size_t>(num_records);
+  index_interval_ = static_cast<size_t>(interval);
+  return true;
+}
+
+void RecordStreamReader::ScanRecords() {
+  size_t position = records_begin_;
+  for (;;) {
+    const Record record = RecordAt(position);
+    if (!record.data) break;
+    if (num_records_ % index_interval_ == 0) index_.push_back(position);
+    num_records_++;
+    position = NextPosition(position);
+  }
+}
+
+RecordStreamReader::Record RecordStreamReader::RecordAt(
+    size_t position) const {
+  if (position > records_end_ ||
+      records_end_ - position < sizeof(uoffset_t)) {
+    return Record();
+  }
+  const size_t size = ReadUnaligned<uoffset_t>(data_ + position);
+  size_t end = position + sizeof(uoffset_t);
+  if (records_end_ - end < size) return Record();
+  end += size;
+  if (has_checksums()) {
+    end = AlignUp(end, sizeof(uint32_t));
+    if (end > records_end_ || records_end_ - end < sizeof(uint32_t)) {
+      return Record();
+    }
+  }
+  return Record(data_ + position + sizeof(uoffset_t), size);
+}
+
+size_t RecordStreamReader::NextPosition(size_t position) const {
+  const Record record = RecordAt(position);
+  if (!record.data) return records_end_;
+  size_t end = static_cast<size_t>(record.data - data_) + record.size;
+  if (has_checksums()) {
+    end = AlignUp(end, sizeof(uint32_t)) + sizeof(uint32_t);
+  }
+  return AlignUp(end, alignment_);
+}
+
+bool RecordStreamReader::CheckRecord(const Record& record) const {
+  if (!record.data) return false;
+  if (!has_checksums()) return true;
+  const size_t end = static_cast<size_t>(record.data - data_) + record.size;
+  const uint8_t* checksum = data_ + AlignUp(end, sizeof(uint32_t));
+  return ReadUnaligned<uint32_t>(checksum) ==
+         Crc32c(record.data - sizeof(uoffset_t),
+                record.size + sizeof(uoffset_t));
+}
+
+RecordStreamReader::Iterator RecordStreamReader::At(size_t i) const {
+  if (i >= num_records_) return end();
+  size_t position = index_[i / index_interval_];
+  for (size_t j = i % index_interval_; j > 0; j--) {
+    position = NextPosition(position);
+  }
+  return Iterator(this, i, position);
+}
+
+void RecordStreamReader::Close() {
+  // clang-format off
+  #if defined(FLATBUFFERS_RECORD_STREAM_POSIX_MMAP)
+    if (mapping_) munmap(mapping_, size_);
+  #elif defined(FLATBUFFERS_RECORD_STREAM_WIN32_MMAP)
+    if (mapping_) UnmapViewOfFile(mapping_);
+  #endif
+  // clang-format on
+  mapping_ = nullptr;
+  contents_.clear();
+  data_ = nullptr;
+  size_ = 0;
+  has_index_ = false;
+  records_begin_ = 0;
+  records_end_ = 0;
+  num_records_ = 0;
+  index_.clear();
+}
+
+}  // namespace flatbuffers
@@ -16,6 +16,7 @@
 
 #include "flatbuffers/reflection.h"
 
+#include "flatbuffers/hash.h"
 #include "flatbuffers/util.h"
 
 // Helper functionality for reflection.
@@ -24,12 +25,64 @@ namespace flatbuffers {
 
 namespace {
 
-static void CopyInline(FlatBufferBuilder& fbb,
-                       const reflection::Field& fielddef, const Table& table,
-                       size_t align, size_t size) {
+static void CopyInline(FlatBufferBuilder& fbb, voffset_t field_offset,
+                       const Table& table, size_t align, size_t size) {
   fbb.Align(align);
-  fbb.PushBytes(table.GetStruct<const uint8_t*>(fielddef.offset()), size);
-  fbb.TrackField(fielddef.offset(), fbb.GetSize());
+  fbb.PushBytes(table.GetStruct<const uint8_t*>(field_offset), size);
+  fbb.TrackField(field_offset, fbb.GetSize());
+}
+
+typedef std::vector<std::pair<uint32_t, uint32_t>> NameIndex;
+
+template <typename T>
+static void BuildNameIndex(const Vector<Offset<T>>* defs, NameIndex* index) {
+  // Keep the table at most half full, so probe sequences stay short.
+  size_t num_slots = 2;
+  while (num_slots < 2 * defs->size()) num_slots *= 2;
+  const size_t mask = num_slots - 1;
+  index->assign(num_slots, std::make_pair(0u, 0u));
+  for (uoffset_t i = 0; i < defs->size(); i++) {
+    const uint32_t hash = HashFnv1a<uint32_t>(defs->Get(i)->name()->c_str());
+    size_t slot = hash & mask;
+    while ((*index)[slot].second) slot = (slot + 1) & mask;
+    (*index)[slot] = std::make_pair(hash, i + 1);
+  }
+}
+
+// Returns the index of the definition called `name`, or -1.
+template <typename T>
+static int FindName(const Vector<Offset<T>>* defs, const NameIndex& index,
+                    const char* name) {
+  const uint32_t hash = HashFnv1a<uint32_t>(name);
+  const size_t mask = index.size() - 1;
+  for (size_t slot = hash & mask; index[slot].second;
+       slot = (slot + 1) & mask) {
+    if (index[slot].first != hash) continue;
+    const uoffset_t i = index[slot].second - 1;
+    if (!strcmp(defs->Get(i)->name()->c_str(), name)) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+// Verifies a field of scalar or UType type, of any size.
+static bool VerifyScalarField(flatbuffers::Verifier& v,
+                              const flatbuffers::Table& table,
+                              const CompiledSchema::Field& field) {
+  switch (field.size) {
+    case 1:
+      return table.VerifyField<uint8_t>(v, field.offset, 1);
+    case 2:
+      return table.VerifyField<uint16_t>(v, field.offset, 2);
+    case 4:
+      return table.VerifyField<uint32_t>(v, field.offset, 4);
+    case 8:
+      return table.VerifyField<uint64_t>(v, field.offset, 8);
+    default:
+      FLATBUFFERS_ASSERT(false);
+      return false;
+  }
 }
 
 static bool VerifyStruct(flatbuffers::Verifier& v,
@@ -270,6 +323,153 @@ static bool VerifyObject(flatbuffers::Verifier& v,
   return true;
 }
 
+// The same as the above, for the objects and fields of a CompiledSchema.
+static bool VerifyObject(flatbuffers::Verifier& v,
+                         const CompiledSchema::Object& obj,
+                         const flatbuffers::Table* table, bool required);
+
+static bool VerifyUnion(flatbuffers::Verifier& v,
+                        const CompiledSchema::Field& union_field,
+                        uint8_t utype, const uint8_t* elem) {
+  if (!utype) return true;  // Not present.
+  auto& enumdef = *union_field.enum_def;
+  if (utype >= enumdef.union_base_types.size()) return false;
+  switch (enumdef.union_base_types[utype]) {
+    case reflection::Obj: {
+      auto& elem_obj = *enumdef.union_types[utype];
+      if (elem_obj.is_struct) {
+        return v.VerifyFromPointer(elem, elem_obj.bytesize);
+      } else {
+        return VerifyObject(v, elem_obj,
+                            reinterpret_cast<const flatbuffers::Table*>(elem),
+                            true);
+      }
+    }
+    case reflection::String:
+      return v.VerifyString(reinterpret_cast<const flatbuffers::String*>(elem));
+    default:
+      return false;
+  }
+}
+
+static bool VerifyVector(flatbuffers::Verifier& v,
+                         const flatbuffers::Table& table,
+                         const CompiledSchema::Field& vec_field) {
+  FLATBUFFERS_ASSERT(vec_field.base_type == reflection::Vector);
+  if (!table.VerifyField<uoffset_t>(v, vec_field.offset, sizeof(uoffset_t)))
+    return false;
+  auto vec = table.GetPointer<const uint8_t*>(vec_field.offset);
+
+  switch (vec_field.element) {
+    case reflection::String: {
+      auto vec_string =
+          reinterpret_cast<const Vector<Offset<flatbuffers::String>>*>(vec);
+      return v.VerifyVector(vec_string) && v.VerifyVectorOfStrings(vec_string);
+    }
+    case reflection::Obj: {
+      if (vec_field.object->is_struct) {
+        if (vec_field.required && !vec) return false;
+        return !vec || v.VerifyVectorOrString(vec, vec_field.element_size);
+      }
+      auto vec_table = reinterpret_cast<const Vector<Offset<Table>>*>(vec);
+      if (!v.VerifyVector(vec_table)) return false;
+      if (!vec_table) return true;
+      for (uoffset_t j = 0; j < vec_table->size(); j++) {
+        if (!VerifyObject(v, *vec_field.object, vec_table->Get(j), true)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case reflection::Union: {
+      auto vec_union = reinterpret_cast<const Vector<Offset<uint8_t>>*>(vec);
+      if (!v.VerifyVector(vec_union)) return false;
+      if (!vec_union) return true;
+      auto type_vec =
+          table.GetPointer<Vector<uint8_t>*>(vec_field.union_type->offset);
+      if (!v.VerifyVector(type_vec)) return false;
+      if (type_vec->size() != vec_union->size()) return false;
+      for (uoffset_t j = 0; j < vec_union->size(); j++) {
+        if (!VerifyUnion(v, vec_field, type_vec->Get(j), vec_union->Get(j))) {
+          return false;
+        }
+      }
+      return true;
+    }
+    default:
+      if (!IsScalar(vec_field.element)) {
+        FLATBUFFERS_ASSERT(false);
+        return false;
+      }
+      return !vec || v.VerifyVectorOrString(vec, vec_field.element_size);
+  }
+}
+
+static bool VerifyObject(flatbuffers::Verifier& v,
+                         const CompiledSchema::Object& obj,
+                         const flatbuffers::Table* table, bool required) {
+  if (!table) return !required;
+  if (!table->VerifyTableStart(v)) return false;
+  for (auto it = obj.fields.begin(); it != obj.fields.end(); ++it) {
+    auto& field = *it;
+    switch (field.base_type) {
+      case reflection::String:
+        if (!table->VerifyField<uoffset_t>(v, field.offset,
+                                           sizeof(uoffset_t)) ||
+            !v.VerifyString(table->GetPointer<const String*>(field.offset))) {
+          return false;
+        }
+        break;
+      case reflection::Vector:
+        if (!VerifyVector(v, *table, field)) return false;
+        break;
+      case reflection::Obj:
+        if (field.object->is_struct) {
+          auto offset = table->GetOptionalFieldOffset(field.offset);
+          if (field.required && !offset) return false;
+          if (offset &&
+              !v.VerifyFieldStruct(reinterpret_cast<const uint8_t*>(table),
+                                   offset, field.size,
+                                   field.object->minalign)) {
+            return false;
+          }
+        } else {
+          if (!table->VerifyField<uoffset_t>(v, field.offset,
+                                             sizeof(uoffset_t)) ||
+              !VerifyObject(v, *field.object,
+                            table->GetPointer<const Table*>(field.offset),
+                            field.required)) {
+            return false;
+          }
+        }
+        break;
+      case reflection::Union: {
+        // The type field may come later in the fields, verify it first.
+        if (!VerifyScalarField(v, *table, *field.union_type)) return false;
+        auto utype = table->GetField<uint8_t>(field.union_type->offset, 0);
+        if (!table->VerifyField<uoffset_t>(v, field.offset,
+                                           sizeof(uoffset_t)) ||
+            !VerifyUnion(v, field, utype,
+                         table->GetPointer<const uint8_t*>(field.offset))) {
+          return false;
+        }
+        break;
+      }
+      default:
+        if (!IsScalar(field.base_type)) {
+          FLATBUFFERS_ASSERT(false);
+          break;
+        }
+        if (!VerifyScalarField(v, *table, field)) return false;
+        break;
+    }
+  }
+
+  if (!v.EndTable()) return false;
+
+  return true;
+}
+
 }  // namespace
 
 int64_t GetAnyValueI(reflection::BaseType type, const uint8_t* data) {
@@ -481,10 +681,11 @@ class ResizeContext {
 
   // Check if the range between first (lower address) and second straddles
   // the insertion point. If it does, change the offset at offsetloc (of
-  // type T, with direction D).
+  // type T, with direction D). Anything at the insertion point moves, so
+  // `first` must be before it.
   template <typename T, int D>
   void Straddle(const void* first, const void* second, void* offsetloc) {
-    if (first <= startptr_ && second >= startptr_) {
+    if (first < startptr_ && second >= startptr_) {
       WriteScalar<T>(offsetloc, ReadScalar<T>(offsetloc) + delta_ * D);
       DagCheck(offsetloc) = true;
     }
@@ -756,7 +957,7 @@ Offset<const Table*> CopyTable(FlatBufferBuilder& fbb,
       case reflection::Obj: {
         auto& subobjectdef = *schema.objects()->Get(fielddef.type()->index());
         if (subobjectdef.is_struct()) {
-          CopyInline(fbb, fielddef, table, subobjectdef.minalign(),
+          CopyInline(fbb, fielddef.offset(), table, subobjectdef.minalign(),
                      subobjectdef.bytesize());
           break;
         }
@@ -769,7 +970,7 @@ Offset<const Table*> CopyTable(FlatBufferBuilder& fbb,
         break;
       default: {  // Scalars.
         auto size = GetTypeSize(base_type);
-        CopyInline(fbb, fielddef, table, size, size);
+        CopyInline(fbb, fielddef.offset(), table, size, size);
         break;
       }
     }
@@ -783,6 +984,126 @@ Offset<const Table*> CopyTable(FlatBufferBuilder& fbb,
   }
 }
 
+Offset<const Table*> CopyTable(FlatBufferBuilder& fbb,
+                               const CompiledSchema::Object& objectdef,
+                               const Table& table, bool use_string_pooling) {
+  // The same as the above, with the fields' types at hand.
+  std::vector<uoffset_t> offsets;
+  for (auto it = objectdef.fields.begin(); it != objectdef.fields.end(); ++it) {
+    auto& field = *it;
+    if (!table.CheckField(field.offset)) continue;
+    uoffset_t offset = 0;
+    switch (field.base_type) {
+      case reflection::String: {
+        auto str = table.GetPointer<const String*>(field.offset);
+        offset = use_string_pooling ? fbb.CreateSharedString(str).o
+                                    : fbb.CreateString(str).o;
+        break;
+      }
+      case reflection::Obj: {
+        if (!field.object->is_struct) {
+          offset = CopyTable(fbb, *field.object,
+                             *table.GetPointer<const Table*>(field.offset),
+                             use_string_pooling)
+                       .o;
+        }
+        break;
+      }
+      case reflection::Union: {
+        auto subobjectdef = GetUnionType(field, table);
+        if (subobjectdef) {
+          offset = CopyTable(fbb, *subobjectdef,
+                             *table.GetPointer<const Table*>(field.offset),
+                             use_string_pooling)
+                       .o;
+        } else {  // A string.
+          auto str = table.GetPointer<const String*>(field.offset);
+          offset = use_string_pooling ? fbb.CreateSharedString(str).o
+                                      : fbb.CreateString(str).o;
+        }
+        break;
+      }
+      case reflection::Vector: {
+        auto vec =
+            table.GetPointer<const Vector<Offset<Table>>*>(field.offset);
+        auto elemobjectdef = field.object;
+        switch (field.element) {
+          case reflection::String: {
+            std::vector<Offset<const String*>> elements(vec->size());
+            auto vec_s = reinterpret_cast<const Vector<Offset<String>>*>(vec);
+            for (uoffset_t i = 0; i < vec_s->size(); i++) {
+              elements[i] = use_string_pooling
+                                ? fbb.CreateSharedString(vec_s->Get(i)).o
+                                : fbb.CreateString(vec_s->Get(i)).o;
+            }
+            offset = fbb.CreateVector(elements).o;
+            break;
+          }
+          case reflection::Obj: {
+            if (!elemobjectdef->is_struct) {
+              std::vector<Offset<const Table*>> elements(vec->size());
+              for (uoffset_t i = 0; i < vec->size(); i++) {
+                elements[i] = CopyTable(fbb, *elemobjectdef, *vec->Get(i),
+                                        use_string_pooling);
+              }
+              offset = fbb.CreateVector(elements).o;
+              break;
+            }
+          }
+            FLATBUFFERS_FALLTHROUGH();  // fall thru
+          default: {                    // Scalars and structs.
+            auto element_alignment = elemobjectdef ? elemobjectdef->minalign
+                                                   : field.element_size;
+            fbb.StartVector(vec->size(), field.element_size,
+                            element_alignment);
+            fbb.PushBytes(vec->Data(), field.element_size * vec->size());
+            offset = fbb.EndVector(vec->size());
+            break;
+          }
+        }
+        break;
+      }
+      default:  // Scalars.
+        break;
+    }
+    if (offset) {
+      offsets.push_back(offset);
+    }
+  }
+  auto start = objectdef.is_struct ? fbb.StartStruct(objectdef.minalign)
+                                   : fbb.StartTable();
+  size_t offset_idx = 0;
+  for (auto it = objectdef.fields.begin(); it != objectdef.fields.end(); ++it) {
+    auto& field = *it;
+    if (!table.CheckField(field.offset)) continue;
+    switch (field.base_type) {
+      case reflection::Obj: {
+        if (field.object->is_struct) {
+          CopyInline(fbb, field.offset, table, field.object->minalign,
+                     field.size);
+          break;
+        }
+      }
+        FLATBUFFERS_FALLTHROUGH();  // fall thru
+      case reflection::Union:
+      case reflection::String:
+      case reflection::Vector:
+        fbb.AddOffset(field.offset, Offset<void>(offsets[offset_idx++]));
+        break;
+      default:  // Scalars.
+        CopyInline(fbb, field.offset, table, field.size, field.size);
+        break;
+    }
+  }
+  FLATBUFFERS_ASSERT(offset_idx == offsets.size());
+  if (objectdef.is_struct) {
+    fbb.ClearOffsets();
+    return fbb.EndStruct();
+  } else {
+    return fbb.EndTable(start);
+  }
+}
+
 bool Verify(const reflection::Schema& schema, const reflection::Object& root,
             const uint8_t* const buf, const size_t length,
             const uoffset_t max_depth, const uoffset_t max_tables) {
@@ -800,4 +1121,131 @@ bool VerifySizePrefixed(const reflection::Schema& schema,
                       /*required=*/true);
 }
 
+bool Verify(const CompiledSchema::Object& root, const uint8_t* const buf,
+            const size_t length, const uoffset_t max_depth,
+            const uoffset_t max_tables) {
+  Verifier v(buf, length, max_depth, max_tables);
+  return VerifyObject(v, root, flatbuffers::GetAnyRoot(buf),
+                      /*required=*/true);
+}
+
+bool VerifySizePrefixed(const CompiledSchema::Object& root,
+                        const uint8_t* const buf, const size_t length,
+                        const uoffset_t max_depth, const uoffset_t max_tables) {
+  Verifier v(buf, length, max_depth, max_tables);
+  return VerifyObject(v, root, flatbuffers::GetAnySizePrefixedRoot(buf),
+                      /*required=*/true);
+}
+
+CompiledSchema::CompiledSchema(const reflection::Schema& schema)
+    : schema_(schema), root_table_(nullptr) {
+  auto objectdefs = schema.objects();
+  auto enumdefs = schema.enums();
+  // Size both up front: the fields and unions point into them.
+  objects_.resize(objectdefs->size());
+  enums_.resize(enumdefs->size());
+
+  for (uoffset_t i = 0; i < enumdefs->size(); i++) {
+    auto enumdef = enumdefs->Get(i);
+    auto& compiled = enums_[i];
+    compiled.def = enumdef;
+    if (!enumdef->is_union()) continue;
+    for (auto it = enumdef->values()->begin(); it != enumdef->values()->end();
+         ++it) {
+      auto value = it->value();
+      auto union_type = it->union_type();
+      // Union types are a uint8_t.
+      if (value <= 0 || value > 0xFF || !union_type) continue;
+      auto type_value = static_cast<size_t>(value);
+      if (compiled.union_base_types.size() <= type_value) {
+        compiled.union_base_types.resize(type_value + 1, reflection::None);
+        compiled.union_types.resize(type_value + 1, nullptr);
+      }
+      compiled.union_base_types[type_value] = union_type->base_type();
+      if (union_type->base_type() == reflection::Obj) {
+        compiled.union_types[type_value] = &objects_[union_type->index()];
+      }
+    }
+  }
+
+  for (uoffset_t i = 0; i < objectdefs->size(); i++) {
+    auto objectdef = objectdefs->Get(i);
+    auto& compiled = objects_[i];
+    compiled.def = objectdef;
+    compiled.is_struct = objectdef->is_struct();
+    compiled.bytesize = static_cast<size_t>(objectdef->bytesize());
+    compiled.minalign = static_cast<size_t>(objectdef->minalign());
+    auto fielddefs = objectdef->fields();
+    compiled.fields.resize(fielddefs->size());
+    for (uoffset_t j = 0; j < fielddefs->size(); j++) {
+      auto fielddef = fielddefs->Get(j);
+      auto type = fielddef->type();
+      auto& field = compiled.fields[j];
+      field.def = fielddef;
+      field.offset = fielddef->offset();
+      field.base_type = type->base_type();
+      field.element = type->element();
+      field.type_index = type->index();
+      field.required = fielddef->required();
+      field.default_integer = fielddef->default_integer();
+      field.default_real = fielddef->default_real();
+      field.object = nullptr;
+      field.enum_def = nullptr;
+      field.union_type = nullptr;
+      const bool has_elements = field.base_type == reflection::Vector ||
+                                field.base_type == reflection::Vector64 ||
+                                field.base_type == reflection::Array;
+      if (field.type_index >= 0) {
+        const auto base_type = has_elements ? field.element : field.base_type;
+        if (base_type == reflection::Obj) {
+          field.object = &objects_[static_cast<size_t>(field.type_index)];
+        } else {
+          field.enum_def = &enums_[static_cast<size_t>(field.type_index)];
+        }
+      }
+      field.element_size =
+          has_elements
+              ? GetTypeSizeInline(field.element, field.type_index, schema)
+              : 0;
+      field.size = field.base_type == reflection::Array
+                       ? field.element_size * type->fixed_length()
+                       : GetTypeSizeInline(field.base_type, field.type_index,
+                                           schema);
+    }
+    BuildNameIndex(fielddefs, &compiled.field_index_);
+    // Link unions to their type field, which has a name derived from theirs.
+    for (auto it = compiled.fields.begin(); it != compiled.fields.end(); ++it) {
+      if (it->base_type == reflection::Union ||
+          it->element == reflection::Union) {
+        it->union_type = compiled.LookupField(it->def->name()->str() +
+                                              UnionTypeFieldSuffix());
+        FLATBUFFERS_ASSERT(it->union_type);
+      }
+    }
+  }
+
+  BuildNameIndex(objectdefs, &object_index_);
+  BuildNameIndex(enumdefs, &enum_index_);
+  if (schema.root_table()) {
+    root_table_ = LookupObject(schema.root_table()->name()->c_str());
+  }
+}
+
+const CompiledSchema::Field* CompiledSchema::Object::LookupField(
+    const char* name) const {
+  const int i = FindName(def->fields(), field_index_, name);
+  return i < 0 ? nullptr : &fields[static_cast<size_t>(i)];
+}
+
+const CompiledSchema::Object* CompiledSchema::LookupObject(
+    const char* name) const {
+  const int i = FindName(schema_.objects(), object_index_, name);
+  return i < 0 ? nullptr : &objects_[static_cast<size_t>(i)];
+}
+
+const CompiledSchema::Enum* CompiledSchema::LookupEnum(const char* name) const {
+  const int i = FindName(schema_.enums(), enum_index_, name);
+  return i < 0 ? nullptr : &enums_[static_cast<size_t>(i)];
+}
+
 }  // namespace flatbuffers
@@ -0,0 +1,707 @@
+/*
+ * Copyright 2025 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flatbuffers/transcoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "flatbuffers/util.h"
+
+namespace flatbuffers {
+
+namespace {
+
+static bool IsSigned(reflection::BaseType type) {
+  return type == reflection::Byte || type == reflection::Short ||
+         type == reflection::Int || type == reflection::Long;
+}
+
+// Whether every value of the scalar type `from` can be represented by `to`.
+static bool IsLossless(reflection::BaseType from, reflection::BaseType to) {
+  if (from == to) return true;
+  const size_t from_size = GetTypeSize(from);
+  const size_t to_size = GetTypeSize(to);
+  if (IsInteger(from) && IsInteger(to)) {
+    if (to == reflection::Bool) return false;
+    if (IsSigned(from) == IsSigned(to)) return to_size >= from_size;
+    return !IsSigned(from) && to_size > from_size;
+  }
+  // Floats have 24, doubles 53 bits of mantissa.
+  if (IsInteger(from) && IsFloat(to)) return from_size < to_size;
+  return from == reflection::Float && to == reflection::Double;
+}
+
+// Stores the scalar of type `from` at `data` as type `to` into `value`.
+static void ConvertScalar(reflection::BaseType from, const uint8_t* data,
+                          reflection::BaseType to, uint8_t* value) {
+  if (IsFloat(to)) {
+    SetAnyValueF(to, value, GetAnyValueF(from, data));
+  } else {
+    SetAnyValueI(to, value, GetAnyValueI(from, data));
+  }
+}
+
+static void StoreDefault(const CompiledSchema::Field& field,
+                         reflection::BaseType type, uint8_t* value) {
+  if (IsFloat(type)) {
+    SetAnyValueF(type, value,
+                 IsFloat(field.base_type)
+                     ? field.default_real
+                     : static_cast<double>(field.default_integer));
+  } else {
+    SetAnyValueI(type, value, field.default_integer);
+  }
+}
+
+static bool IsSingleBit(int64_t value) {
+  return value > 0 && (value & (value - 1)) == 0;
+}
+
+// Matches each value of `source` with the value of `target` of the same name,
+// and adds those that differ to `values`, sorted by the source value. Returns
+// the first source value that isn't in `target`, or nullptr if there is none.
+static const reflection::EnumVal* MatchEnumValues(
+    const reflection::Enum& source, const reflection::Enum& target,
+    std::vector<std::pair<int64_t, int64_t>>* values) {
+  auto target_values = target.values();
+  for (auto source_value : *source.values()) {
+    const reflection::EnumVal* match = nullptr;
+    for (auto target_value : *target_values) {
+      if (target_value->name()->str() == source_value->name()->str()) {
+        match = target_value;
+        break;
+      }
+    }
+    if (!match) return source_value;
+    if (match->value() != source_value->value()) {
+      values->push_back(std::make_pair(source_value->value(), match->value()));
+    }
+  }
+  return nullptr;
+}
+
+// Whether structs can be copied as is from `source` to `target`.
+static bool IsSameLayout(const CompiledSchema::Object& source,
+                         const CompiledSchema::Object& target) {
+  if (source.bytesize != target.bytesize ||
+      source.minalign != target.minalign ||
+      source.fields.size() != target.fields.size()) {
+    return false;
+  }
+  for (auto it = target.fields.begin(); it != target.fields.end(); ++it) {
+    auto source_field = source.LookupField(it->def->name()->c_str());
+    if (!source_field || source_field->offset != it->offset ||
+        source_field->base_type != it->base_type ||
+        source_field->element != it->element ||
+        source_field->size != it->size) {
+      return false;
+    }
+    if (it->object && !IsSameLayout(*source_field->object, *it->object)) {
+      return false;
+    }
+    if (it->enum_def && source_field->enum_def) {
+      std::vector<std::pair<int64_t, int64_t>> values;
+      if (MatchEnumValues(*source_field->enum_def->def, *it->enum_def->def,
+                          &values) ||
+          !values.empty()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static std::string Trim(const std::string& s) {
+  const char* whitespace = " \t\r";
+  const size_t begin = s.find_first_not_of(whitespace);
+  if (begin == std::string::npos) return "";
+  return s.substr(begin, s.find_last_not_of(whitespace) + 1 - begin);
+}
+
+static std::string TypeName(const CompiledSchema::Field& field) {
+  std::string name = reflection::EnumNameBaseType(field.base_type);
+  if (field.element != reflection::None) {
+    name += std::string(" of ") + reflection::EnumNameBaseType(field.element);
+  }
+  if (field.object) name += " " + field.object->def->name()->str();
+  return name;
+}
+
+}  // namespace
+
+bool TranscoderMapping::Parse(const char* text, std::string* error) {
+  int line_number = 0;
+  for (const char* line = text; *line;) {
+    const char* end = strchr(line, '\n');
+    if (!end) end = line + strlen(line);
+    std::string contents(line, end);
+    line = *end ? end + 1 : end;
+    line_number++;
+    contents = contents.substr(0, contents.find('#'));
+    const size_t equals = contents.find('=');
+    const std::string target = Trim(contents.substr(0, equals));
+    if (target.empty() && equals == std::string::npos) continue;
+    if (target.empty() || equals == std::string::npos) {
+      *error = "line " + NumToString(line_number) +
+               ": expected `target = source`";
+      return false;
+    }
+    Add(target, Trim(contents.substr(equals + 1)));
+  }
+  return true;
+}
+
+const size_t Transcoder::kNoPlan;
+
+Transcoder::Transcoder(const reflection::Schema& source,
+                       const reflection::Schema& target)
+    : source_(source), target_(target), mapping_(nullptr) {}
+
+bool Transcoder::Compile(const TranscoderMapping& mapping) {
+  error_.clear();
+  compiled_.clear();
+  object_plans_.clear();
+  enum_plans_.clear();
+  union_plans_.clear();
+  auto target_root = target_.root_table();
+  if (!target_root) {
+    error_ = "the target schema has no root table";
+    return false;
+  }
+  auto mapped = mapping.Lookup(target_root->def->name()->str());
+  auto source_root =
+      mapped ? source_.LookupObject(*mapped) : source_.root_table();
+  if (!source_root) {
+    error_ = mapped ? "unknown source table " + *mapped
+                    : "the source schema has no root table";
+    return false;
+  }
+  mapping_ = &mapping;
+  CompileObject(*source_root, *target_root);
+  mapping_ = nullptr;
+  return error_.empty();
+}
+
+const CompiledSchema::Field* Transcoder::SourceField(
+    const CompiledSchema::Object& source, const std::string& name,
+    const CompiledSchema::Field& target) {
+  const CompiledSchema::Field* field;
+  auto mapped = mapping_->Lookup(name);
+  if (!mapped) {
+    field = source.LookupField(target.def->name()->c_str());
+  } else if (mapped->empty()) {
+    return nullptr;
+  } else {
+    field = source.LookupField(*mapped);
+    if (!field) {
+      error_ = name + " is mapped to unknown field " +
+               source.def->name()->str() + "." + *mapped;
+      return nullptr;
+    }
+  }
+  return field && !field->def->deprecated() ? field : nullptr;
+}
+
+size_t Transcoder::CompileObject(const CompiledSchema::Object& source,
+                                 const CompiledSchema::Object& target) {
+  const std::pair<const void*, const void*> key(&source, &target);
+  auto it = compiled_.find(key);
+  if (it != compiled_.end()) return it->second;
+  // Register the plan before compiling the fields, which may refer to it.
+  const size_t index = object_plans_.size();
+  compiled_[key] = index;
+  object_plans_.push_back(ObjectPlan());
+  object_plans_[index].source = &source;
+  object_plans_[index].target = &target;
+
+  std::vector<FieldPlan> offset_fields;
+  std::vector<FieldPlan> inline_fields;
+  const std::string table_name = target.def->name()->str();
+  for (auto field = target.fields.begin(); field != target.fields.end();
+       ++field) {
+    if (field->def->deprecated()) continue;
+    const std::string name = table_name + "." + field->def->name()->str();
+    FieldPlan plan;
+    if (field->base_type == reflection::UType ||
+        field->element == reflection::UType) {
+      // Union types are converted along with their union.
+      const std::string union_name = name.substr(
+          0, name.size() - strlen(UnionTypeFieldSuffix()));
+      auto union_field =
+          target.LookupField(union_name.substr(table_name.size() + 1));
+      if (!union_field || union_field->union_type != &*field) continue;
+      auto source_union = SourceField(source, union_name, *union_field);
+      if (!error_.empty()) return index;
+      if (!source_union || field->element == reflection::UType) continue;
+      if (!CompileField(*source_union, *union_field, union_name, &plan)) {
+        return index;
+      }
+      plan.op = kUnionType;
+      plan.source_offset = source_union->union_type->offset;
+      plan.target_offset = field->offset;
+      plan.size = plan.align = sizeof(uint8_t);
+      plan.has_fill = false;
+      inline_fields.push_back(plan);
+      continue;
+    }
+    auto source_field = SourceField(source, name, *field);
+    if (!error_.empty()) return index;
+    if (!source_field) {
+      if (field->required) {
+        error_ = name + " is required, but has no source field";
+        return index;
+      }
+      continue;
+    }
+    if (field->required && !source_field->required) {
+      // A buffer without the source field would make an invalid target.
+      error_ = name + " is required, but its source field " +
+               source.def->name()->str() + "." +
+               source_field->def->name()->str() + " is optional";
+      return index;
+    }
+    if (!CompileField(*source_field, *field, name, &plan)) return index;
+    if (IsScalar(field->base_type) || plan.op == kStruct) {
+      inline_fields.push_back(plan);
+    } else {
+      offset_fields.push_back(plan);
+    }
+  }
+  std::stable_sort(inline_fields.begin(), inline_fields.end(),
+                   [](const FieldPlan& a, const FieldPlan& b) {
+                     return a.align > b.align;
+                   });
+  object_plans_[index].offset_fields.swap(offset_fields);
+  object_plans_[index].inline_fields.swap(inline_fields);
+  return index;
+}
+
+size_t Transcoder::CompileUnion(const CompiledSchema::Enum& source,
+                                const CompiledSchema::Enum& target) {
+  const std::pair<const void*, const void*> key(&source, &target);
+  auto it = compiled_.find(key);
+  if (it != compiled_.end()) return it->second;
+  const size_t index = union_plans_.size();
+  compiled_[key] = index;
+  union_plans_.push_back(UnionPlan());
+
+  UnionPlan plan;
+  const size_t num_types = source.union_base_types.size();
+  plan.types.resize(num_types, 0);
+  plan.plans.resize(num_types, kNoPlan);
+  auto source_values = source.def->values();
+  auto target_values = target.def->values();
+  for (auto source_value = source_values->begin();
+       source_value != source_values->end(); ++source_value) {
+    const int64_t type = source_value->value();
+    if (type <= 0 || static_cast<size_t>(type) >= num_types) continue;
+    const auto base_type = source.union_base_types[type];
+    auto source_object = source.union_types[type];
+    // The target type with the same table, or else the same name.
+    const reflection::EnumVal* match = nullptr;
+    for (auto target_value = target_values->begin();
+         target_value != target_values->end() && !match; ++target_value) {
+      const int64_t target_type = target_value->value();
+      if (target_type <= 0 ||
+          static_cast<size_t>(target_type) >=
+              target.union_base_types.size() ||
+          target.union_base_types[target_type] != base_type) {
+        continue;
+      }
+      auto target_object = target.union_types[target_type];
+      if (source_object && target_object) {
+        const std::string target_name = target_object->def->name()->str();
+        auto mapped = mapping_->Lookup(target_name);
+        if ((mapped ? *mapped : target_name) ==
+            source_object->def->name()->str()) {
+          match = *target_value;
+        }
+      }
+    }
+    for (auto target_value = target_values->begin();
+         target_value != target_values->end() && !match; ++target_value) {
+      const int64_t target_type = target_value->value();
+      if (target_type > 0 &&
+          static_cast<size_t>(target_type) < target.union_base_types.size() &&
+          target.union_base_types[target_type] == base_type &&
+          target_value->name()->str() == source_value->name()->str()) {
+        match = *target_value;
+      }
+    }
+    if (!match) continue;  // Dropped.
+    plan.types[type] = static_cast<uint8_t>(match->value());
+    if (base_type == reflection::Obj) {
+      auto target_object = target.union_types[match->value()];
+      if (source_object->is_struct || target_object->is_struct) {
+        error_ = target.def->name()->str() + "." + match->name()->str() +
+                 ": unions of structs can't be transcoded";
+        return index;
+      }
+      plan.plans[type] = CompileObject(*source_object, *target_object);
+      if (!error_.empty()) return index;
+    }
+  }
+  union_plans_[index] = plan;
+  return index;
+}
+
+size_t Transcoder::CompileEnum(const CompiledSchema::Enum& source,
+                               const CompiledSchema::Enum& target,
+                               const std::string& name) {
+  const std::pair<const void*, const void*> key(&source, &target);
+  auto it = compiled_.find(key);
+  if (it != compiled_.end()) return it->second;
+
+  EnumPlan plan;
+  auto missing = MatchEnumValues(*source.def, *target.def, &plan.values);
+  if (missing) {
+    error_ = name + ": " + source.def->name()->str() + "." +
+             missing->name()->str() + " has no value in " +
+             target.def->name()->str();
+    return kNoPlan;
+  }
+  // If all values are single bits, as with bit_flags enums (which schemas
+  // don't mark unless serialized with their builtin attributes), renumbering
+  // each bit renumbers combinations of flags as well.
+  plan.bit_flags = true;
+  for (auto value : *source.def->values()) {
+    if (!IsSingleBit(value->value())) plan.bit_flags = false;
+  }
+  for (auto it = plan.values.begin(); it != plan.values.end(); ++it) {
+    if (!IsSingleBit(it->second)) plan.bit_flags = false;
+  }
+  // Enums with the same values are copied like any other scalar.
+  size_t index = kNoPlan;
+  if (!plan.values.empty()) {
+    index = enum_plans_.size();
+    enum_plans_.push_back(plan);
+  }
+  compiled_[key] = index;
+  return index;
+}
+
+bool Transcoder::CompileScalar(reflection::BaseType source,
+                               reflection::BaseType target,
+                               const std::string& name, FieldOp* op) {
+  if (!IsScalar(source) || !IsLossless(source, target)) {
+    error_ = name + ": can't convert " + reflection::EnumNameBaseType(source) +
+             " to " + reflection::EnumNameBaseType(target) +
+             " without losing values";
+    return false;
+  }
+  *op = source == target ? kCopyScalar : kConvertScalar;
+  return true;
+}
+
+bool Transcoder::CompileField(const CompiledSchema::Field& source,
+                              const CompiledSchema::Field& target,
+                              const std::string& name, FieldPlan* plan) {
+  plan->source_offset = source.offset;
+  plan->target_offset = target.offset;
+  plan->source_type_offset = source.union_type ? source.union_type->offset : 0;
+  plan->source_type = source.base_type;
+  plan->target_type = target.base_type;
+  plan->size = target.size;
+  plan->align = target.size;
+  plan->source_size = source.size;
+  plan->plan = kNoPlan;
+  plan->has_fill = false;
+  memset(plan->fill, 0, sizeof(plan->fill));
+
+  if (IsScalar(target.base_type)) {
+    if (!CompileScalar(source.base_type, target.base_type, name, &plan->op)) {
+      return false;
+    }
+    if (source.enum_def && target.enum_def) {
+      plan->plan = CompileEnum(*source.enum_def, *target.enum_def, name);
+      if (!error_.empty()) return false;
+      if (plan->plan != kNoPlan) plan->op = kEnum;
+    }
+    // Absent fields take the default of their schema, so if the defaults
+    // differ the source default has to be stored explicitly.
+    if (!source.def->optional()) {
+      uint8_t target_default[sizeof(largest_scalar_t)] = {};
+      if (plan->op == kEnum) {
+        SetAnyValueI(target.base_type, plan->fill,
+                     MapEnum(plan->plan, source.default_integer));
+      } else {
+        StoreDefault(source, target.base_type, plan->fill);
+      }
+      StoreDefault(target, target.base_type, target_default);
+      plan->has_fill = target.def->optional() ||
+                       memcmp(plan->fill, target_default, target.size) != 0;
+    }
+    return true;
+  }
+
+  const std::string mismatch = name + ": can't transcode " +
+                               TypeName(source) + " to " + TypeName(target);
+  if (source.base_type != target.base_type) {
+    error_ = mismatch;
+    return false;
+  }
+  switch (target.base_type) {
+    case reflection::String:
+      plan->op = kString;
+      return true;
+    case reflection::Obj:
+      if (source.object->is_struct != target.object->is_struct) break;
+      if (target.object->is_struct) {
+        if (!IsSameLayout(*source.object, *target.object)) break;
+        plan->op = kStruct;
+        plan->align = target.object->minalign;
+        return true;
+      }
+      plan->op = kTable;
+      plan->plan = CompileObject(*source.object, *target.object);
+      return error_.empty();
+    case reflection::Union:
+      plan->op = kUnion;
+      plan->plan = CompileUnion(*source.enum_def, *target.enum_def);
+      return error_.empty();
+    case reflection::Vector:
+      plan->size = plan->align = target.element_size;
+      plan->source_size = source.element_size;
+      if (IsScalar(target.element)) {
+        plan->source_type = source.element;
+        plan->target_type = target.element;
+        if (!CompileScalar(source.element, target.element, name, &plan->op)) {
+          return false;
+        }
+        plan->op = plan->op == kCopyScalar ? kVectorOfScalars
+                                           : kVectorOfConvertedScalars;
+        if (source.enum_def && target.enum_def) {
+          plan->plan = CompileEnum(*source.enum_def, *target.enum_def, name);
+          if (!error_.empty()) return false;
+          if (plan->plan != kNoPlan) plan->op = kVectorOfEnums;
+        }
+        return true;
+      }
+      if (source.element != target.element) break;
+      if (target.element == reflection::Union) {
+        error_ = name + ": vectors of unions can't be transcoded";
+        return false;
+      }
+      if (target.element == reflection::String) {
+        plan->op = kVectorOfStrings;
+        return true;
+      }
+      if (target.element != reflection::Obj ||
+          source.object->is_struct != target.object->is_struct) {
+        break;
+      }
+      if (target.object->is_struct) {
+        if (!IsSameLayout(*source.object, *target.object)) break;
+        plan->op = kVectorOfStructs;
+        plan->align = target.object->minalign;
+        return true;
+      }
+      plan->op = kVectorOfTables;
+      plan->plan = CompileObject(*source.object, *target.object);
+      return error_.empty();
+    default:
+      break;
+  }
+  error_ = mismatch;
+  return false;
+}
+
+int64_t Transcoder::MapEnum(size_t plan_index, int64_t value) const {
+  const EnumPlan& plan = enum_plans_[plan_index];
+  if (plan.bit_flags) {
+    // Clear all renumbered flags before setting them, as they may overlap.
+    int64_t flags = value;
+    for (auto it = plan.values.begin(); it != plan.values.end(); ++it) {
+      if (value & it->first) flags &= ~it->first;
+    }
+    for (auto it = plan.values.begin(); it != plan.values.end(); ++it) {
+      if (value & it->first) flags |= it->second;
+    }
+    return flags;
+  }
+  auto it = std::lower_bound(plan.values.begin(), plan.values.end(), value,
+                             [](const std::pair<int64_t, int64_t>& entry,
+                                int64_t v) { return entry.first < v; });
+  return it != plan.values.end() && it->first == value ? it->second : value;
+}
+
+Offset<const Table*> Transcoder::TranscodeTable(FlatBufferBuilder& fbb,
+                                                const Table& table) const {
+  FLATBUFFERS_ASSERT(!object_plans_.empty());  // Call Compile() first.
+  std::vector<uoffset_t> offsets;
+  return TranscodeTable(fbb, 0, table, &offsets);
+}
+
+void Transcoder::Transcode(const uint8_t* buffer, FlatBufferBuilder& fbb,
+                           bool size_prefixed) const {
+  auto root = size_prefixed ? GetAnySizePrefixedRoot(buffer)
+                            : GetAnyRoot(buffer);
+  auto file_ident = target_.schema().file_ident();
+  auto table = TranscodeTable(fbb, *root);
+  if (size_prefixed) {
+    fbb.FinishSizePrefixed(table, file_ident ? file_ident->c_str() : nullptr);
+  } else {
+    fbb.Finish(table, file_ident ? file_ident->c_str() : nullptr);
+  }
+}
+
+Offset<const Table*> Transcoder::TranscodeTable(
+    FlatBufferBuilder& fbb, size_t plan_index, const Table& table,
+    std::vector<uoffset_t>* offsets) const {
+  const ObjectPlan& plan = object_plans_[plan_index];
+  // `offsets` is used as a stack, holding the offsets of the fields of all
+  // tables that are being transcoded.
+  const size_t base = offsets->size();
+  for (auto it = plan.offset_fields.begin(); it != plan.offset_fields.end();
+       ++it) {
+    const uoffset_t offset = TranscodeOffsetField(fbb, *it, table, offsets);
+    offsets->push_back(offset);
+  }
+  const uoffset_t start = fbb.StartTable();
+  for (size_t i = 0; i < plan.offset_fields.size(); i++) {
+    const uoffset_t offset = (*offsets)[base + i];
+    if (offset) {
+      fbb.AddOffset(plan.offset_fields[i].target_offset, Offset<void>(offset));
+    }
+  }
+  for (auto it = plan.inline_fields.begin(); it != plan.inline_fields.end();
+       ++it) {
+    TranscodeInlineField(fbb, *it, table);
+  }
+  offsets->resize(base);
+  return fbb.EndTable(start);
+}
+
+uoffset_t Transcoder::TranscodeOffsetField(
+    FlatBufferBuilder& fbb, const FieldPlan& field, const Table& table,
+    std::vector<uoffset_t>* offsets) const {
+  auto data = table.GetPointer<const uint8_t*>(field.source_offset);
+  if (!data) return 0;
+  switch (field.op) {
+    case kString:
+      return fbb.CreateString(reinterpret_cast<const String*>(data)).o;
+    case kTable:
+      return TranscodeTable(fbb, field.plan,
+                            *reinterpret_cast<const Table*>(data), offsets)
+          .o;
+    case kUnion: {
+      const UnionPlan& plan = union_plans_[field.plan];
+      const uint8_t type = table.GetField<uint8_t>(field.source_type_offset, 0);
+      if (type >= plan.types.size() || !plan.types[type]) return 0;
+      if (plan.plans[type] == kNoPlan) {
+        return fbb.CreateString(reinterpret_cast<const String*>(data)).o;
+      }
+      return TranscodeTable(fbb, plan.plans[type],
+                            *reinterpret_cast<const Table*>(data), offsets)
+          .o;
+    }
+    case kVectorOfScalars:
+    case kVectorOfStructs: {
+      auto vec = reinterpret_cast<const VectorOfAny*>(data);
+      fbb.StartVector(vec->size(), field.size, field.align);
+      fbb.PushBytes(vec->Data(), vec->size() * field.size);
+      return fbb.EndVector(vec->size());
+    }
+    case kVectorOfConvertedScalars: {
+      auto vec = reinterpret_cast<const VectorOfAny*>(data);
+      fbb.StartVector(vec->size(), field.size, field.align);
+      uint8_t value[sizeof(largest_scalar_t)];
+      // Vectors are built back to front.
+      for (uoffset_t i = vec->size(); i-- > 0;) {
+        ConvertScalar(field.source_type, vec->Data() + i * field.source_size,
+                      field.target_type, value);
+        fbb.PushBytes(value, field.size);
+      }
+      return fbb.EndVector(vec->size());
+    }
+    case kVectorOfEnums: {
+      auto vec = reinterpret_cast<const VectorOfAny*>(data);
+      fbb.StartVector(vec->size(), field.size, field.align);
+      uint8_t value[sizeof(largest_scalar_t)];
+      for (uoffset_t i = vec->size(); i-- > 0;) {
+        const int64_t source_value = GetAnyValueI(
+            field.source_type, vec->Data() + i * field.source_size);
+        SetAnyValueI(field.target_type, value,
+                     MapEnum(field.plan, source_value));
+        fbb.PushBytes(value, field.size);
+      }
+      return fbb.EndVector(vec->size());
+    }
+    case kVectorOfStrings:
+    case kVectorOfTables: {
+      auto vec = reinterpret_cast<const Vector<Offset<Table>>*>(data);
+      const size_t base = offsets->size();
+      for (uoffset_t i = 0; i < vec->size(); i++) {
+        const uoffset_t offset =
+            field.op == kVectorOfStrings
+                ? fbb.CreateString(reinterpret_cast<const String*>(
+                                       vec->Get(i)))
+                      .o
+                : TranscodeTable(fbb, field.plan, *vec->Get(i), offsets).o;
+        offsets->push_back(offset);
+      }
+      fbb.StartVector<Offset<Table>>(vec->size());
+      for (size_t i = offsets->size(); i-- > base;) {
+        fbb.PushElement(Offset<Table>((*offsets)[i]));
+      }
+      offsets->resize(base);
+      return fbb.EndVector(vec->size());
+    }
+    default:
+      FLATBUFFERS_ASSERT(false);
+      return 0;
+  }
+}
+
+void Transcoder::TranscodeInlineField(FlatBufferBuilder& fbb,
+                                      const FieldPlan& field,
+                                      const Table& table) const {
+  auto data = table.GetAddressOf(field.source_offset);
+  uint8_t value[sizeof(largest_scalar_t)];
+  if (!data) {
+    if (!field.has_fill) return;
+    data = field.fill;
+  } else {
+    switch (field.op) {
+      case kConvertScalar:
+        ConvertScalar(field.source_type, data, field.target_type, value);
+        data = value;
+        break;
+      case kEnum: {
+        const int64_t source_value = GetAnyValueI(field.source_type, data);
+        SetAnyValueI(field.target_type, value,
+                     MapEnum(field.plan, source_value));
+        data = value;
+        break;
+      }
+      case kUnionType: {
+        const UnionPlan& plan = union_plans_[field.plan];
+        if (*data >= plan.types.size() || !plan.types[*data]) return;
+        value[0] = plan.types[*data];
+        data = value;
+        break;
+      }
+      default:  // Copied as is.
+        break;
+    }
+  }
+  fbb.Align(field.align);
+  fbb.PushBytes(data, field.size);
+  fbb.TrackField(field.target_offset, fbb.GetSize());
+}
+
+}  // namespace flatbuffers
@@ -19,12 +19,16 @@
 // Warning:
 // This is an experimental feature and could change at any time.
 
+#include <limits>
+
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/flex_flat_util.h"
 #include "flatbuffers/flexbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
+#include "flatbuffers/pmr.h"
 #include "flatbuffers/registry.h"
+#include "flatbuffers/static_reflection.h"
 #include "flatbuffers/util.h"
 #include "stringify_util.h"
 #include "test_assert.h"
@@ -33,6 +37,7 @@
 namespace cpp17 {
 #include "generated_cpp17/monster_test_generated.h"
 #include "generated_cpp17/optional_scalars_generated.h"
+#include "generated_cpp17/pmr_test_generated.h"
 #include "generated_cpp17/union_vector_generated.h"
 }  // namespace cpp17
 
@@ -255,10 +260,213 @@ void OptionalScalarsTest() {
   TEST_ASSERT(opts->maybe_i32() == std::optional<int64_t>(-1));
 }
 
+void PmrObjectApiTest() {
+  using namespace cpp17::PmrTest;
+
+  InventoryT inv;
+  inv.owner = "a name too long for the small string optimization";
+  inv.counts = { 1, 2, 3 };
+  inv.flags = { true, false };
+  inv.points.emplace_back(1.0f, 2.0f);
+  inv.origin.reset(new Vec2(3.0f, 4.0f));
+  inv.items.emplace_back(new ItemT());
+  inv.items[0]->name = "item";
+  inv.items[0]->tags.emplace_back("tag");
+  inv.best.reset(new ItemT(*inv.items[0]));
+  inv.inline_items.resize(2);
+  inv.inline_items[1].name = "an inline item with a name that is long enough";
+  inv.inline_items[1].tags.emplace_back("inline tag");
+
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishInventoryBuffer(fbb, Inventory::Pack(fbb, &inv));
+
+  // Everything is allocated from the arena, nothing from the heap.
+  char storage[8192];
+  std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage),
+                                            std::pmr::null_memory_resource());
+  auto unpacked = UnPackInventory(fbb.GetBufferPointer(), &arena);
+  TEST_ASSERT(*unpacked == inv);
+  TEST_ASSERT(unpacked->get_allocator().resource() == &arena);
+  TEST_ASSERT(unpacked->owner.get_allocator().resource() == &arena);
+  TEST_ASSERT(unpacked->items.get_allocator().resource() == &arena);
+  TEST_ASSERT(unpacked->items[0]->get_allocator().resource() == &arena);
+  TEST_ASSERT(unpacked->items[0]->tags[0].get_allocator().resource() ==
+              &arena);
+  TEST_ASSERT(unpacked->origin.get_deleter().resource == &arena);
+  TEST_ASSERT(unpacked->best.get_deleter().resource == &arena);
+  // Tables held by value are unpacked in place.
+  TEST_ASSERT(unpacked->inline_items[1].get_allocator().resource() == &arena);
+  TEST_ASSERT(unpacked->inline_items[1].name.get_allocator().resource() ==
+              &arena);
+
+  // So are copies given an allocator, such as the elements of std::pmr
+  // containers, with the tables they point to.
+  std::pmr::monotonic_buffer_resource other_arena;
+  std::pmr::vector<InventoryT> inventories(&other_arena);
+  inventories.push_back(*unpacked);
+  inventories.emplace_back(InventoryT(inv));
+  for (const InventoryT& copied : inventories) {
+    TEST_ASSERT(copied == inv);
+    TEST_ASSERT(copied.get_allocator().resource() == &other_arena);
+    TEST_ASSERT(copied.owner.get_allocator().resource() == &other_arena);
+    TEST_ASSERT(copied.inline_items[1].tags.get_allocator().resource() ==
+                &other_arena);
+  }
+  // The second one is moved from a table on another resource, which copies
+  // the tables it points to.
+  for (const InventoryT& copied : inventories) {
+    TEST_ASSERT(copied.best.get_deleter().resource == &other_arena);
+    TEST_ASSERT(copied.best->name.get_allocator().resource() == &other_arena);
+    TEST_ASSERT(copied.origin.get_deleter().resource == &other_arena);
+    TEST_ASSERT(copied.items[0].get_deleter().resource == &other_arena);
+    TEST_ASSERT(copied.items[0]->name.get_allocator().resource() ==
+                &other_arena);
+    TEST_ASSERT(copied.items[0]->tags.get_allocator().resource() ==
+                &other_arena);
+  }
+
+  // Moves between tables on the same resource take the tables over.
+  const ItemT* best = inventories[1].best.get();
+  InventoryT moved(std::move(inventories[1]), &other_arena);
+  TEST_ASSERT(moved.best.get() == best);
+  TEST_ASSERT(moved == inv);
+
+  // Copies use the default resource, assignment keeps the target's.
+  InventoryT copy = *unpacked;
+  TEST_ASSERT(copy == inv);
+  TEST_ASSERT(copy.owner.get_allocator().resource() ==
+              std::pmr::get_default_resource());
+  inv.owner = "another name that does not fit into a small string";
+  *unpacked = inv;
+  TEST_ASSERT(*unpacked == inv);
+  TEST_ASSERT(unpacked->owner.get_allocator().resource() == &arena);
+
+  // The regular object API is still available.
+  auto heap = UnPackInventory(fbb.GetBufferPointer());
+  TEST_ASSERT(heap->owner.get_allocator().resource() ==
+              std::pmr::get_default_resource());
+  TEST_ASSERT(heap->origin.get_deleter().resource ==
+              std::pmr::get_default_resource());
+}
+
+/*******************************************************************************
+** Test Case: Generic visitors over the static reflection Traits.
+*******************************************************************************/
+void StaticReflectionVisitorsTest() {
+  using ::cpp17::MyGame::Example::Any;
+  using ::cpp17::MyGame::Example::Color;
+  using ::cpp17::MyGame::Example::Test;
+  flatbuffers::FlatBufferBuilder fbb;
+  const Vec3 pos(1.5f, 2, 3, 0.25, Color::Red, Test(1, -2));
+  const std::vector<uint8_t> inventory = { 1, 2 };
+  auto inner_name = fbb.CreateString("inner");
+  ::cpp17::MyGame::Example::MonsterBuilder inner_builder(fbb);
+  inner_builder.add_name(inner_name);
+  auto inner = inner_builder.Finish();
+  auto strings = fbb.CreateVectorOfStrings({ "a", "b\"c" });
+  auto name = fbb.CreateString("outer");
+  auto inventory_offset = fbb.CreateVector(inventory);
+  ::cpp17::MyGame::Example::MonsterBuilder builder(fbb);
+  builder.add_pos(&pos);
+  builder.add_hp(7);
+  builder.add_name(name);
+  builder.add_inventory(inventory_offset);
+  builder.add_color(Color::Red);
+  builder.add_test_type(Any::Monster);
+  builder.add_test(inner.Union());
+  builder.add_testarrayofstring(strings);
+  builder.add_testf(std::numeric_limits<float>::quiet_NaN());
+  fbb.Finish(builder.Finish());
+  const auto* monster = flatbuffers::GetRoot<Monster>(fbb.GetBufferPointer());
+
+  // Fields that aren't present are skipped, enums named, unions followed.
+  TEST_EQ_STR(flatbuffers::ToJson(*monster).c_str(),
+              "{\"pos\":{\"x\":1.5,\"y\":2.0,\"z\":3.0,\"test1\":0.25,"
+              "\"test2\":\"Red\",\"test3\":{\"a\":1,\"b\":-2}},"
+              "\"hp\":7,\"name\":\"outer\",\"inventory\":[1,2],"
+              "\"color\":\"Red\",\"test_type\":\"Monster\","
+              "\"test\":{\"name\":\"inner\"},"
+              "\"testarrayofstring\":[\"a\",\"b\\\"c\"],\"testf\":nan}");
+
+  size_t num_fields = 0;
+  size_t num_present = 0;
+  flatbuffers::ForEachField(*monster,
+                            [&](const char*, const auto&) { num_fields++; });
+  flatbuffers::ForEachPresentField(
+      *monster, [&](const char*, const auto&) { num_present++; });
+  TEST_EQ(num_fields, Monster::Traits::fields_number);
+  TEST_EQ(num_present, 9u);
+  // NaNs equal themselves.
+  TEST_ASSERT(flatbuffers::ObjectsEqual(*monster, *monster));
+  TEST_EQ(flatbuffers::HashObject(*monster), flatbuffers::HashObject(*monster));
+
+  // Vectors of unions, of tables, structs and strings.
+  using ::cpp17::AttackerT;
+  using ::cpp17::BookReader;
+  using ::cpp17::Character;
+  using ::cpp17::Movie;
+  using ::cpp17::MovieT;
+  using ::cpp17::Rapunzel;
+  auto attacker = [](int damage) {
+    auto* value = new AttackerT();
+    value->sword_attack_damage = damage;
+    return value;
+  };
+  MovieT movie;
+  movie.main_character.type = Character::MuLan;
+  movie.main_character.value = attacker(5);
+  movie.characters.resize(4);
+  movie.characters[0].type = Character::Rapunzel;
+  movie.characters[0].value = new Rapunzel(10);
+  movie.characters[1].type = Character::Other;
+  movie.characters[1].value = new std::string("x");
+  movie.characters[2].type = Character::Belle;
+  movie.characters[2].value = new BookReader(3);
+  movie.characters[3].type = Character::MuLan;
+  movie.characters[3].value = attacker(7);
+  flatbuffers::FlatBufferBuilder movie_fbb;
+  movie_fbb.Finish(Movie::Pack(movie_fbb, &movie));
+  const auto* packed =
+      flatbuffers::GetRoot<Movie>(movie_fbb.GetBufferPointer());
+  TEST_EQ_STR(flatbuffers::ToJson(*packed).c_str(),
+              "{\"main_character_type\":\"MuLan\","
+              "\"main_character\":{\"sword_attack_damage\":5},"
+              "\"characters_type\":[\"Rapunzel\",\"Other\",\"Belle\","
+              "\"MuLan\"],\"characters\":[{\"hair_length\":10},\"x\","
+              "{\"books_read\":3},{\"sword_attack_damage\":7}]}");
+
+  // The same movie, stored differently, is equal and hashes the same.
+  flatbuffers::FlatBufferBuilder other_fbb;
+  other_fbb.ForceDefaults(true);
+  other_fbb.CreateString("something before the movie");
+  other_fbb.Finish(Movie::Pack(other_fbb, &movie));
+  const auto* other = flatbuffers::GetRoot<Movie>(other_fbb.GetBufferPointer());
+  TEST_ASSERT(movie_fbb.GetSize() != other_fbb.GetSize());
+  TEST_ASSERT(flatbuffers::ObjectsEqual(*packed, *other));
+  TEST_EQ(flatbuffers::HashObject(*packed), flatbuffers::HashObject(*other));
+
+  // Any change to a value of a union is found.
+  movie.characters[3].AsMuLan()->sword_attack_damage = 8;
+  other_fbb.Clear();
+  other_fbb.Finish(Movie::Pack(other_fbb, &movie));
+  other = flatbuffers::GetRoot<Movie>(other_fbb.GetBufferPointer());
+  TEST_ASSERT(!flatbuffers::ObjectsEqual(*packed, *other));
+  TEST_NE(flatbuffers::HashObject(*packed), flatbuffers::HashObject(*other));
+  movie.characters[3].AsMuLan()->sword_attack_damage = 7;
+  *movie.characters[1].AsOther() = "y";
+  other_fbb.Clear();
+  other_fbb.Finish(Movie::Pack(other_fbb, &movie));
+  other = flatbuffers::GetRoot<Movie>(other_fbb.GetBufferPointer());
+  TEST_ASSERT(!flatbuffers::ObjectsEqual(*packed, *other));
+  TEST_NE(flatbuffers::HashObject(*packed), flatbuffers::HashObject(*other));
+}
+
 int FlatBufferCpp17Tests() {
   CreateTableByTypeTest();
   OptionalScalarsTest();
+  PmrObjectApiTest();
   StringifyAnyFlatbuffersTypeTest();
+  StaticReflectionVisitorsTest();
   return 0;
 }
 }  // namespace
@@ -0,0 +1,150 @@
+#include "delta_test.h"
+
+#include <string>
+#include <vector>
+
+#include "flatbuffers/delta.h"
+#include "flatbuffers/idl.h"
+#include "test_assert.h"
+
+namespace flatbuffers {
+namespace tests {
+
+namespace {
+
+const char* kSchema =
+    "namespace Delta;"
+    "struct Vec2 { x:float; y:float; }"
+    "table Item { name:string; count:int; }"
+    "table Tool { power:int; }"
+    "union Gear { Item, Tool }"
+    "table State {"
+    "  name:string;"
+    "  hp:int;"
+    "  pos:Vec2;"
+    "  scores:[int];"
+    "  path:[Vec2];"
+    "  tags:[string];"
+    "  items:[Item];"
+    "  gear:Gear;"
+    "  best:Item;"
+    "}"
+    "root_type State;";
+
+const char* kOldJson =
+    "{ name: \"state\", hp: 10, pos: { x: 1, y: 2 }, scores: [1, 2, 3],"
+    "  path: [{ x: 1, y: 1 }], tags: [\"x\", \"y\", \"z\"],"
+    "  items: [{ name: \"sword\", count: 1 }, { name: \"bow\", count: 2 }],"
+    "  gear_type: Item, gear: { name: \"ring\", count: 1 },"
+    "  best: { name: \"best\", count: 5 } }";
+
+// Scalars, structs and strings changed, vectors grown, shrunk and edited,
+// and the type of the union changed.
+const char* kNewJson =
+    "{ name: \"a new state\", hp: 11, pos: { x: 1, y: 3 },"
+    "  scores: [1, 5, 3, 4], path: [{ x: 1, y: 1 }, { x: 2, y: 2 }],"
+    "  tags: [\"x\", \"yy\"],"
+    "  items: [{ name: \"sword\", count: 3 }, { name: \"bow\", count: 2 },"
+    "          { name: \"axe\", count: 1 }],"
+    "  gear_type: Tool, gear: { power: 9 },"
+    "  best: { name: \"best\", count: 5 } }";
+
+// The count of the best item and of an item removed, so their tables are
+// copied, and the items shrunk.
+const char* kNewerJson =
+    "{ name: \"a new state\", hp: 12, pos: { x: 1, y: 3 },"
+    "  scores: [1, 5, 3, 4], path: [{ x: 1, y: 1 }, { x: 2, y: 2 }],"
+    "  tags: [\"x\", \"yy\"], items: [{ name: \"sword\" }],"
+    "  gear_type: Tool, gear: { power: 10 }, best: { name: \"best\" } }";
+
+std::vector<uint8_t> Build(Parser& parser, const char* json) {
+  parser.builder_.Clear();
+  TEST_EQ(parser.ParseJson(json), true);
+  return std::vector<uint8_t>(
+      parser.builder_.GetBufferPointer(),
+      parser.builder_.GetBufferPointer() + parser.builder_.GetSize());
+}
+
+std::string ToJson(const Parser& parser, const std::vector<uint8_t>& buf) {
+  std::string json;
+  TEST_NULL(GenText(parser, buf.data(), &json));
+  return json;
+}
+
+// Patches `flatbuf` with the delta from `old_buf` to `new_buf`, and checks
+// that it then has the contents of `new_buf`. Returns the size of the delta.
+size_t DiffAndPatch(const Parser& parser, const reflection::Schema& schema,
+                    const std::vector<uint8_t>& old_buf,
+                    const std::vector<uint8_t>& new_buf,
+                    std::vector<uint8_t>* flatbuf) {
+  std::vector<uint8_t> delta;
+  DiffFlatBuffers(schema, old_buf.data(), new_buf.data(), new_buf.size(),
+                  &delta);
+  TEST_EQ(PatchFlatBuffer(schema, delta.data(), delta.size(), flatbuf), true);
+  TEST_EQ(Verify(schema, *schema.root_table(), flatbuf->data(),
+                 flatbuf->size()),
+          true);
+  TEST_EQ_STR(ToJson(parser, *flatbuf).c_str(),
+              ToJson(parser, new_buf).c_str());
+  return delta.size();
+}
+
+}  // namespace
+
+void DeltaTest() {
+  Parser parser;
+  TEST_EQ(parser.Parse(kSchema), true);
+  parser.Serialize();
+  const std::string bfbs(
+      reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
+      parser.builder_.GetSize());
+  auto& schema = *reflection::GetSchema(bfbs.c_str());
+
+  const std::vector<uint8_t> old_buf = Build(parser, kOldJson);
+  const std::vector<uint8_t> new_buf = Build(parser, kNewJson);
+  const std::vector<uint8_t> newer_buf = Build(parser, kNewerJson);
+
+  // Nothing changed: just the end of the root table.
+  std::vector<uint8_t> flatbuf = old_buf;
+  TEST_EQ(DiffAndPatch(parser, schema, old_buf, old_buf, &flatbuf), 2u);
+  TEST_EQ(flatbuf == old_buf, true);
+
+  // Patched in place, the delta is smaller than the new buffer.
+  TEST_EQ(DiffAndPatch(parser, schema, old_buf, new_buf, &flatbuf) <
+              new_buf.size(),
+          true);
+
+  // A patched buffer can be patched further, with a delta computed from the
+  // buffer it has the contents of.
+  DiffAndPatch(parser, schema, new_buf, newer_buf, &flatbuf);
+
+  // A vector grown that is followed by the vtable of its element, which
+  // moves along with the element.
+  const std::vector<uint8_t> one_item =
+      Build(parser, "{ items: [{ name: \"n\", count: 2 }] }");
+  const std::vector<uint8_t> two_items =
+      Build(parser, "{ items: [{ name: \"n\", count: 2 }, { name: \"m\" }] }");
+  flatbuf = one_item;
+  DiffAndPatch(parser, schema, one_item, two_items, &flatbuf);
+
+  // A field of the root table added: the delta holds the new buffer.
+  const std::vector<uint8_t> no_hp = Build(parser, "{ name: \"state\" }");
+  const std::vector<uint8_t> hp = Build(parser, "{ name: \"state\", hp: 1 }");
+  flatbuf = no_hp;
+  TEST_EQ(DiffAndPatch(parser, schema, no_hp, hp, &flatbuf), hp.size() + 1);
+  TEST_EQ(flatbuf == hp, true);
+
+  // Deltas that don't fit the buffer are refused.
+  std::vector<uint8_t> delta;
+  DiffFlatBuffers(schema, old_buf.data(), new_buf.data(), new_buf.size(),
+                  &delta);
+  flatbuf = old_buf;
+  TEST_EQ(PatchFlatBuffer(schema, delta.data(), delta.size() - 1, &flatbuf),
+          false);
+  flatbuf = no_hp;
+  TEST_EQ(PatchFlatBuffer(schema, delta.data(), delta.size(), &flatbuf),
+          false);
+}
+
+}  // namespace tests
+}  // namespace flatbuffers
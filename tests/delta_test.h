@@ -0,0 +1,12 @@
+#ifndef TESTS_DELTA_TEST_H
+#define TESTS_DELTA_TEST_H
+
+namespace flatbuffers {
+namespace tests {
+
+void DeltaTest();
+
+}  // namespace tests
+}  // namespace flatbuffers
+
+#endif
@@ -0,0 +1,164 @@
+// Checks that a fixed-capacity FlatBufferBuilder never allocates. This is a
+// separate test binary, as it replaces the global operator new and delete to
+// count the allocations made, which would affect every other test.
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "flatbuffers/flatbuffer_builder.h"
+#include "fixed_builder_test_generated.h"
+#include "test_assert.h"
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+  void* p = operator new(size, std::nothrow);
+  if (!p) abort();  // No exceptions, so there is no std::bad_alloc to throw.
+  return p;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  allocations++;
+  return malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return operator new(size, std::nothrow);
+}
+
+void operator delete(void* p) noexcept { free(p); }
+
+void operator delete[](void* p) noexcept { free(p); }
+
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+void operator delete(void* p, const std::nothrow_t&) noexcept { free(p); }
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept { free(p); }
+
+namespace flatbuffers {
+namespace tests {
+
+using namespace FixedBuilder;
+
+namespace {
+
+// Builds a monster with a few children, without allocating itself.
+void BuildMonster(FlatBufferBuilder& builder) {
+  const char* const names[] = { "Fred", "Barney", "Wilma", "Fred", "Barney" };
+  Offset<Monster> children[5];
+  for (int i = 0; i < 5; ++i) {
+    const auto name = builder.CreateSharedString(names[i]);
+    const uint8_t inventory[] = { 0, 1, 2, static_cast<uint8_t>(i) };
+    const auto inventory_offset = builder.CreateVector(inventory, 4);
+    const Test tests[] = { Test(10, 20), Test(30, static_cast<int8_t>(i)) };
+    const auto tests_offset = builder.CreateVectorOfStructs(tests, 2);
+    children[i] = CreateMonster(builder, nullptr, name, 150, inventory_offset,
+                                Color_Green, tests_offset);
+  }
+  const auto children_offset = builder.CreateVector(children, 5);
+  const auto name = builder.CreateSharedString("Fred");
+  const Vec3 pos(1, 2, 3, Color_Red, Test(10, 20));
+  MonsterBuilder monster(builder);
+  monster.add_pos(&pos);
+  monster.add_name(name);
+  monster.add_children(children_offset);
+  FinishMonsterBuffer(builder, monster.Finish());
+}
+
+bool Verify(const flatbuffers::span<uint8_t>& buffer) {
+  Verifier verifier(buffer.data(), buffer.size());
+  return VerifyMonsterBuffer(verifier);
+}
+
+void FixedBuilderTest() {
+  // The same message built with a regular builder, to compare against.
+  FlatBufferBuilder heap_builder;
+  BuildMonster(heap_builder);
+  const flatbuffers::span<uint8_t> expected = heap_builder.GetBufferSpan();
+
+  alignas(8) uint8_t memory[1024];
+  {
+    const size_t allocations_before = allocations;
+    FlatBufferBuilder builder(flatbuffers::span<uint8_t>(memory, 1024), 8);
+    BuildMonster(builder);
+    TEST_EQ(allocations, allocations_before);
+    TEST_ASSERT(!builder.HasOverflowed());
+
+    // The message ends at the end of `memory` and is the same as the one
+    // built on the heap, shared strings included.
+    const flatbuffers::span<uint8_t> buffer = builder.GetBufferSpan();
+    TEST_EQ(buffer.data() + buffer.size(), memory + 1024);
+    TEST_EQ(buffer.size(), expected.size());
+    TEST_EQ(memcmp(buffer.data(), expected.data(), expected.size()), 0);
+    TEST_ASSERT(Verify(buffer));
+    const auto children = GetMonster(buffer.data())->children();
+    TEST_EQ(children->Get(0)->name(), children->Get(3)->name());
+    TEST_EQ(children->Get(1)->name(), children->Get(4)->name());
+
+    // A builder can be reused for the next message after Clear().
+    builder.Clear();
+    BuildMonster(builder);
+    TEST_EQ(allocations, allocations_before);
+    TEST_ASSERT(Verify(builder.GetBufferSpan()));
+  }
+
+  // Without a string pool, strings aren't shared but still created.
+  {
+    FlatBufferBuilder builder(flatbuffers::span<uint8_t>(memory, 1024));
+    BuildMonster(builder);
+    TEST_ASSERT(!builder.HasOverflowed());
+    TEST_ASSERT(builder.GetSize() > expected.size());
+    TEST_ASSERT(Verify(builder.GetBufferSpan()));
+  }
+
+  // A buffer that is too small makes the builder overflow instead of grow.
+  for (size_t size = 0; size < expected.size(); size += 61) {
+    const size_t allocations_before = allocations;
+    FlatBufferBuilder builder(flatbuffers::span<uint8_t>(memory, size), 8);
+    BuildMonster(builder);
+    TEST_EQ(allocations, allocations_before);
+    TEST_ASSERT(builder.HasOverflowed());
+    TEST_ASSERT(builder.GetSize() > size);
+    TEST_EQ(builder.GetBufferSpan().size(), 0);
+
+    // Nothing is stored anymore, but all of the API can still be used.
+    uint8_t* data = memory;
+    builder.CreateUninitializedVector(16, 1, 1, &data);
+    TEST_ASSERT(data == nullptr);
+    const char* const strings[] = { "a", "b" };
+    builder.CreateVectorOfStrings(strings, strings + 2);
+    const Test tests[] = { Test(1, 2) };
+    builder.CreateVectorOfStructs(tests, 1);
+    Offset<Monster> monsters[] = { CreateMonster(builder) };
+    builder.CreateVectorOfSortedTables(monsters, 1);
+    TEST_ASSERT(builder.HasOverflowed());
+
+    // Until it is cleared.
+    builder.Clear();
+    TEST_ASSERT(!builder.HasOverflowed());
+    TEST_EQ(builder.GetSize(), 0);
+  }
+}
+
+}  // namespace
+}  // namespace tests
+}  // namespace flatbuffers
+
+int main(int /*argc*/, const char* /*argv*/[]) {
+  InitTestEngine();
+
+  flatbuffers::tests::FixedBuilderTest();
+
+  if (!testing_fails) {
+    TEST_OUTPUT_LINE("Fixed builder: ALL TESTS PASSED");
+  } else {
+    TEST_OUTPUT_LINE("Fixed builder: %d FAILED TESTS", testing_fails);
+  }
+  return CloseTestEngine();
+}
@@ -259,3 +259,57 @@ class CppTests:
         ],
         unlink=False,
     )
+
+  def StaticVTables(self):
+    flatc([
+        "--cpp",
+        "--cpp-static-vtables",
+        "-o",
+        ".tmp",
+        "../static_vtables_test.fbs",
+    ])
+
+    # Tables that may have a field absent (an optional scalar, or an offset
+    # that isn't required and so may be null) get no static vtable, and the
+    # required offsets are checked.
+    assert_file_and_contents(
+        ".tmp/static_vtables_test_generated.h",
+        [
+            "CreateItemWithStaticVTable(",
+            "CreateInventoryWithStaticVTable(",
+            "FLATBUFFERS_ASSERT(!tags.IsNull());",
+        ],
+        doesnt_contain=[
+            "CreateLimitsWithStaticVTable(",
+            "CreateNoteWithStaticVTable(",
+        ],
+    )
+
+  def PackedSizeUpperBound(self):
+    flatc([
+        "--cpp",
+        "--gen-object-api",
+        "--gen-packed-size",
+        "-o",
+        ".tmp",
+        "packed_size.fbs",
+    ])
+
+    # Tables that may contain a table with a native_type (which user code
+    # packs) get no PackedSizeUpperBound(), and Pack() doesn't reserve space.
+    assert_file_and_contents(
+        ".tmp/packed_size_generated.h",
+        [
+            "size_t PackedSizeUpperBound(const PlainT &_o)",
+            "size_t PackedSizeUpperBound(const TreeT &_o)",
+            "size_t AnyPlainUnion::PackedSizeUpperBound() const",
+            "_fbb.Reserve(PackedSizeUpperBound(*_o));",
+        ],
+        doesnt_contain=[
+            "PackedSizeUpperBound(const MyCustom &_o)",
+            "PackedSizeUpperBound(const HasCustomT &_o)",
+            "PackedSizeUpperBound(const HasAnyCustomT &_o)",
+            "PackedSizeUpperBound(const HasHasCustomT &_o)",
+            "AnyCustomUnion::PackedSizeUpperBound",
+        ],
+    )
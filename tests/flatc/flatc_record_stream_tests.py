@@ -0,0 +1,52 @@
+# Copyright 2025 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+from flatc_test import *
+
+
+class RecordStreamTests:
+
+  def RecordStreamConvertAndDump(self):
+    # A log of size prefixed buffers, one after the other.
+    log = b""
+    for i in range(1, 4):
+      record_json = Path(script_path, "record.json")
+      record_json.write_text('{ id: %d, name: "record %d" }' % (i, i))
+      flatc(["--binary", "--size-prefixed", "record_stream.fbs", "record.json"])
+      record_json.unlink()
+      log += assert_file_exists("record.bin").read_bytes()
+    Path(script_path, "record.bin").unlink()
+    Path(script_path, "record_log.bin").write_bytes(log)
+
+    # Converted to a record stream, with a header and an index.
+    flatc(["--binary", "--record-stream", "record_stream.fbs", "--",
+           "record_log.bin"])
+    Path(script_path, "record_log.bin").unlink()
+    stream = assert_file_exists("record_log.fbrs").read_bytes()
+    assert stream[:4] == b"FBRS"
+    assert stream[-4:] == b"FBRI"
+
+    # Which is dumped as one JSON object per record.
+    flatc(["--json", "--strict-json", "--record-stream", "record_stream.fbs",
+           "--", "record_log.fbrs"])
+    Path(script_path, "record_log.fbrs").unlink()
+    text = get_file_contents("record_log.json").strip()
+    Path(script_path, "record_log.json").unlink()
+    records = []
+    while text:
+      record, end = json.JSONDecoder().raw_decode(text)
+      records.append(record)
+      text = text[end:].strip()
+    assert records == [{"id": i, "name": "record %d" % i} for i in range(1, 4)]
@@ -79,4 +79,24 @@ class SchemaTests:
     except subprocess.CalledProcessError:
       pass
     
-    flatc(["-c", "circular_table.fbs"])
\ No newline at end of file
+    flatc(["-c", "circular_table.fbs"])
+
+  def LayoutReport(self):
+    flatc(["--layout-report", "layout_report.fbs"])
+
+    assert_file_and_contents(
+        "layout_report.layout.txt",
+        [
+            # Structs are frozen, so reordering is only a note.
+            "struct LayoutReport.Padded",
+            "padding: 14 bytes (58%)",
+            "would make it 16 bytes, but that changes the wire format",
+            # Tables can have their inline fields reordered.
+            "table LayoutReport.Ordered",
+            "inline size: 4 to 48 bytes, 7 bytes of padding",
+            "removing (original_order) would save up to 4 bytes",
+            # Only deprecated fields before a live field cost vtable space.
+            "fields: 4 (2 deprecated)",
+            "vtable that has a later field: `b`\n",
+        ],
+    )
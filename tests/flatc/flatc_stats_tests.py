@@ -0,0 +1,73 @@
+# Copyright 2025 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+import subprocess
+from flatc_test import *
+
+annotated_binary_path = Path(root_path, "tests", "annotated_binary")
+
+
+def flatc_stats(options):
+  cmd = [str(flatc_path)] + options
+  return subprocess.check_output(cmd, cwd=str(annotated_binary_path)).decode()
+
+
+class StatsTests:
+
+  def StatsJson(self):
+    stats = json.loads(
+        flatc_stats([
+            "--stats",
+            "annotated_binary.fbs",
+            "--",
+            "annotated_binary.bin",
+            "annotated_binary.bin",
+        ])
+    )
+
+    binary_size = Path(annotated_binary_path, "annotated_binary.bin").stat()
+    assert stats["files"]["count"] == 2
+    assert stats["files"]["bytes"] == 2 * binary_size.st_size
+    assert stats["errors"] == 0
+
+    # Sections never overlap, so they can't add up to more than the binaries.
+    assert (
+        sum(s["bytes"] for s in stats["sections"].values())
+        <= stats["files"]["bytes"]
+    )
+
+    # The root table is a Foo, and some of its vtables are shared.
+    foo = stats["tables"]["AnnotatedBinary.Foo"]
+    assert foo["instances"]["count"] == 2
+    assert stats["vtable_dedup_ratio"] > 1
+    assert stats["vtable_bytes_saved"] > 0
+
+    # `Foo.name` is a string set in both binaries, counted once each with its
+    # offset and string bytes.
+    name = stats["fields"]["AnnotatedBinary.Foo.name"]
+    assert name["count"] == 2
+    assert name["bytes"] > 2 * 4
+
+  def StatsCsv(self):
+    rows = flatc_stats([
+        "--stats",
+        "annotated_binary.fbs",
+        "--stats-csv",
+        "--",
+        "annotated_binary.bin",
+    ]).splitlines()
+
+    assert rows[0] == "category,name,count,bytes"
+    assert "table,AnnotatedBinary.Foo,1," in "\n".join(rows)
@@ -0,0 +1,99 @@
+# Copyright 2025 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+import shutil
+from flatc_test import *
+
+
+def build_v1_record(i, size_prefixed=False):
+  record_json = Path(script_path, "transcode_record.json")
+  record_json.write_text(
+      '{ id: %d, name: "record %d", legacy: "old" }' % (i, i)
+  )
+  flatc(
+      ["--binary", "transcode_v1.fbs", "transcode_record.json"]
+      + (["--size-prefixed"] if size_prefixed else [])
+  )
+  record_json.unlink()
+  record_bin = assert_file_exists("transcode_record.bin")
+  return record_bin
+
+
+class TranscodeTests:
+
+  def TranscodeBinary(self):
+    build_v1_record(7)
+    flatc([
+        "-o", "transcoded", "--transcode-from", "transcode_v1.fbs",
+        "--transcode-mapping", "transcode_mapping.txt", "transcode_v2.fbs",
+        "--", "transcode_record.bin",
+    ])
+    Path(script_path, "transcode_record.bin").unlink()
+    assert_file_exists("transcoded/transcode_record.bin")
+
+    flatc([
+        "--json", "--strict-json", "-o", "transcoded", "transcode_v2.fbs",
+        "--", "transcoded/transcode_record.bin",
+    ])
+    record = json.loads(get_file_contents("transcoded/transcode_record.json"))
+    shutil.rmtree(Path(script_path, "transcoded"))
+    assert record == {"title": "record 7", "id": 7}
+
+  def TranscodeRecordStream(self):
+    log = b""
+    for i in range(1, 4):
+      log += build_v1_record(i, size_prefixed=True).read_bytes()
+    Path(script_path, "transcode_record.bin").unlink()
+    Path(script_path, "transcode_log.bin").write_bytes(log)
+
+    flatc([
+        "--record-stream", "--transcode-from", "transcode_v1.fbs",
+        "--transcode-mapping", "transcode_mapping.txt", "transcode_v2.fbs",
+        "--", "transcode_log.bin",
+    ])
+    Path(script_path, "transcode_log.bin").unlink()
+    assert_file_exists("transcode_log.fbrs")
+
+    flatc([
+        "--json", "--strict-json", "--record-stream", "transcode_v2.fbs",
+        "--", "transcode_log.fbrs",
+    ])
+    Path(script_path, "transcode_log.fbrs").unlink()
+    text = get_file_contents("transcode_log.json").strip()
+    Path(script_path, "transcode_log.json").unlink()
+    records = []
+    while text:
+      record, end = json.JSONDecoder().raw_decode(text)
+      records.append(record)
+      text = text[end:].strip()
+    assert records == [
+        {"title": "record %d" % i, "id": i} for i in range(1, 4)
+    ]
+
+  def TranscodeLossy(self):
+    # Conversions that would lose values are refused.
+    Path(script_path, "transcode_narrow.fbs").write_text(
+        "table Record { id:byte; } root_type Record;"
+    )
+    try:
+      flatc([
+          "--raw-binary", "--transcode-from", "transcode_v1.fbs",
+          "transcode_narrow.fbs", "--", "transcode_v1.fbs",
+      ])
+      assert False, "narrowing should have failed"
+    except subprocess.CalledProcessError:
+      pass
+    finally:
+      Path(script_path, "transcode_narrow.fbs").unlink()
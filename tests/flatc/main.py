@@ -18,11 +18,22 @@ import sys
 
 from flatc_cpp_tests import CppTests
 from flatc_kotlin_tests import KotlinTests
+from flatc_record_stream_tests import RecordStreamTests
 from flatc_schema_tests import SchemaTests
+from flatc_stats_tests import StatsTests
 from flatc_test import run_all
+from flatc_transcode_tests import TranscodeTests
 from flatc_ts_tests import TsTests
 
-passing, failing = run_all(CppTests, KotlinTests, TsTests, SchemaTests)
+passing, failing = run_all(
+    CppTests,
+    KotlinTests,
+    TsTests,
+    SchemaTests,
+    StatsTests,
+    RecordStreamTests,
+    TranscodeTests,
+)
 
 print("")
 print("{0} of {1} tests passed".format(passing, passing + failing))
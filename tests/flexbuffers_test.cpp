@@ -3,6 +3,7 @@
 #include <memory>
 #include <limits>
 
+#include "flatbuffers/flex_json.h"
 #include "flatbuffers/flexbuffers.h"
 #include "flatbuffers/idl.h"
 #include "is_quiet_nan.h"
@@ -187,6 +188,75 @@ void FlexBuffersReuseBugTest() {
           true);
 }
 
+void FlexBuffersReuseTrackerTest() {
+  // Many references to the same keys and strings.
+  flexbuffers::Builder slb(512, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+  slb.Vector([&]() {
+    for (int i = 0; i < 1000; ++i) {
+      slb.Map([&]() {
+        slb.String("name", "shared string");
+        slb.String("unique", "a string that is not shared " +
+                                 flatbuffers::NumToString(i));
+        slb.Int("id", i);
+        slb.Vector("empty", [&]() {});
+        slb.Bool("bool", true);
+      });
+    }
+  });
+  slb.Finish();
+  const auto& buf = slb.GetBuffer();
+
+  // Skipping a shared string used to leak nesting depth, failing after 64.
+  std::vector<uint8_t> dense_tracker;
+  TEST_EQ(flexbuffers::VerifyBuffer(buf.data(), buf.size(), &dense_tracker),
+          true);
+
+  flexbuffers::ReuseTracker tracker;
+  TEST_EQ(flexbuffers::VerifyBuffer(buf.data(), buf.size(), tracker), true);
+  // Takes far less than the one byte per buffer byte of the dense tracker.
+  const auto memory_usage = tracker.memory_usage();
+  TEST_ASSERT(memory_usage < buf.size() / 4);
+  // Reusing it doesn't need more memory.
+  TEST_EQ(flexbuffers::VerifyBuffer(buf.data(), buf.size(), tracker), true);
+  TEST_EQ(tracker.memory_usage(), memory_usage);
+
+  // Same as the dense tracker on the buffer of FlexBuffersReuseBugTest.
+  flexbuffers::Builder small;
+  small.Map([&]() {
+    small.Vector("vec", [&]() {});
+    small.Bool("bool", true);
+  });
+  small.Finish();
+  TEST_EQ(flexbuffers::VerifyBuffer(small.GetBuffer().data(),
+                                    small.GetBuffer().size(), tracker),
+          true);
+
+  // The type of an offset is recorded on its second visit, after which an
+  // offset seen as another type is rejected.
+  const auto key = flexbuffers::PackedType(flexbuffers::BIT_WIDTH_8,
+                                           flexbuffers::FBT_KEY);
+  const auto string = flexbuffers::PackedType(flexbuffers::BIT_WIDTH_8,
+                                              flexbuffers::FBT_STRING);
+  tracker.Reset(1 << 16);
+  TEST_EQ(tracker.Insert(8, key), 0);
+  TEST_EQ(tracker.Insert(8, key), 0);
+  TEST_EQ(tracker.Insert(8, key), key);
+  TEST_EQ(tracker.Insert(8, string), key);
+  // Also once it is no longer one of the recent ones.
+  for (size_t offset = 72; offset < (1 << 16); offset += 64) {
+    TEST_EQ(tracker.Insert(offset, string), 0);
+    TEST_EQ(tracker.Insert(offset, string), 0);
+  }
+  TEST_EQ(tracker.Insert(8, string), key);
+  for (size_t offset = 72; offset < (1 << 16); offset += 64) {
+    TEST_EQ(tracker.Insert(offset, string), string);
+  }
+  tracker.Reset(16);
+  TEST_EQ(tracker.Insert(8, string), 0);
+  TEST_EQ(tracker.Insert(8, string), 0);
+  TEST_EQ(tracker.Insert(8, string), string);
+}
+
 void FlexBuffersFloatingPointTest() {
 #if defined(FLATBUFFERS_HAS_NEW_STRTOD) && (FLATBUFFERS_HAS_NEW_STRTOD > 0)
   flexbuffers::Builder slb(512,
@@ -314,5 +384,209 @@ void ParseFlexbuffersFromJsonWithNullTest() {
   }
 }
 
+void FlexBuffersJsonParserTest() {
+  // Strict JSON parses to the same FlexBuffer as with the IDL parser, with
+  // the escapes and numbers at all offsets in the blocks of the first pass.
+  std::string json = "{\"name\": \"caf\u00e9 \\\"\\u00e9\\ud83d\\ude00\\n\",";
+  json += " \"empty\": {}, \"none\": [], \"nothing\": null, \"items\": [";
+  for (int i = 0; i < 100; i++) {
+    if (i) json += i % 7 ? "," : ",\n";
+    json += "{\"id\":" + NumToString(i - 50) + ",\"x\":" +
+            NumToString(i * 0.3125) + ",\"s\":\"" + std::string(i, 'a') +
+            (i % 3 ? "\\\\" : "\\\"") + "\",\"ok\":" +
+            (i % 2 ? "true" : "false") + "}";
+  }
+  json +=
+      "], \"numbers\": [0, -0, 1.5e3, -2.25E-2, 0.1, 1e22, 123456789.123456789,"
+      " 9007199254740993.0, 1.7976931348623157e308, 5e-324, "
+      "-9223372036854775807]}";
+  for (int flags = 0; flags <= flexbuffers::BUILDER_FLAG_SHARE_ALL; flags++) {
+    const auto builder_flags = static_cast<flexbuffers::BuilderFlag>(flags);
+    flexbuffers::Builder expected(512, builder_flags);
+    flatbuffers::Parser parser;
+    TEST_EQ(parser.ParseFlexBuffer(json.c_str(), nullptr, &expected), true);
+    flexbuffers::Builder fbb(512, builder_flags);
+    flexbuffers::JsonParser json_parser;
+    TEST_EQ(json_parser.Parse(json.c_str(), &fbb), true);
+    TEST_EQ_STR(json_parser.error().c_str(), "");
+    TEST_ASSERT(fbb.GetBuffer() == expected.GetBuffer());
+  }
+
+  flexbuffers::JsonParser json_parser;
+  flexbuffers::Builder fbb;
+  TEST_EQ(json_parser.Parse("  [\"\\u00e9\u00e9\", 9223372036854775807, "
+                            "18446744073709551615, -9223372036854775808, "
+                            "12345678901234567890123]\n",
+                            &fbb),
+          true);
+  auto root = flexbuffers::GetRoot(fbb.GetBuffer()).AsVector();
+  TEST_EQ_STR(root[0].AsString().c_str(), "\u00e9\u00e9");
+  TEST_EQ(root[1].AsInt64(), (std::numeric_limits<int64_t>::max)());
+  TEST_EQ(root[2].IsUInt(), true);
+  TEST_EQ(root[2].AsUInt64(), (std::numeric_limits<uint64_t>::max)());
+  TEST_EQ(root[3].AsInt64(), (std::numeric_limits<int64_t>::min)());
+  TEST_EQ(root[4].AsDouble(), 12345678901234567890123.0);
+
+  const char* const invalid[] = {
+    "",
+    " ",
+    "{",
+    "[1,]",
+    "[1 2]",
+    "1 2",
+    "{a: 1}",
+    "{\"a\" 1}",
+    "{\"a\": 1,}",
+    "{\"a\": 1, \"a\": 2}",
+    "01",
+    "1.",
+    "-",
+    "1e",
+    "1x",
+    "tru",
+    "truex",
+    "nan",
+    "inf",
+    "\"abc",
+    "\"\\x\"",
+    "\"\\u12\"",
+    "\"\\ud800\"",
+    "\"\\udc00\"",
+    "\"a\tb\"",
+    "\"\xff\"",
+    "\"\xc3\"",
+    "/* comment */ 1",
+  };
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(*invalid); i++) {
+    TEST_EQ(json_parser.Parse(invalid[i], &fbb), false);
+    TEST_EQ(json_parser.error().empty(), false);
+  }
+  TEST_EQ(json_parser.Parse("{\n  \"a\" 1}", &fbb), false);
+  TEST_EQ_STR(json_parser.error().c_str(), "2:7: expected ':'");
+  TEST_EQ(json_parser.Parse(std::string(100, '[').c_str(), &fbb), false);
+  // A failed parse leaves the builder cleared for the next one.
+  TEST_EQ(json_parser.Parse("{\"a\": [1, 2.5]}", &fbb), true);
+  TEST_EQ(flexbuffers::GetRoot(fbb.GetBuffer()).ToString(),
+          std::string("{ a: [ 1, 2.5 ] }"));
+}
+
+void FlexBuffersStreamedTest() {
+  // Streamed vectors and maps come out the same as built on the stack, where
+  // the widths agree.
+  flexbuffers::Builder expected, fbb;
+  expected.Vector([&]() {
+    expected.TypedVector([&]() {
+      for (int i = 0; i < 1000; i++) expected.Int((i - 500) * 60);
+    });
+    expected.TypedVector([&]() {
+      for (int i = 0; i < 300; i++) expected.UInt(static_cast<uint8_t>(i));
+    });
+    expected.TypedVector([&]() {
+      for (int i = 0; i < 10; i++) expected.Double(i * 0.1);
+    });
+    expected.TypedVector([&]() {
+      for (int i = 0; i < 3; i++) expected.Bool(i == 1);
+    });
+    expected.Map([&]() {
+      expected.Int("a", 1);
+      expected.Int("b", -2);
+      expected.Int("c", 300);
+    });
+  });
+  expected.Finish();
+
+  const char* const keys[] = { "a", "b", "c" };
+  auto start = fbb.StartVector();
+  auto ints = fbb.StartStreamedVector<int64_t>(1000, flexbuffers::BIT_WIDTH_16);
+  for (int i = 0; i < 1000; i++) fbb.StreamedElement<int64_t>((i - 500) * 60);
+  fbb.EndStreamedVector(ints);
+  // 300 elements take a 16 bit size, and so 16 bit elements.
+  auto bytes = fbb.StartStreamedVector<uint8_t>(300);
+  for (int i = 0; i < 300; i++) fbb.StreamedElement(static_cast<uint8_t>(i));
+  fbb.EndStreamedVector(bytes);
+  auto doubles = fbb.StartStreamedVector<double>(10);
+  for (int i = 0; i < 10; i++) fbb.StreamedElement(i * 0.1);
+  fbb.EndStreamedVector(doubles);
+  auto bools = fbb.StartStreamedVector<bool>(3);
+  for (int i = 0; i < 3; i++) fbb.StreamedElement(i == 1);
+  fbb.EndStreamedVector(bools);
+  auto map = fbb.StartStreamedMap<int16_t>(keys, 3);
+  fbb.StreamedElement<int16_t>(1);
+  fbb.StreamedElement<int16_t>(-2);
+  fbb.StreamedElement<int16_t>(300);
+  fbb.EndStreamedMap(map);
+  fbb.EndVector(start, false, false);
+  fbb.Finish();
+  TEST_ASSERT(fbb.GetBuffer() == expected.GetBuffer());
+
+  // In a map, with a key, and floats narrowed to 32 bits.
+  fbb.Clear();
+  start = fbb.StartMap();
+  auto floats = fbb.StartStreamedVector<double>("floats", 4,
+                                                flexbuffers::BIT_WIDTH_32);
+  for (int i = 0; i < 4; i++) fbb.StreamedElement(i + 0.25);
+  fbb.EndStreamedVector(floats);
+  map = fbb.StartStreamedMap<uint64_t>("map", keys, 3);
+  for (int i = 0; i < 3; i++) fbb.StreamedElement<uint64_t>(1ULL << (i * 20));
+  fbb.EndStreamedMap(map);
+  fbb.Int("x", 7);
+  fbb.EndStreamedVector(fbb.StartStreamedVector<int32_t>("empty", 0));
+  fbb.EndMap(start);
+  fbb.Finish();
+  TEST_EQ(fbb.HasDuplicateKeys(), false);
+  TEST_EQ(flexbuffers::VerifyBuffer(fbb.GetBuffer().data(),
+                                    fbb.GetBuffer().size()),
+          true);
+  auto root_ref = flexbuffers::GetRoot(fbb.GetBuffer());
+  auto root = root_ref.AsMap();
+  auto floats_vec = root["floats"].AsTypedVector();
+  TEST_EQ(floats_vec.ElementType(), flexbuffers::FBT_FLOAT);
+  TEST_EQ(floats_vec.size(), 4);
+  TEST_EQ(floats_vec[3].AsDouble(), 3.25);
+  TEST_EQ(root["map"].AsMap()["c"].AsUInt64(), 1ULL << 40);
+  TEST_EQ(root["x"].AsInt64(), 7);
+  TEST_EQ(root["empty"].AsTypedVector().size(), 0);
+  TEST_EQ(root_ref.ToString(),
+          std::string("{ empty: [  ], floats: [ 0.25, 1.25, 2.25, 3.25 ], "
+                      "map: { a: 1, b: 1048576, c: 1099511627776 }, x: 7 }"));
+}
+
+void FlexBuffersReleaseTest() {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.String("name", "released");
+    fbb.Vector("values", [&]() {
+      for (int i = 0; i < 100; i++) fbb.Int(i * 1000);
+    });
+  });
+  fbb.Finish();
+  const std::vector<uint8_t> expected = fbb.GetBuffer();
+  const uint8_t* data = fbb.GetBuffer().data();
+
+  // The DetachedBuffer takes over the memory of the builder.
+  flatbuffers::DetachedBuffer released = fbb.Release();
+  TEST_EQ(released.data(), data);
+  TEST_EQ(released.size(), expected.size());
+  TEST_EQ(memcmp(released.data(), expected.data(), expected.size()), 0);
+  TEST_EQ(fbb.GetSize(), 0);
+  flatbuffers::DetachedBuffer moved = std::move(released);
+  TEST_EQ(flexbuffers::VerifyBuffer(moved.data(), moved.size()), true);
+  auto map = flexbuffers::GetRoot(moved.data(), moved.size()).AsMap();
+  TEST_EQ_STR(map["name"].AsString().c_str(), "released");
+  TEST_EQ(map["values"].AsVector()[99].AsInt64(), 99000);
+
+  // The builder can be reused after that, and so can a released vector.
+  fbb.Int(42);
+  fbb.Finish();
+  std::vector<uint8_t> buffer = fbb.ReleaseVector();
+  TEST_EQ(flexbuffers::GetRoot(buffer).AsInt64(), 42);
+  const uint8_t* buffer_data = buffer.data();
+  flexbuffers::Builder reused(std::move(buffer));
+  reused.Int(7);
+  reused.Finish();
+  TEST_EQ(reused.GetBuffer().data(), buffer_data);
+  TEST_EQ(flexbuffers::GetRoot(reused.GetBuffer()).AsInt64(), 7);
+}
+
 }  // namespace tests
 }  // namespace flatbuffers
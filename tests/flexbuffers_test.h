@@ -6,9 +6,13 @@ namespace tests {
 
 void FlexBuffersTest();
 void FlexBuffersReuseBugTest();
+void FlexBuffersReuseTrackerTest();
 void FlexBuffersFloatingPointTest();
 void FlexBuffersDeprecatedTest();
 void ParseFlexbuffersFromJsonWithNullTest();
+void FlexBuffersJsonParserTest();
+void FlexBuffersStreamedTest();
+void FlexBuffersReleaseTest();
 
 }  // namespace tests
 }  // namespace flatbuffers
@@ -549,6 +549,155 @@ void ObjectFlatBuffersTest(uint8_t* flatbuf) {
   CheckMonsterObject(&monster3);
 }
 
+namespace {
+struct CountingAllocator : public flatbuffers::DefaultAllocator {
+  uint8_t* allocate(size_t size) override {
+    allocations++;
+    return DefaultAllocator::allocate(size);
+  }
+  int allocations = 0;
+};
+}  // namespace
+
+void PackedSizeUpperBoundTest(uint8_t* flatbuf) {
+  auto monster = UnPackMonster(flatbuf);
+  // Enough nested data that packing into a small buffer has to grow it.
+  for (int i = 0; i < 100; i++) {
+    std::unique_ptr<MonsterT> child(new MonsterT());
+    child->name = "child" + NumToString(i);
+    child->inventory.assign(static_cast<size_t>(i), 7);
+    child->testarrayofstring.assign(
+        3, std::string(static_cast<size_t>(i), 'x'));
+    monster->testarrayoftables.push_back(std::move(child));
+  }
+  const size_t bound = PackedSizeUpperBound(*monster);
+
+  // Pack() sizes a fresh builder up front, so it never reallocates.
+  CountingAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(64, &allocator);
+  fbb.Finish(CreateMonster(fbb, monster.get()), MonsterIdentifier());
+  TEST_EQ(allocator.allocations, 1);
+  TEST_ASSERT(fbb.GetSize() <= bound);
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_ASSERT(VerifyMonsterBuffer(verifier));
+
+  // It produces the same bytes as a builder that grows as it goes (which one
+  // that has allocated before does).
+  flatbuffers::FlatBufferBuilder grown(64);
+  grown.CreateString("warm up");
+  grown.Clear();
+  grown.Finish(CreateMonster(grown, monster.get()), MonsterIdentifier());
+  TEST_EQ(grown.GetSize(), fbb.GetSize());
+  TEST_EQ(memcmp(grown.GetBufferPointer(), fbb.GetBufferPointer(),
+                 fbb.GetSize()),
+          0);
+  auto packed = GetMonster(fbb.GetBufferPointer());
+  auto child = packed->testarrayoftables()->LookupByKey("child99");
+  TEST_NOTNULL(child);
+  TEST_EQ(child->testarrayofstring()->Get(2)->size(), 99u);
+}
+
+void ObjectVectorCopyTest() {
+  MonsterT monster;
+  monster.name = "Vectors";
+  for (int i = 0; i < 1000; i++) {
+    monster.vector_of_longs.push_back(-1000000007LL * i);
+    monster.vector_of_doubles.push_back(0.25 * i);
+    monster.vector_of_enums.push_back(i % 2 ? Color_Blue : Color_Green);
+    monster.test4.push_back(Test(static_cast<int16_t>(-i), 7));
+    monster.testarrayofbools.push_back(i % 3 == 0);
+  }
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.Finish(CreateMonster(fbb, &monster), MonsterIdentifier());
+
+  auto packed = GetMonster(fbb.GetBufferPointer());
+  TEST_EQ(packed->vector_of_longs()->Get(999), -999000006993LL);
+  TEST_EQ(packed->vector_of_enums()->GetEnum<Color>(1), Color_Blue);
+  TEST_EQ(packed->test4()->Get(999)->a(), -999);
+
+  // Vectors of scalars, enums and structs are unpacked in bulk, bools one by
+  // one, both must round trip.
+  MonsterT unpacked;
+  packed->UnPackTo(&unpacked);
+  TEST_ASSERT(unpacked.vector_of_longs == monster.vector_of_longs);
+  TEST_ASSERT(unpacked.vector_of_doubles == monster.vector_of_doubles);
+  TEST_ASSERT(unpacked.vector_of_enums == monster.vector_of_enums);
+  TEST_ASSERT(unpacked.test4 == monster.test4);
+  TEST_ASSERT(unpacked.testarrayofbools == monster.testarrayofbools);
+
+  // Unpacking a buffer without the vectors clears them.
+  flatbuffers::FlatBufferBuilder empty;
+  auto name = empty.CreateString("Empty");
+  MonsterBuilder builder(empty);
+  builder.add_name(name);
+  empty.Finish(builder.Finish(), MonsterIdentifier());
+  GetMonster(empty.GetBufferPointer())->UnPackTo(&unpacked);
+  TEST_ASSERT(unpacked.vector_of_longs.empty());
+  TEST_ASSERT(unpacked.test4.empty());
+}
+
+void VectorPrefetchTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Monster>> children;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> names;
+  for (int i = 0; i < 100; i++) {
+    names.push_back(fbb.CreateString("child" + flatbuffers::NumToString(i)));
+    MonsterBuilder builder(fbb);
+    builder.add_name(names.back());
+    // Some children have a different vtable.
+    if (i % 3 == 0) builder.add_hp(static_cast<int16_t>(i));
+    children.push_back(builder.Finish());
+  }
+  auto tables = fbb.CreateVector(children);
+  auto strings = fbb.CreateVector(names);
+  auto name = fbb.CreateString("parent");
+  MonsterBuilder builder(fbb);
+  builder.add_name(name);
+  builder.add_testarrayoftables(tables);
+  builder.add_testarrayofstring(strings);
+  fbb.Finish(builder.Finish(), MonsterIdentifier());
+  auto parent = GetMonster(fbb.GetBufferPointer());
+  auto& vec = *parent->testarrayoftables();
+
+  // Every element is visited in order, whether the prefetch distance is
+  // shorter or longer than the vector.
+  const flatbuffers::uoffset_t distances[] = { 0, 1, 8, 60, 1000 };
+  for (auto distance : distances) {
+    flatbuffers::uoffset_t next = 0;
+    flatbuffers::ForEachPrefetched(
+        vec,
+        [&](flatbuffers::uoffset_t i, const Monster* child) {
+          TEST_EQ(i, next++);
+          TEST_EQ(child, vec.Get(i));
+        },
+        distance);
+    TEST_EQ(next, vec.size());
+  }
+  int hp_sum = 0;
+  flatbuffers::ForEachPrefetched(
+      vec, [&](flatbuffers::uoffset_t, const Monster* child) {
+        hp_sum += child->hp();
+      });
+  TEST_EQ(hp_sum, 1683 + 66 * 100);  // 0 + 3 + ... + 99, and default hps.
+  flatbuffers::uoffset_t num_strings = 0;
+  flatbuffers::ForEachPrefetched(
+      *parent->testarrayofstring(),
+      [&](flatbuffers::uoffset_t i, const flatbuffers::String* str) {
+        TEST_EQ_STR(str->c_str(),
+                    ("child" + flatbuffers::NumToString(i)).c_str());
+        num_strings++;
+      });
+  TEST_EQ(num_strings, 100u);
+
+  std::vector<const Monster*> resolved(vec.size());
+  flatbuffers::ResolveOffsets(vec, 10, 90, resolved.data());
+  for (flatbuffers::uoffset_t i = 10; i < 90; i++) {
+    TEST_EQ(resolved[i - 10], vec.Get(i));
+  }
+  flatbuffers::ResolveOffsets(vec, 0, vec.size(), resolved.data());
+  TEST_EQ(resolved.back(), vec.Get(99));
+}
+
 // Utility function to check a Monster object.
 void CheckMonsterObject(MonsterT* monster2) {
   TEST_EQ(monster2->hp, 80);
@@ -18,6 +18,12 @@ void MutateFlatBuffersTest(uint8_t* flatbuf, std::size_t length);
 
 void ObjectFlatBuffersTest(uint8_t* flatbuf);
 
+void PackedSizeUpperBoundTest(uint8_t* flatbuf);
+
+void ObjectVectorCopyTest();
+
+void VectorPrefetchTest();
+
 void CheckMonsterObject(MyGame::Example::MonsterT* monster2);
 
 void SizePrefixedTest();
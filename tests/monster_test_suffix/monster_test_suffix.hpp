@@ -327,6 +327,7 @@ struct AnyUnion {
 
   static void *UnPack(const void *obj, Any type, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSizeUpperBound() const;
 
   MyGame::Example::MonsterT *AsMonster() {
     return type == Any_Monster ?
@@ -485,6 +486,7 @@ struct AnyUniqueAliasesUnion {
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSizeUpperBound() const;
 
   MyGame::Example::MonsterT *AsM() {
     return type == AnyUniqueAliases_M ?
@@ -601,6 +603,7 @@ struct AnyAmbiguousAliasesUnion {
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSizeUpperBound() const;
 
   MyGame::Example::MonsterT *AsM1() {
     return type == AnyAmbiguousAliases_M1 ?
@@ -1007,6 +1010,7 @@ inline ::flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(
 }
 
 ::flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(::flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const InParentNamespaceT &_o);
 
 namespace Example2 {
 
@@ -1052,6 +1056,7 @@ inline ::flatbuffers::Offset<Monster> CreateMonster(
 }
 
 ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const MonsterT &_o);
 
 }  // namespace Example2
 
@@ -1115,6 +1120,7 @@ inline ::flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithE
 }
 
 ::flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(::flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const TestSimpleTableWithEnumT &_o);
 
 struct StatT : public ::flatbuffers::NativeTable {
   typedef Stat TableType;
@@ -1222,6 +1228,7 @@ inline ::flatbuffers::Offset<Stat> CreateStatDirect(
 }
 
 ::flatbuffers::Offset<Stat> CreateStat(::flatbuffers::FlatBufferBuilder &_fbb, const StatT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const StatT &_o);
 
 struct ReferrableT : public ::flatbuffers::NativeTable {
   typedef Referrable TableType;
@@ -1287,6 +1294,7 @@ inline ::flatbuffers::Offset<Referrable> CreateReferrable(
 }
 
 ::flatbuffers::Offset<Referrable> CreateReferrable(::flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const ReferrableT &_o);
 
 struct MonsterT : public ::flatbuffers::NativeTable {
   typedef Monster TableType;
@@ -2500,6 +2508,7 @@ inline ::flatbuffers::Offset<Monster> CreateMonsterDirect(
 }
 
 ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const MonsterT &_o);
 
 struct TypeAliasesT : public ::flatbuffers::NativeTable {
   typedef TypeAliases TableType;
@@ -2747,6 +2756,7 @@ inline ::flatbuffers::Offset<TypeAliases> CreateTypeAliasesDirect(
 }
 
 ::flatbuffers::Offset<TypeAliases> CreateTypeAliases(::flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t PackedSizeUpperBound(const TypeAliasesT &_o);
 
 }  // namespace Example
 
@@ -2779,10 +2789,19 @@ inline ::flatbuffers::Offset<InParentNamespace> InParentNamespace::Pack(::flatbu
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const InParentNamespaceT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   return MyGame::CreateInParentNamespace(
       _fbb);
 }
 
+inline size_t PackedSizeUpperBound(const InParentNamespaceT &_o) {
+  (void)_o;
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(0, 0);
+  return _size;
+}
+
 namespace Example2 {
 
 
@@ -2814,10 +2833,19 @@ inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBui
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const MonsterT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   return MyGame::Example2::CreateMonster(
       _fbb);
 }
 
+inline size_t PackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(0, 0);
+  return _size;
+}
+
 }  // namespace Example2
 
 namespace Example {
@@ -2853,12 +2881,21 @@ inline ::flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnum::P
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const TestSimpleTableWithEnumT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _color = _o->color;
   return MyGame::Example::CreateTestSimpleTableWithEnum(
       _fbb,
       _color);
 }
 
+inline size_t PackedSizeUpperBound(const TestSimpleTableWithEnumT &_o) {
+  (void)_o;
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(1, 1);
+  return _size;
+}
+
 
 inline bool operator==(const StatT &lhs, const StatT &rhs) {
   return
@@ -2894,6 +2931,9 @@ inline ::flatbuffers::Offset<Stat> Stat::Pack(::flatbuffers::FlatBufferBuilder &
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const StatT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _id = _o->id.empty() ? 0 : _fbb.CreateString(_o->id);
   auto _val = _o->val;
   auto _count = _o->count;
@@ -2904,6 +2944,12 @@ inline ::flatbuffers::Offset<Stat> Stat::Pack(::flatbuffers::FlatBufferBuilder &
       _count);
 }
 
+inline size_t PackedSizeUpperBound(const StatT &_o) {
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(3, 25);
+  _size += ::flatbuffers::PackedStringSizeUpperBound(_o.id.length());
+  return _size;
+}
+
 
 inline bool operator==(const ReferrableT &lhs, const ReferrableT &rhs) {
   return
@@ -2935,12 +2981,21 @@ inline ::flatbuffers::Offset<Referrable> Referrable::Pack(::flatbuffers::FlatBuf
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const ReferrableT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _id = _o->id;
   return MyGame::Example::CreateReferrable(
       _fbb,
       _id);
 }
 
+inline size_t PackedSizeUpperBound(const ReferrableT &_o) {
+  (void)_o;
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(1, 15);
+  return _size;
+}
+
 
 inline bool operator==(const MonsterT &lhs, const MonsterT &rhs) {
   return
@@ -3154,7 +3209,7 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
   { auto _e = color(); _o->color = _e; }
   { auto _e = test_type(); _o->test.type = _e; }
   { auto _e = test(); if (_e) _o->test.value = MyGame::Example::AnyUnion::UnPack(_e, test_type(), _resolver); }
-  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } else { _o->test4.resize(0); } }
+  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->test4.data()); } else { _o->test4.resize(0); } }
   { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i] = _e->Get(_i)->str(); } } else { _o->testarrayofstring.resize(0); } }
   { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->testarrayoftables[_i]) { _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); } else { _o->testarrayoftables[_i] = std::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->testarrayoftables.resize(0); } }
   { auto _e = enemy(); if (_e) { if(_o->enemy) { _e->UnPackTo(_o->enemy.get(), _resolver); } else { _o->enemy = std::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); } } else if (_o->enemy) { _o->enemy.reset(); } }
@@ -3174,11 +3229,11 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
   { auto _e = testf2(); _o->testf2 = _e; }
   { auto _e = testf3(); _o->testf3 = _e; }
   { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i] = _e->Get(_i)->str(); } } else { _o->testarrayofstring2.resize(0); } }
-  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } else { _o->testarrayofsortedstruct.resize(0); } }
+  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->testarrayofsortedstruct.data()); } else { _o->testarrayofsortedstruct.resize(0); } }
   { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } }
-  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } else { _o->test5.resize(0); } }
-  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } else { _o->vector_of_longs.resize(0); } }
-  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } else { _o->vector_of_doubles.resize(0); } }
+  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->test5.data()); } else { _o->test5.resize(0); } }
+  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->vector_of_longs.data()); } else { _o->vector_of_longs.resize(0); } }
+  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->vector_of_doubles.data()); } else { _o->vector_of_doubles.resize(0); } }
   { auto _e = parent_namespace_test(); if (_e) { if(_o->parent_namespace_test) { _e->UnPackTo(_o->parent_namespace_test.get(), _resolver); } else { _o->parent_namespace_test = std::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); } } else if (_o->parent_namespace_test) { _o->parent_namespace_test.reset(); } }
   { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->vector_of_referrables[_i]) { _e->Get(_i)->UnPackTo(_o->vector_of_referrables[_i].get(), _resolver); } else { _o->vector_of_referrables[_i] = std::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->vector_of_referrables.resize(0); } }
   { auto _e = single_weak_reference(); /*scalar resolver, naked*/ if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->single_weak_reference), static_cast<::flatbuffers::hash_value_t>(_e)); else _o->single_weak_reference = nullptr; }
@@ -3192,7 +3247,7 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
   { auto _e = any_unique(); if (_e) _o->any_unique.value = MyGame::Example::AnyUniqueAliasesUnion::UnPack(_e, any_unique_type(), _resolver); }
   { auto _e = any_ambiguous_type(); _o->any_ambiguous.type = _e; }
   { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.value = MyGame::Example::AnyAmbiguousAliasesUnion::UnPack(_e, any_ambiguous_type(), _resolver); }
-  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<MyGame::Example::Color>(_e->Get(_i)); } } else { _o->vector_of_enums.resize(0); } }
+  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->vector_of_enums.data()); } else { _o->vector_of_enums.resize(0); } }
   { auto _e = signed_enum(); _o->signed_enum = _e; }
   { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } }
   { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->scalar_key_sorted_tables[_i]) { _e->Get(_i)->UnPackTo(_o->scalar_key_sorted_tables[_i].get(), _resolver); } else { _o->scalar_key_sorted_tables[_i] = std::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->scalar_key_sorted_tables.resize(0); } }
@@ -3217,6 +3272,9 @@ inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBui
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const MonsterT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _pos = _o->pos ? _o->pos.get() : nullptr;
   auto _mana = _o->mana;
   auto _hp = _o->hp;
@@ -3343,6 +3401,44 @@ inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBui
       _double_inf_default);
 }
 
+inline size_t PackedSizeUpperBound(const MonsterT &_o) {
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(61, 493);
+  _size += ::flatbuffers::PackedStringSizeUpperBound(_o.name.length());
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.inventory.size(), 1, 1);
+  _size += _o.test.PackedSizeUpperBound();
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.test4.size(), 4, 2);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testarrayofstring.size(), 8, 4);
+  for (const auto &_e : _o.testarrayofstring) _size += ::flatbuffers::PackedStringSizeUpperBound(_e.length());
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testarrayoftables.size(), 4, 4);
+  for (const auto &_e : _o.testarrayoftables) _size += ::MyGame::Example::PackedSizeUpperBound(*_e);
+  if (_o.enemy) _size += ::MyGame::Example::PackedSizeUpperBound(*_o.enemy);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testnestedflatbuffer.size(), 1, 1);
+  if (_o.testempty) _size += ::MyGame::Example::PackedSizeUpperBound(*_o.testempty);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testarrayofbools.size(), 1, 1);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testarrayofstring2.size(), 8, 4);
+  for (const auto &_e : _o.testarrayofstring2) _size += ::flatbuffers::PackedStringSizeUpperBound(_e.length());
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testarrayofsortedstruct.size(), 8, 4);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.flex.size(), 1, 1);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.test5.size(), 4, 2);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_longs.size(), 8, 8);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_doubles.size(), 8, 8);
+  if (_o.parent_namespace_test) _size += ::MyGame::PackedSizeUpperBound(*_o.parent_namespace_test);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_referrables.size(), 4, 4);
+  for (const auto &_e : _o.vector_of_referrables) _size += ::MyGame::Example::PackedSizeUpperBound(*_e);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_weak_references.size(), 8, 8);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_strong_referrables.size(), 4, 4);
+  for (const auto &_e : _o.vector_of_strong_referrables) _size += ::MyGame::Example::PackedSizeUpperBound(*_e);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_co_owning_references.size(), 8, 8);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_non_owning_references.size(), 8, 8);
+  _size += _o.any_unique.PackedSizeUpperBound();
+  _size += _o.any_ambiguous.PackedSizeUpperBound();
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vector_of_enums.size(), 1, 1);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.testrequirednestedflatbuffer.size(), 1, 1);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.scalar_key_sorted_tables.size(), 4, 4);
+  for (const auto &_e : _o.scalar_key_sorted_tables) _size += ::MyGame::Example::PackedSizeUpperBound(*_e);
+  return _size;
+}
+
 
 inline bool operator==(const TypeAliasesT &lhs, const TypeAliasesT &rhs) {
   return
@@ -3385,7 +3481,7 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const ::flatbuffers::resolve
   { auto _e = f32(); _o->f32 = _e; }
   { auto _e = f64(); _o->f64 = _e; }
   { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } }
-  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } else { _o->vf64.resize(0); } }
+  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); ::flatbuffers::CopyVectorTo(*_e, _o->vf64.data()); } else { _o->vf64.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<TypeAliases> CreateTypeAliases(::flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -3396,6 +3492,9 @@ inline ::flatbuffers::Offset<TypeAliases> TypeAliases::Pack(::flatbuffers::FlatB
   (void)_rehasher;
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const TypeAliasesT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  if (_fbb.GetBufferCapacity() == 0) {
+    _fbb.Reserve(PackedSizeUpperBound(*_o));
+  }
   auto _i8 = _o->i8;
   auto _u8 = _o->u8;
   auto _i16 = _o->i16;
@@ -3424,6 +3523,13 @@ inline ::flatbuffers::Offset<TypeAliases> TypeAliases::Pack(::flatbuffers::FlatB
       _vf64);
 }
 
+inline size_t PackedSizeUpperBound(const TypeAliasesT &_o) {
+  size_t _size = ::flatbuffers::PackedTableSizeUpperBound(12, 88);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.v8.size(), 1, 1);
+  _size += ::flatbuffers::PackedVectorSizeUpperBound(_o.vf64.size(), 8, 8);
+  return _size;
+}
+
 template <bool B>
 inline bool VerifyAny(::flatbuffers::VerifierTemplate<B> &verifier, const void *obj, Any type) {
   switch (type) {
@@ -3497,6 +3603,24 @@ inline ::flatbuffers::Offset<void> AnyUnion::Pack(::flatbuffers::FlatBufferBuild
   }
 }
 
+inline size_t AnyUnion::PackedSizeUpperBound() const {
+  switch (type) {
+    case Any_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    case Any_TestSimpleTableWithEnum: {
+      auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    case Any_MyGame_Example2_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ::MyGame::Example2::PackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUnion::AnyUnion(const AnyUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Any_Monster: {
@@ -3612,6 +3736,24 @@ inline ::flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(::flatbuffers::Fl
   }
 }
 
+inline size_t AnyUniqueAliasesUnion::PackedSizeUpperBound() const {
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    case AnyUniqueAliases_TS: {
+      auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    case AnyUniqueAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ::MyGame::Example2::PackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUniqueAliasesUnion::AnyUniqueAliasesUnion(const AnyUniqueAliasesUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -3727,6 +3869,24 @@ inline ::flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(::flatbuffers:
   }
 }
 
+inline size_t AnyAmbiguousAliasesUnion::PackedSizeUpperBound() const {
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    case AnyAmbiguousAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    case AnyAmbiguousAliases_M3: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::PackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline AnyAmbiguousAliasesUnion::AnyAmbiguousAliasesUnion(const AnyAmbiguousAliasesUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -0,0 +1,156 @@
+#include "record_stream_test.h"
+
+#include <cstdio>
+#include <string>
+
+#include "flatbuffers/record_stream.h"
+#include "flatbuffers/util.h"
+#include "monster_test_generated.h"
+#include "test_assert.h"
+
+namespace flatbuffers {
+namespace tests {
+
+using namespace MyGame::Example;
+
+namespace {
+
+const int kNumRecords = 200;
+
+void BuildRecord(FlatBufferBuilder& builder, int i) {
+  builder.Clear();
+  const auto name = builder.CreateString("monster " + NumToString(i));
+  const Vec3 pos(1.0f * i, 2, 3, 0.5 * i, Color_Red, Test(10, 20));
+  MonsterBuilder monster(builder);
+  monster.add_pos(&pos);
+  monster.add_name(name);
+  monster.add_hp(static_cast<int16_t>(i));
+  FinishSizePrefixedMonsterBuffer(builder, monster.Finish());
+}
+
+void CheckRecords(const RecordStreamReader& reader, int num_records) {
+  TEST_EQ(reader.size(), static_cast<size_t>(num_records));
+  for (int i = 0; i < num_records; i++) {
+    TEST_ASSERT(reader.VerifyRecord<Monster>(i, MonsterIdentifier()));
+    const Monster* monster = reader.GetRoot<Monster>(i);
+    TEST_NOTNULL(monster);
+    TEST_EQ(monster->hp(), i);
+    TEST_EQ(monster->pos()->test1(), i * 0.5);
+  }
+  TEST_ASSERT(!reader.Get(num_records).data);
+  TEST_ASSERT(!reader.GetRoot<Monster>(num_records));
+  TEST_ASSERT(!reader.VerifyRecord<Monster>(num_records));
+
+  int count = 0;
+  for (auto it = reader.begin(); it != reader.end(); ++it) {
+    TEST_EQ(GetRoot<Monster>((*it).data)->hp(), count);
+    count++;
+  }
+  TEST_EQ(count, num_records);
+
+  // Iterate in ranges, as threads would.
+  count = 0;
+  const int range = num_records / 3 + 1;
+  for (int begin = 0; begin < num_records; begin += range) {
+    reader.ForEach(begin, begin + range,
+                   [&](size_t i, const RecordStreamReader::Record& record) {
+                     TEST_EQ(i, static_cast<size_t>(count));
+                     TEST_EQ(GetRoot<Monster>(record.data)->hp(), count);
+                     count++;
+                   });
+  }
+  TEST_EQ(count, num_records);
+}
+
+}  // namespace
+
+void RecordStreamTest() {
+  const std::string filename = "record_stream_test.fbrs";
+  FlatBufferBuilder builder;
+  {
+    RecordStreamOptions options;
+    options.index_interval = 16;
+    options.batch_size = 1024;
+    RecordStreamWriter writer(options);
+    TEST_ASSERT(writer.Open(filename));
+    for (int i = 0; i < kNumRecords; i++) {
+      BuildRecord(builder, i);
+      TEST_ASSERT(writer.Append(builder));
+    }
+    TEST_EQ(writer.size(), static_cast<size_t>(kNumRecords));
+    TEST_ASSERT(writer.Close());
+  }
+
+  RecordStreamReader reader;
+  TEST_ASSERT(reader.Open(filename));
+  TEST_ASSERT(reader.has_index());
+  TEST_ASSERT(reader.has_checksums());
+  CheckRecords(reader, kNumRecords);
+
+  std::string contents;
+  TEST_ASSERT(LoadFile(filename.c_str(), true, &contents));
+  reader.Close();
+  std::remove(filename.c_str());
+  TEST_EQ(contents.size() % 8, 0u);
+
+  // A damaged record fails its checksum.
+  const auto data = reinterpret_cast<const uint8_t*>(contents.data());
+  TEST_ASSERT(reader.Open(data, contents.size()));
+  const size_t damaged =
+      static_cast<size_t>(reader.Get(42).data - data) + 20;
+  std::string damaged_contents = contents;
+  damaged_contents[damaged] ^= 1;
+  TEST_ASSERT(reader.Open(
+      reinterpret_cast<const uint8_t*>(damaged_contents.data()),
+      damaged_contents.size()));
+  TEST_ASSERT(!reader.CheckRecord(reader.Get(42)));
+  TEST_ASSERT(!reader.VerifyRecord<Monster>(42, MonsterIdentifier()));
+  TEST_ASSERT(reader.VerifyRecord<Monster>(41, MonsterIdentifier()));
+
+  // A stream cut off in the middle of a record, as if its writer crashed,
+  // has no index, and loses that record.
+  TEST_ASSERT(reader.Open(data, contents.size()));
+  const size_t cut = static_cast<size_t>(reader.Get(150).data - data) + 10;
+  TEST_ASSERT(reader.Open(data, cut));
+  TEST_ASSERT(!reader.has_index());
+  CheckRecords(reader, 150);
+
+  // A file of size-prefixed buffers one after the other.
+  std::string log;
+  for (int i = 0; i < kNumRecords; i++) {
+    BuildRecord(builder, i);
+    log.append(reinterpret_cast<const char*>(builder.GetBufferPointer()),
+               builder.GetSize());
+  }
+  TEST_ASSERT(
+      reader.Open(reinterpret_cast<const uint8_t*>(log.data()), log.size()));
+  TEST_ASSERT(!reader.has_index());
+  TEST_ASSERT(!reader.has_checksums());
+  CheckRecords(reader, kNumRecords);
+
+  // Which can be converted into a stream, here without checksums.
+  {
+    RecordStreamOptions options;
+    options.checksums = false;
+    RecordStreamWriter writer(options);
+    TEST_ASSERT(writer.Open(filename));
+    for (auto it = reader.begin(); it != reader.end(); ++it) {
+      TEST_ASSERT(writer.Append((*it).data - sizeof(uoffset_t)));
+    }
+    TEST_ASSERT(writer.Close());
+  }
+  TEST_ASSERT(reader.Open(filename));
+  TEST_ASSERT(reader.has_index());
+  TEST_ASSERT(!reader.has_checksums());
+  CheckRecords(reader, kNumRecords);
+  reader.Close();
+  std::remove(filename.c_str());
+
+  // Files that aren't readable, or streams in a later format, are rejected.
+  TEST_ASSERT(!reader.Open(filename));
+  contents[4] = 2;
+  TEST_ASSERT(reader.Open(data, contents.size()) == false);
+}
+
+}  // namespace tests
+}  // namespace flatbuffers
@@ -0,0 +1,12 @@
+#ifndef TESTS_RECORD_STREAM_TEST_H
+#define TESTS_RECORD_STREAM_TEST_H
+
+namespace flatbuffers {
+namespace tests {
+
+void RecordStreamTest();
+
+}  // namespace tests
+}  // namespace flatbuffers
+
+#endif
@@ -335,6 +335,115 @@ void ForAllFieldsReverseTest(const std::string& tests_data_path) {
   }
 }
 
+void CompiledSchemaTest(const std::string& tests_data_path, uint8_t* flatbuf,
+                        size_t length) {
+  std::string bfbsfile;
+  TEST_EQ(flatbuffers::LoadFile((tests_data_path + "monster_test.bfbs").c_str(),
+                                true, &bfbsfile),
+          true);
+  auto& schema = *reflection::GetSchema(bfbsfile.c_str());
+  const flatbuffers::CompiledSchema compiled(schema);
+
+  // Every object, enum and field is found by its name.
+  TEST_EQ(compiled.objects().size(), schema.objects()->size());
+  for (uoffset_t i = 0; i < schema.objects()->size(); i++) {
+    auto objectdef = schema.objects()->Get(i);
+    auto object = compiled.LookupObject(objectdef->name()->str());
+    TEST_EQ(object, &compiled.objects()[i]);
+    TEST_EQ(object->def, objectdef);
+    for (uoffset_t j = 0; j < objectdef->fields()->size(); j++) {
+      auto fielddef = objectdef->fields()->Get(j);
+      TEST_EQ(object->LookupField(fielddef->name()->c_str()),
+              &object->fields[j]);
+    }
+    TEST_NULL(object->LookupField("no_such_field"));
+  }
+  for (uoffset_t i = 0; i < schema.enums()->size(); i++) {
+    auto enumdef = schema.enums()->Get(i);
+    TEST_EQ(compiled.LookupEnum(enumdef->name()->c_str()),
+            &compiled.enums()[i]);
+  }
+  TEST_NULL(compiled.LookupObject("MyGame.Example.NoSuchTable"));
+  TEST_NULL(compiled.LookupEnum("Color"));
+
+  auto monster = compiled.root_table();
+  TEST_NOTNULL(monster);
+  TEST_EQ(monster->def, schema.root_table());
+  TEST_EQ(monster, compiled.LookupObject("MyGame.Example.Monster"));
+
+  // The fields hold what accessing them takes.
+  auto hp = monster->LookupField("hp");
+  TEST_EQ(hp->offset, Monster::VT_HP);
+  TEST_EQ(hp->base_type, reflection::Short);
+  TEST_EQ(hp->size, sizeof(int16_t));
+  TEST_EQ(hp->default_integer, 100);
+  auto pos = monster->LookupField("pos");
+  TEST_EQ(pos->object, compiled.LookupObject("MyGame.Example.Vec3"));
+  TEST_EQ(pos->size, sizeof(Vec3));
+  auto test4 = monster->LookupField("test4");
+  TEST_EQ(test4->element, reflection::Obj);
+  TEST_EQ(test4->element_size, sizeof(Test));
+  auto color = monster->LookupField("color");
+  TEST_EQ(color->enum_def, compiled.LookupEnum("MyGame.Example.Color"));
+  auto test = monster->LookupField("test");
+  TEST_EQ(test->union_type, monster->LookupField("test_type"));
+  TEST_EQ(monster->LookupField("any_unique")->union_type,
+          monster->LookupField("any_unique_type"));
+
+  // Read and write the fields.
+  std::vector<uint8_t> buf(flatbuf, flatbuf + length);
+  auto root = flatbuffers::GetAnyRoot(buf.data());
+  TEST_EQ(flatbuffers::GetAnyFieldI(*root, *hp), 80);
+  TEST_EQ(flatbuffers::GetAnyFieldI(*root, *monster->LookupField("mana")),
+          150);  // Default.
+  TEST_EQ(flatbuffers::GetAnyFieldF(*root, *hp), 80.0);
+  TEST_EQ_STR(
+      flatbuffers::GetAnyFieldS(*root, *monster->LookupField("name"), &compiled)
+          .c_str(),
+      "MyMonster");
+  auto pos_struct = flatbuffers::GetFieldStruct(*root, *pos->def);
+  auto z = pos->object->LookupField("z");
+  TEST_EQ(flatbuffers::GetAnyFieldF(*pos_struct, *z), 3.0);
+  TEST_EQ(flatbuffers::SetAnyFieldI(root, *hp, 200), true);
+  TEST_EQ(flatbuffers::GetAnyFieldI(*root, *hp), 200);
+  // Not present, so can only be set to its default.
+  TEST_EQ(flatbuffers::SetAnyFieldI(root, *monster->LookupField("mana"), 1),
+          false);
+  TEST_EQ(flatbuffers::SetAnyFieldI(root, *hp, 80), true);
+
+  // Unions are resolved without looking anything up.
+  auto test_object = flatbuffers::GetUnionType(*test, *root);
+  TEST_EQ(test_object, monster);
+  auto test_table = flatbuffers::GetFieldT(*root, *test->def);
+  TEST_EQ_STR(flatbuffers::GetAnyFieldS(*test_table,
+                                        *test_object->LookupField("name"),
+                                        nullptr)
+                  .c_str(),
+              "Fred");
+
+  // Copy and verify.
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.Finish(flatbuffers::CopyTable(fbb, *monster, *root, true),
+             MonsterIdentifier());
+  AccessFlatBufferTest(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(flatbuffers::Verify(*monster, fbb.GetBufferPointer(), fbb.GetSize()),
+          true);
+  TEST_EQ(flatbuffers::Verify(*monster, buf.data(), buf.size()), true);
+  TEST_EQ(flatbuffers::Verify(*monster, buf.data(), buf.size() / 2), false);
+
+  flatbuffers::FlatBufferBuilder size_prefixed_fbb;
+  size_prefixed_fbb.FinishSizePrefixed(
+      flatbuffers::CopyTable(size_prefixed_fbb, *monster, *root));
+  TEST_EQ(flatbuffers::VerifySizePrefixed(*monster,
+                                          size_prefixed_fbb.GetBufferPointer(),
+                                          size_prefixed_fbb.GetSize()),
+          true);
+
+  // A union type out of range makes the buffer invalid.
+  flatbuffers::SetAnyFieldI(root, *test->union_type, 100);
+  TEST_EQ(flatbuffers::Verify(*monster, buf.data(), buf.size()), false);
+}
+
 void MiniReflectFlatBuffersTest(uint8_t* flatbuf) {
   auto s =
       flatbuffers::FlatBufferToString(flatbuf, Monster::MiniReflectTypeTable());
@@ -0,0 +1,84 @@
+#include "static_vtables_test.h"
+
+#include "flatbuffers/flatbuffer_builder.h"
+#include "test_assert.h"
+#include "tests/static_vtables_test_generated.h"
+
+namespace flatbuffers {
+namespace tests {
+
+using namespace StaticVTables;
+
+namespace {
+
+const Table* AsTable(const void* table) {
+  return reinterpret_cast<const Table*>(table);
+}
+
+}  // namespace
+
+void StaticVTablesTest() {
+  FlatBufferBuilder builder;
+  Offset<Item> items[4];
+  for (int i = 0; i < 4; ++i) {
+    const auto name = builder.CreateString("item " + NumToString(i));
+    const Offset<String> tag_strings[] = { name };
+    const auto tags = builder.CreateVector(tag_strings, 1);
+    const Point point(1.5f * i, 2.5f, -i);
+    // All the fields are stored, also the ones at their default.
+    items[i] = i % 2 ? CreateItemWithStaticVTable(
+                           builder, 4 - i, name, point, Color_Green, 7,
+                           i == 1, tags)
+                     : CreateItem(builder, 4 - i, name, &point, Color_Green,
+                                  static_cast<int16_t>(i), true, tags);
+  }
+  const auto items_offset = builder.CreateVectorOfSortedTables(items, 4);
+  const auto owner = builder.CreateString("owner");
+  builder.Finish(
+      CreateInventoryWithStaticVTable(builder, items_offset, owner, 3));
+
+  Verifier verifier(builder.GetBufferPointer(), builder.GetSize());
+  TEST_ASSERT(VerifyInventoryBuffer(verifier));
+  const Inventory* inventory = GetInventory(builder.GetBufferPointer());
+  TEST_EQ_STR(inventory->owner()->c_str(), "owner");
+  TEST_EQ(inventory->capacity(), 3);
+  TEST_EQ(inventory->items()->size(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    // Sorted by decreasing `i`.
+    const Item* item = inventory->items()->Get(static_cast<uoffset_t>(3 - i));
+    TEST_EQ(item->id(), static_cast<uint64_t>(4 - i));
+    TEST_EQ_STR(item->name()->c_str(), ("item " + NumToString(i)).c_str());
+    TEST_EQ(item->point()->x(), 1.5f * i);
+    TEST_EQ(item->point()->z(), -i);
+    TEST_EQ(item->color(), Color_Green);
+    TEST_EQ(item->count(), i % 2 ? 7 : i);
+    TEST_EQ(item->flag(), i != 3);
+    TEST_EQ_STR(item->tags()->Get(0)->c_str(), item->name()->c_str());
+    TEST_EQ(AsTable(item)->CheckField(Item::VT_COLOR), i % 2 == 1);
+  }
+
+  // The tables created with the same static vtable share it.
+  const auto sorted = inventory->items();
+  TEST_EQ(AsTable(sorted->Get(0))->GetVTable(),
+          AsTable(sorted->Get(2))->GetVTable());
+  TEST_NE(AsTable(sorted->Get(0))->GetVTable(),
+          AsTable(sorted->Get(1))->GetVTable());
+
+  // Even if DedupVtables(false) was set, a table with a static vtable can
+  // still be created.
+  builder.Clear();
+  builder.DedupVtables(false);
+  const auto name = builder.CreateString("name");
+  const auto tags = builder.CreateVector(&name, 1);
+  const Offset<Item> unshared[] = {
+    CreateItemWithStaticVTable(builder, 1, name, Point(), Color_Red, 0, false,
+                               tags),
+  };
+  builder.Finish(CreateInventoryWithStaticVTable(
+      builder, builder.CreateVector(unshared, 1), name, 0));
+  Verifier unshared_verifier(builder.GetBufferPointer(), builder.GetSize());
+  TEST_ASSERT(VerifyInventoryBuffer(unshared_verifier));
+}
+
+}  // namespace tests
+}  // namespace flatbuffers
@@ -0,0 +1,12 @@
+#ifndef TESTS_STATIC_VTABLES_TEST_H
+#define TESTS_STATIC_VTABLES_TEST_H
+
+namespace flatbuffers {
+namespace tests {
+
+void StaticVTablesTest();
+
+}  // namespace tests
+}  // namespace flatbuffers
+
+#endif
@@ -36,6 +36,7 @@
 #include "alignment_test.h"
 #include "cross_namespace_pack_test_generated.h"
 #include "default_vectors_strings_test.h"
+#include "delta_test.h"
 #include "evolution_test.h"
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
@@ -52,7 +53,9 @@
 #include "optional_scalars_test.h"
 #include "parser_test.h"
 #include "proto_test.h"
+#include "record_stream_test.h"
 #include "reflection_test.h"
+#include "static_vtables_test.h"
 #include "tests/union_vector/union_vector_generated.h"
 #include "union_underlying_type_test_generated.h"
 #if !defined(_MSC_VER) || _MSC_VER >= 1700
@@ -66,6 +69,7 @@
 #include "monster_test_bfbs_generated.h"  // Generated using --bfbs-comments --bfbs-builtins --cpp --bfbs-gen-embed
 #include "native_type_test_generated.h"
 #include "test_assert.h"
+#include "transcoder_test.h"
 #include "util_test.h"
 #include "vector_table_naked_ptr_test.h"
 
@@ -603,6 +607,241 @@ void CreateSharedStringTest() {
   TEST_EQ((*a[6]) < (*a[5]), true);
 }
 
+flatbuffers::Offset<Monster> BuildSegmentedTestChild(
+    flatbuffers::FlatBufferBuilder& builder, int i) {
+  auto name = builder.CreateSharedString("child" + NumToString(i % 7));
+  std::vector<double> doubles(static_cast<size_t>(i), 0.5 * i);
+  auto vec = builder.CreateVector(doubles);
+  Vec3 pos(1.0f * i, 2.0f, 3.0f, 4.0 * i, Color_Green, Test(5, 6));
+  MonsterBuilder child(builder);
+  child.add_name(name);
+  child.add_pos(&pos);
+  child.add_hp(static_cast<int16_t>(i));
+  child.add_vector_of_doubles(vec);
+  return child.Finish();
+}
+
+flatbuffers::Offset<Monster> BuildSegmentedTestMonster(
+    flatbuffers::FlatBufferBuilder& builder) {
+  std::vector<flatbuffers::Offset<Monster>> children;
+  for (int i = 0; i < 40; i++) {
+    children.push_back(BuildSegmentedTestChild(builder, i));
+  }
+  auto children_vec = builder.CreateVector(children);
+  auto name = builder.CreateString("segmented");
+  MonsterBuilder root(builder);
+  root.add_name(name);
+  root.add_testarrayoftables(children_vec);
+  return root.Finish();
+}
+
+void SegmentedBuilderTest() {
+  flatbuffers::FlatBufferBuilder contiguous;
+  contiguous.Finish(BuildSegmentedTestMonster(contiguous), MonsterIdentifier());
+  const std::vector<uint8_t> expected(
+      contiguous.GetBufferPointer(),
+      contiguous.GetBufferPointer() + contiguous.GetSize());
+
+  flatbuffers::FlatBufferBuilder segmented(64);
+  segmented.SetSegmentSize(128);
+  segmented.Finish(BuildSegmentedTestMonster(segmented), MonsterIdentifier());
+  TEST_EQ(segmented.GetSize(), contiguous.GetSize());
+
+  // The segments concatenate to exactly the contiguous buffer.
+  auto segments = segmented.GetBufferSegments();
+  TEST_ASSERT(segments.size() > 1);
+  std::vector<uint8_t> joined;
+  for (auto it = segments.begin(); it != segments.end(); ++it) {
+    joined.insert(joined.end(), it->data(), it->data() + it->size());
+  }
+  TEST_ASSERT(joined == expected);
+
+  // Flattening yields the same bytes, suitably aligned to be read in place.
+  auto released = segmented.Release();
+  TEST_EQ(released.size(), expected.size());
+  TEST_EQ(memcmp(released.data(), expected.data(), expected.size()), 0);
+  flatbuffers::Verifier verifier(released.data(), released.size());
+  TEST_ASSERT(VerifyMonsterBuffer(verifier));
+  auto monster = GetMonster(released.data());
+  TEST_EQ(monster->testarrayoftables()->size(), 40u);
+  TEST_EQ(monster->testarrayoftables()->Get(39)->vector_of_doubles()->Get(0),
+          19.5);
+
+  // The builder can be reused after being released.
+  segmented.Finish(BuildSegmentedTestMonster(segmented), MonsterIdentifier());
+  segmented.FlattenBuffer();
+  TEST_EQ(memcmp(segmented.GetBufferPointer(), expected.data(),
+                 expected.size()),
+          0);
+}
+
+void SpliceBuilderTest() {
+  // Build the children in four parts, one of them segmented, which could
+  // have been built in parallel, and splice them into one builder.
+  flatbuffers::FlatBufferBuilder builder(64);
+  std::vector<flatbuffers::Offset<Monster>> children;
+  flatbuffers::FlatBufferBuilder part(64);
+  for (int p = 0; p < 4; p++) {
+    part.Clear();
+    part.SetSegmentSize(p == 2 ? 128 : 0);
+    std::vector<flatbuffers::Offset<Monster>> part_children;
+    for (int i = p * 10; i < p * 10 + 10; i++) {
+      part_children.push_back(BuildSegmentedTestChild(part, i));
+    }
+    const flatbuffers::uoffset_t splice = builder.Splice(part);
+    for (auto it = part_children.begin(); it != part_children.end(); ++it) {
+      children.push_back(flatbuffers::FlatBufferBuilder::SplicedOffset(*it,
+                                                                       splice));
+    }
+  }
+  // A child built in the builder itself shares a vtable of the first part.
+  children.push_back(BuildSegmentedTestChild(builder, 40));
+  auto children_vec = builder.CreateVector(children);
+  auto name = builder.CreateString("spliced");
+  MonsterBuilder root(builder);
+  root.add_name(name);
+  root.add_testarrayoftables(children_vec);
+  builder.Finish(root.Finish(), MonsterIdentifier());
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_ASSERT(VerifyMonsterBuffer(verifier));
+  auto spliced = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  TEST_EQ(spliced->size(), 41u);
+  for (flatbuffers::uoffset_t i = 0; i < spliced->size(); i++) {
+    const Monster* child = spliced->Get(i);
+    TEST_EQ_STR(child->name()->c_str(), ("child" + NumToString(i % 7)).c_str());
+    TEST_EQ(child->hp(), static_cast<int16_t>(i));
+    TEST_EQ(child->pos()->test3().b(), 6);
+    TEST_EQ(child->vector_of_doubles()->size(), i);
+  }
+  auto vtable = [&](flatbuffers::uoffset_t i) {
+    return reinterpret_cast<const flatbuffers::Table*>(spliced->Get(i))
+        ->GetVTable();
+  };
+  TEST_EQ(vtable(40), vtable(1));
+  // Each part has its own copy of the vtable.
+  TEST_NE(vtable(29), vtable(39));
+
+  // Without sharing them, the builder writes its own vtable.
+  builder.Clear();
+  builder.Splice(part, false);
+  auto child = BuildSegmentedTestChild(builder, 40);
+  builder.Finish(child);
+  const size_t unshared_size = builder.GetSize();
+  builder.Clear();
+  builder.Splice(part);
+  child = BuildSegmentedTestChild(builder, 40);
+  builder.Finish(child);
+  TEST_ASSERT(builder.GetSize() < unshared_size);
+}
+
+void CheckNestedInPlaceBuilder(flatbuffers::FlatBufferBuilder& builder) {
+  // An identical monster is built before the nested one, so the nested one
+  // could share its vtable and name if it wasn't prevented.
+  auto outer_child = BuildSegmentedTestChild(builder, 3);
+  auto nested_start = builder.StartNestedFlatBuffer();
+  auto nested_child = BuildSegmentedTestChild(builder, 3);
+  auto nested = builder.EndNestedFlatBuffer(nested_start, nested_child,
+                                            MonsterIdentifier());
+  auto children = builder.CreateVector(&outer_child, 1);
+  auto name = builder.CreateSharedString("child3");
+  MonsterBuilder root(builder);
+  root.add_name(name);
+  root.add_testarrayoftables(children);
+  root.add_testnestedflatbuffer(nested);
+  FinishMonsterBuffer(builder, root.Finish());
+  TEST_ASSERT(!builder.HasOverflowed());
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(true, VerifyMonsterBuffer(verifier));
+  auto monster = GetMonster(builder.GetBufferPointer());
+  auto bytes = monster->testnestedflatbuffer();
+  auto nested_monster = monster->testnestedflatbuffer_nested_root();
+  TEST_NOTNULL(nested_monster);
+  TEST_EQ(nested_monster->hp(), 3);
+  TEST_EQ(nested_monster->vector_of_doubles()->size(), 3u);
+  TEST_EQ(nested_monster->pos()->test3().b(), 6);
+  auto nested_name = nested_monster->name()->c_str();
+  TEST_EQ_STR(nested_name, "child3");
+  auto nested_data = reinterpret_cast<const char*>(bytes->data());
+  TEST_ASSERT(nested_name > nested_data &&
+              nested_name < nested_data + bytes->size());
+  TEST_ASSERT(nested_name !=
+              monster->testarrayoftables()->Get(0)->name()->c_str());
+  // Strings created after the nested buffer may share the ones in it.
+  TEST_ASSERT(monster->name()->c_str() == nested_name);
+
+  // The nested buffer is a valid buffer on its own.
+  std::vector<uint8_t> copy(bytes->begin(), bytes->end());
+  flatbuffers::Verifier nested_verifier(copy.data(), copy.size());
+  TEST_EQ(true, VerifyMonsterBuffer(nested_verifier));
+  TEST_EQ(GetMonster(copy.data())->hp(), 3);
+}
+
+void NestedInPlaceBuilderTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  CheckNestedInPlaceBuilder(builder);
+
+  alignas(8) uint8_t memory[2048];
+  flatbuffers::FlatBufferBuilder fixed(flatbuffers::make_span(memory), 8);
+  CheckNestedInPlaceBuilder(fixed);
+}
+
+#ifdef FLATBUFFERS_BUILDER_STATS
+void BuilderStatsTest() {
+  flatbuffers::FlatBufferBuilder builder(64);
+  builder.Finish(BuildSegmentedTestMonster(builder), MonsterIdentifier());
+  const flatbuffers::BuilderStats stats = builder.GetStats();
+  TEST_ASSERT(stats.reallocations > 0);
+  TEST_ASSERT(stats.bytes_copied > 0);
+  TEST_ASSERT(stats.max_scratch_size > 0);
+  TEST_ASSERT(stats.padding_bytes > 0);
+  // The first child has no `hp`, the other 38 children share a vtable.
+  TEST_EQ(stats.vtable_dedup_hits, 38u);
+  // The 40 children only use 7 different names.
+  TEST_EQ(stats.shared_string_hits, 33u);
+  TEST_EQ(stats.shared_key_hits, 0u);
+
+  builder.ResetStats();
+  size_t sum = 0;
+  builder.GetStats().ForEach([&](const char* name, size_t value) {
+    TEST_NOTNULL(name);
+    sum += value;
+  });
+  TEST_EQ(sum, 0u);
+
+  // Stats are per message after a reset, and the buffer is big enough now.
+  builder.Clear();
+  builder.Finish(BuildSegmentedTestMonster(builder), MonsterIdentifier());
+  TEST_EQ(builder.GetStats().reallocations, 0u);
+  TEST_EQ(builder.GetStats().vtable_dedup_hits, 38u);
+  TEST_EQ(builder.GetStats().padding_bytes, stats.padding_bytes);
+
+  flexbuffers::Builder fbb(16, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+  fbb.Vector([&]() {
+    for (int i = 0; i < 10; i++) {
+      fbb.Map([&]() {
+        fbb.String("name", i % 2 ? "odd" : "even");
+        fbb.Double("value", i);
+      });
+    }
+  });
+  fbb.Finish();
+  const flatbuffers::BuilderStats& flex_stats = fbb.GetStats();
+  TEST_ASSERT(flex_stats.reallocations > 0);
+  TEST_ASSERT(flex_stats.bytes_copied > 0);
+  TEST_ASSERT(flex_stats.max_scratch_size > 0);
+  TEST_ASSERT(flex_stats.padding_bytes > 0);
+  TEST_EQ(flex_stats.vtable_dedup_hits, 0u);
+  TEST_EQ(flex_stats.shared_key_hits, 18u);
+  TEST_EQ(flex_stats.shared_string_hits, 8u);
+}
+#else
+void BuilderStatsTest() {}
+#endif
+
 #if !defined(FLATBUFFERS_USE_STD_SPAN) && !defined(FLATBUFFERS_SPAN_MINIMAL)
 void FlatbuffersSpanTest() {
   // Compile-time checking of non-const [] to const [] conversions.
@@ -1759,6 +1998,9 @@ int FlatBufferTests(const std::string& tests_data_path) {
   MutateFlatBuffersTest(flatbuf.data(), flatbuf.size());
 
   ObjectFlatBuffersTest(flatbuf.data());
+  PackedSizeUpperBoundTest(flatbuf.data());
+  ObjectVectorCopyTest();
+  VectorPrefetchTest();
   UnPackTo(flatbuf.data());
 
   MiniReflectFlatBuffersTest(flatbuf.data());
@@ -1775,6 +2017,7 @@ int FlatBufferTests(const std::string& tests_data_path) {
   FixedLengthArrayJsonTest(tests_data_path, true);
   ReflectionTest(tests_data_path, flatbuf.data(), flatbuf.size());
   ForAllFieldsReverseTest(tests_data_path);
+  CompiledSchemaTest(tests_data_path, flatbuf.data(), flatbuf.size());
   ParseProtoTest(tests_data_path);
   EvolutionTest(tests_data_path);
   UnionDeprecationTest(tests_data_path);
@@ -1799,6 +2042,7 @@ int FlatBufferTests(const std::string& tests_data_path) {
 #endif
 
   UtilConvertCase();
+  EscapeStringTest();
 
   FuzzTest1();
   FuzzTest2();
@@ -1827,8 +2071,17 @@ int FlatBufferTests(const std::string& tests_data_path) {
   TypeAliasesTest();
   EndianSwapTest();
   CreateSharedStringTest();
+  SegmentedBuilderTest();
+  SpliceBuilderTest();
+  NestedInPlaceBuilderTest();
+  BuilderStatsTest();
+  StaticVTablesTest();
+  RecordStreamTest();
+  TranscoderTest();
+  DeltaTest();
   FlexBuffersTest();
   FlexBuffersReuseBugTest();
+  FlexBuffersReuseTrackerTest();
   FlexBuffersDeprecatedTest();
   UninitializedVectorTest();
   EqualOperatorTest();
@@ -1840,6 +2093,9 @@ int FlatBufferTests(const std::string& tests_data_path) {
   NativeTypeTest();
   OptionalScalarsTest();
   ParseFlexbuffersFromJsonWithNullTest();
+  FlexBuffersJsonParserTest();
+  FlexBuffersStreamedTest();
+  FlexBuffersReleaseTest();
   FlatbuffersSpanTest();
   FixedLengthArrayConstructorTest();
   FixedLengthArrayOperatorEqualTest();
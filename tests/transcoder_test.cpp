@@ -0,0 +1,268 @@
+#include "transcoder_test.h"
+
+#include <string>
+
+#include "flatbuffers/idl.h"
+#include "flatbuffers/transcoder.h"
+#include "test_assert.h"
+
+namespace flatbuffers {
+namespace tests {
+
+namespace {
+
+const char* kSourceSchema =
+    "namespace Transcode.V1;"
+    "enum Color : byte { Red, Green, Blue }"
+    "enum Perks : ubyte (bit_flags) { Fly, Swim }"
+    "struct Vec2 { x:float; y:float; }"
+    "table Weapon { name:string; damage:short; }"
+    "table Shield { armor:int; }"
+    "union Equipment { Weapon, Shield }"
+    "table Monster {"
+    "  name:string;"
+    "  hp:short = 100;"
+    "  mana:int;"
+    "  speed:float;"
+    "  pos:Vec2;"
+    "  color:Color = Green;"
+    "  perks:Perks;"
+    "  palette:[Color];"
+    "  inventory:[ubyte];"
+    "  scores:[short];"
+    "  tags:[string];"
+    "  weapons:[Weapon];"
+    "  path:[Vec2];"
+    "  equipped:Equipment;"
+    "  legacy:string;"
+    "  friend:Monster;"
+    "}"
+    "root_type Monster;"
+    "file_identifier \"TRV1\";";
+
+// Fields renumbered, renamed (title), widened (hp, mana, speed, scores,
+// damage), added (level), removed (legacy), with a different default (hp),
+// and enum values and union types renumbered.
+const char* kTargetSchema =
+    "namespace Transcode.V2;"
+    "enum Color : short { Blue, Red, Green, Yellow }"
+    "enum Perks : ubyte (bit_flags) { Dig, Swim, Fly }"
+    "struct Vec2 { x:float; y:float; }"
+    "table Shield { armor:int; }"
+    "table Weapon { damage:int; name:string; }"
+    "union Equipment { Shield, Weapon }"
+    "table Monster {"
+    "  friend:Monster;"
+    "  equipped:Equipment;"
+    "  pos:Vec2;"
+    "  title:string;"
+    "  hp:int = 50;"
+    "  mana:long;"
+    "  speed:double;"
+    "  color:Color = Green;"
+    "  perks:Perks;"
+    "  palette:[Color];"
+    "  inventory:[ubyte];"
+    "  scores:[int];"
+    "  tags:[string];"
+    "  weapons:[Weapon];"
+    "  path:[Vec2];"
+    "  level:int = 1;"
+    "}"
+    "root_type Monster;"
+    "file_identifier \"TRV2\";";
+
+const char* kSourceJson =
+    "{ name: \"Orc\", mana: 20, speed: 1.5, pos: { x: 1, y: 2 },"
+    "  color: Blue, perks: \"Fly Swim\", palette: [Red, Green, Blue],"
+    "  inventory: [1, 2, 3], scores: [-1, 300],"
+    "  tags: [\"a\", \"b\"],"
+    "  weapons: [{ name: \"Axe\", damage: 5 }, { name: \"Bow\", damage: -3 }],"
+    "  path: [{ x: 1, y: 1 }, { x: 2, y: 2 }],"
+    "  equipped_type: Shield, equipped: { armor: 7 }, legacy: \"old\","
+    "  friend: { name: \"Goblin\", hp: 10, perks: Swim, equipped_type: Weapon,"
+    "            equipped: { name: \"Club\", damage: 2 } } }";
+
+const char* kTargetJson =
+    "{ title: \"Orc\", hp: 100, mana: 20, speed: 1.5, pos: { x: 1, y: 2 },"
+    "  color: Blue, perks: \"Fly Swim\", palette: [Red, Green, Blue],"
+    "  inventory: [1, 2, 3], scores: [-1, 300],"
+    "  tags: [\"a\", \"b\"],"
+    "  weapons: [{ name: \"Axe\", damage: 5 }, { name: \"Bow\", damage: -3 }],"
+    "  path: [{ x: 1, y: 1 }, { x: 2, y: 2 }],"
+    "  equipped_type: Shield, equipped: { armor: 7 },"
+    "  friend: { title: \"Goblin\", hp: 10, perks: Swim, equipped_type: Weapon,"
+    "            equipped: { name: \"Club\", damage: 2 } } }";
+
+std::string SerializeSchema(Parser& parser, const char* schema) {
+  TEST_EQ(parser.Parse(schema), true);
+  parser.Serialize();
+  return std::string(
+      reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
+      parser.builder_.GetSize());
+}
+
+std::string ToJson(const Parser& parser, const uint8_t* buffer) {
+  std::string json;
+  TEST_NULL(GenText(parser, buffer, &json));
+  return json;
+}
+
+// Returns the error compiling a transcoder from kSourceSchema to `target`.
+std::string CompileError(const reflection::Schema& source, const char* target,
+                         const TranscoderMapping& mapping) {
+  Parser parser;
+  const std::string bfbs = SerializeSchema(parser, target);
+  Transcoder transcoder(source, *reflection::GetSchema(bfbs.c_str()));
+  TEST_EQ(transcoder.Compile(mapping), false);
+  return transcoder.error();
+}
+
+}  // namespace
+
+void TranscoderTest() {
+  Parser source_parser;
+  const std::string source_bfbs =
+      SerializeSchema(source_parser, kSourceSchema);
+  Parser target_parser;
+  const std::string target_bfbs =
+      SerializeSchema(target_parser, kTargetSchema);
+  auto& source = *reflection::GetSchema(source_bfbs.c_str());
+  auto& target = *reflection::GetSchema(target_bfbs.c_str());
+
+  TranscoderMapping mapping;
+  std::string error;
+  TEST_EQ(mapping.Parse("# V1 to V2\n"
+                        "\n"
+                        "Transcode.V2.Monster.title = name  # Renamed.\n",
+                        &error),
+          true);
+  TEST_EQ(mapping.Parse("title name\n", &error), false);
+  TEST_EQ_STR(error.c_str(), "line 1: expected `target = source`");
+
+  Transcoder transcoder(source, target);
+  TEST_EQ(transcoder.Compile(mapping), true);
+  TEST_EQ_STR(transcoder.error().c_str(), "");
+  TEST_EQ(transcoder.source_root() == transcoder.source().root_table(), true);
+
+  TEST_EQ(source_parser.Parse(kSourceJson), true);
+  TEST_EQ(target_parser.Parse(kTargetJson), true);
+  const std::string expected =
+      ToJson(target_parser, target_parser.builder_.GetBufferPointer());
+
+  FlatBufferBuilder fbb;
+  transcoder.Transcode(source_parser.builder_.GetBufferPointer(), fbb);
+  TEST_EQ(BufferHasIdentifier(fbb.GetBufferPointer(), "TRV2"), true);
+  TEST_EQ(Verify(*transcoder.target().root_table(), fbb.GetBufferPointer(),
+                 fbb.GetSize()),
+          true);
+  TEST_EQ_STR(ToJson(target_parser, fbb.GetBufferPointer()).c_str(),
+              expected.c_str());
+
+  // Size prefixed buffers, as in record streams.
+  FlatBufferBuilder size_prefixed_source;
+  size_prefixed_source.FinishSizePrefixed(
+      CopyTable(size_prefixed_source, *transcoder.source_root(),
+                *GetAnyRoot(source_parser.builder_.GetBufferPointer())));
+  FlatBufferBuilder size_prefixed_fbb;
+  transcoder.Transcode(size_prefixed_source.GetBufferPointer(),
+                       size_prefixed_fbb, true);
+  TEST_EQ(VerifySizePrefixed(*transcoder.target().root_table(),
+                             size_prefixed_fbb.GetBufferPointer(),
+                             size_prefixed_fbb.GetSize()),
+          true);
+  TEST_EQ(GetPrefixedSize(size_prefixed_fbb.GetBufferPointer()) +
+              sizeof(uoffset_t),
+          size_prefixed_fbb.GetSize());
+  TEST_EQ_STR(ToJson(target_parser, size_prefixed_fbb.GetBufferPointer() +
+                                        sizeof(uoffset_t))
+                  .c_str(),
+              expected.c_str());
+
+  // Without the mapping, the name is dropped.
+  Transcoder unmapped(source, target);
+  TEST_EQ(unmapped.Compile(), true);
+  FlatBufferBuilder unmapped_fbb;
+  unmapped.Transcode(source_parser.builder_.GetBufferPointer(), unmapped_fbb);
+  auto root = GetAnyRoot(unmapped_fbb.GetBufferPointer());
+  TEST_NULL(GetFieldS(*root, *target.root_table()->fields()->LookupByKey(
+                                 "title")));
+
+  // Conversions that would lose data are refused.
+  TranscoderMapping no_mapping;
+  TEST_EQ_STR(CompileError(source,
+                           "table Monster { hp:byte; } root_type Monster;",
+                           no_mapping)
+                  .c_str(),
+              "Monster.hp: can't convert Short to Byte without losing values");
+  TEST_EQ_STR(
+      CompileError(source, "table Monster { mana:uint; } root_type Monster;",
+                   no_mapping)
+          .c_str(),
+      "Monster.mana: can't convert Int to UInt without losing values");
+  TEST_EQ_STR(
+      CompileError(source, "table Monster { name:int; } root_type Monster;",
+                   no_mapping)
+          .c_str(),
+      "Monster.name: can't convert String to Int without losing values");
+  TEST_EQ_STR(
+      CompileError(source,
+                   "struct Vec2 { y:float; x:float; }"
+                   "table Monster { pos:Vec2; } root_type Monster;",
+                   no_mapping)
+          .c_str(),
+      "Monster.pos: can't transcode Obj Transcode.V1.Vec2 to Obj Vec2");
+  TEST_EQ_STR(CompileError(source,
+                           "table Monster { id:string (required); }"
+                           "root_type Monster;",
+                           no_mapping)
+                  .c_str(),
+              "Monster.id is required, but has no source field");
+  TEST_EQ_STR(CompileError(source,
+                           "table Monster { name:string (required); }"
+                           "root_type Monster;",
+                           no_mapping)
+                  .c_str(),
+              "Monster.name is required, but its source field "
+              "Transcode.V1.Monster.name is optional");
+  TEST_EQ_STR(
+      CompileError(source,
+                   "enum Color : byte { Red, Blue }"
+                   "table Monster { color:Color; } root_type Monster;",
+                   no_mapping)
+          .c_str(),
+      "Monster.color: Transcode.V1.Color.Green has no value in Color");
+  TEST_EQ_STR(
+      CompileError(source,
+                   "enum Color : byte { Red, Blue }"
+                   "table Monster { palette:[Color]; } root_type Monster;",
+                   no_mapping)
+          .c_str(),
+      "Monster.palette: Transcode.V1.Color.Green has no value in Color");
+  TranscoderMapping bad_mapping;
+  bad_mapping.Add("Monster.title", "no_such_field");
+  TEST_EQ_STR(CompileError(source,
+                           "table Monster { title:string; } root_type Monster;",
+                           bad_mapping)
+                  .c_str(),
+              "Monster.title is mapped to unknown field "
+              "Transcode.V1.Monster.no_such_field");
+
+  // Without a root table in the source schema, the target root table has to
+  // be mapped to a source table.
+  Parser rootless_parser;
+  const std::string rootless_bfbs = SerializeSchema(
+      rootless_parser, "table Monster { name:string; hp:short; }");
+  auto& rootless = *reflection::GetSchema(rootless_bfbs.c_str());
+  Transcoder unrooted(rootless, target);
+  TEST_EQ(unrooted.Compile(), false);
+  TEST_EQ_STR(unrooted.error().c_str(), "the source schema has no root table");
+  TEST_NULL(unrooted.source_root());
+  TranscoderMapping root_mapping;
+  root_mapping.Add("Transcode.V2.Monster", "Monster");
+  TEST_EQ(unrooted.Compile(root_mapping), true);
+  TEST_EQ_STR(unrooted.source_root()->def->name()->c_str(), "Monster");
+}
+
+}  // namespace tests
+}  // namespace flatbuffers
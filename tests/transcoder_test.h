@@ -0,0 +1,12 @@
+#ifndef TESTS_TRANSCODER_TEST_H
+#define TESTS_TRANSCODER_TEST_H
+
+namespace flatbuffers {
+namespace tests {
+
+void TranscoderTest();
+
+}  // namespace tests
+}  // namespace flatbuffers
+
+#endif
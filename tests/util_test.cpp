@@ -1,5 +1,7 @@
 #include "util_test.h"
 
+#include <string>
+
 #include "flatbuffers/util.h"
 #include "test_assert.h"
 
@@ -169,5 +171,57 @@ void UtilConvertCase() {
   }
 }
 
+void EscapeStringTest() {
+  struct EscapeCase {
+    std::string input;
+    std::string escaped;
+  };
+  const EscapeCase cases[] = {
+    { "\n", "\\n" },
+    { "\t", "\\t" },
+    { "\"", "\\\"" },
+    { "\\", "\\\\" },
+    { std::string(1, '\0'), "\\u0000" },
+    { "\x01", "\\u0001" },
+    { "\x1f", "\\u001F" },
+    { "\x7f", "\\u007F" },
+    { "\xc3\xa9", "\\u00E9" },
+    { "\xf0\x9f\x98\x80", "\\uD83D\\uDE00" },
+  };
+  // Each character to escape at every position of runs of characters to copy
+  // as they are, on both sides of the eight characters looked at at once.
+  for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+    for (size_t before = 0; before < 20; before++) {
+      const std::string prefix(before, static_cast<char>('a' + before % 26));
+      const std::string suffix = "~ xyz 012345678";
+      const std::string input = prefix + cases[c].input + suffix;
+      std::string text;
+      TEST_EQ(EscapeString(input.c_str(), input.size(), &text, false, false),
+              true);
+      TEST_EQ_STR(text.c_str(),
+                  ("\"" + prefix + cases[c].escaped + suffix + "\"").c_str());
+    }
+  }
+
+  const std::string utf8 =
+      "caf\xc3\xa9 cr\xc3\xa8me br\xc3\xbbl\xc3\xa9"
+      "e, \"ok\"";
+  std::string text;
+  TEST_EQ(EscapeString(utf8.c_str(), utf8.size(), &text, false, true), true);
+  TEST_EQ_STR(text.c_str(),
+              "\"caf\xc3\xa9 cr\xc3\xa8me br\xc3\xbbl\xc3\xa9"
+              "e, \\\"ok\\\"\"");
+
+  // Invalid UTF-8 is either an error, or escaped byte by byte.
+  const std::string invalid = "0123456789\xff\xc3(";
+  text.clear();
+  TEST_EQ(EscapeString(invalid.c_str(), invalid.size(), &text, false, true),
+          false);
+  text.clear();
+  TEST_EQ(EscapeString(invalid.c_str(), invalid.size(), &text, true, true),
+          true);
+  TEST_EQ_STR(text.c_str(), "\"0123456789\\xFF\\xC3(\"");
+}
+
 }  // namespace tests
 }  // namespace flatbuffers